@@ -96,6 +96,18 @@ namespace PCGExBlending
 		return true;
 	}
 
+	void FMetadataBlender::ExtractBlenders(TFunctionRef<bool(const FProxyDataBlender&)> Predicate, TArray<TSharedPtr<FProxyDataBlender>>& OutBlenders)
+	{
+		int32 WriteIndex = 0;
+		for (int i = 0; i < Blenders.Num(); i++)
+		{
+			if (Predicate(*Blenders[i].Get())) { OutBlenders.Add(Blenders[i]); }
+			else { Blenders[WriteIndex++] = Blenders[i]; }
+		}
+
+		Blenders.SetNum(WriteIndex);
+	}
+
 	void FMetadataBlender::Blend(const int32 SourceIndex, const int32 TargetIndex, const double Weight) const
 	{
 		for (int i = 0; i < Blenders.Num(); i++)
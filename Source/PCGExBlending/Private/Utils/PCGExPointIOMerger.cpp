@@ -128,6 +128,121 @@ namespace PCGExPointIOMerger
 		}
 	};
 
+	// Default key funcs for strings, names and soft paths ignore case, which would fold "Foo" and "foo" into a
+	// single output value. Hashes stay the default ones -- values that match exactly always hash alike.
+	template <typename T>
+	struct TExactValueKeyFuncs : TDefaultMapHashableKeyFuncs<T, PCGMetadataValueKey, false>
+	{
+		static FORCEINLINE bool Matches(const T& A, const T& B)
+		{
+			if constexpr (std::is_same_v<T, FString>)
+			{
+				return A.Equals(B, ESearchCase::CaseSensitive);
+			}
+			else if constexpr (std::is_same_v<T, FName>)
+			{
+				return A.IsEqual(B, ENameCase::CaseSensitive);
+			}
+			else if constexpr (std::is_base_of_v<FSoftObjectPath, T>)
+			{
+				return A.GetAssetPath().GetPackageName().IsEqual(B.GetAssetPath().GetPackageName(), ENameCase::CaseSensitive) &&
+					A.GetAssetPath().GetAssetName().IsEqual(B.GetAssetPath().GetAssetName(), ENameCase::CaseSensitive) &&
+					A.GetSubPathString().Equals(B.GetSubPathString(), ESearchCase::CaseSensitive);
+			}
+			else
+			{
+				return A == B;
+			}
+		}
+	};
+
+	// Metadata-level merge for deduplicated value types: values referenced by each source are added to the
+	// output value table once, and output entries only receive remapped value keys. Nothing goes through a
+	// point buffer, so values aren't copied per point and again on write.
+	template <typename T>
+	void MergeValueKeys(const FPCGExPointIOMerger* Merger, const PCGExData::FAttributeIdentity& Identity, const T& DefaultValue)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPointIOMerger::MergeValueKeys);
+
+		const FPCGAttributeIdentifier Identifier = Identity.GetIdentifier();
+		UPCGBasePointData* OutData = Merger->UnionDataFacade->GetOut();
+
+		FPCGMetadataDomain* Domain = OutData->Metadata->GetMetadataDomain(Identifier.MetadataDomain);
+		if (!Domain)
+		{
+			Domain = OutData->Metadata->GetDefaultMetadataDomain();
+		}
+
+		FPCGMetadataAttribute<T>* OutAttribute = Domain->FindOrCreateAttribute<T>(Identifier.Name, DefaultValue, Identity.GetAllowsInterpolation(), true, true);
+		if (!OutAttribute)
+		{
+			return;
+		}
+
+		const TConstPCGValueRange<int64> OutEntries = OutData->GetConstMetadataEntryValueRange();
+
+		TMap<T, PCGMetadataValueKey, FDefaultSetAllocator, TExactValueKeyFuncs<T>> OutValueKeys; // Output value table, deduplicated across sources
+		TMap<PCGMetadataValueKey, PCGMetadataValueKey> Remap; // Source value key -> output value key
+
+		TArray<PCGMetadataEntryKey> EntryKeys;
+		TArray<PCGMetadataValueKey> ValueKeys;
+
+		for (int i = 0; i < Merger->IOSources.Num(); i++)
+		{
+			const FMergeScope& Scope = Merger->Scopes[i];
+			if (Scope.Write.Count <= 0)
+			{
+				continue;
+			}
+
+			const TSharedPtr<PCGExData::FPointIO>& SourceIO = Merger->IOSources[i];
+			const FPCGMetadataAttributeBase* Attribute = SourceIO->FindConstAttribute(Identifier);
+			if (!Attribute || !Attribute->IsOfType<T>())
+			{
+				continue;
+			}
+
+			const FPCGMetadataAttribute<T>* InAttribute = static_cast<const FPCGMetadataAttribute<T>*>(Attribute);
+			const TConstPCGValueRange<int64> InEntries = SourceIO->GetIn()->GetConstMetadataEntryValueRange();
+
+			EntryKeys.SetNumUninitialized(Scope.Write.Count);
+			for (int j = 0; j < Scope.Write.Count; j++)
+			{
+				EntryKeys[j] = InEntries[Scope.bReverse ? Scope.Read.End - 1 - j : Scope.Read.Start + j];
+			}
+
+			ValueKeys.Reset();
+			InAttribute->GetValueKeys(TConstArrayView<PCGMetadataEntryKey>(EntryKeys), ValueKeys);
+
+			Remap.Reset();
+			for (PCGMetadataValueKey& ValueKey : ValueKeys)
+			{
+				if (const PCGMetadataValueKey* Mapped = Remap.Find(ValueKey))
+				{
+					ValueKey = *Mapped;
+					continue;
+				}
+
+				const T Value = InAttribute->GetValue(ValueKey);
+				const PCGMetadataValueKey* OutKey = OutValueKeys.Find(Value);
+				if (!OutKey)
+				{
+					OutKey = &OutValueKeys.Add(Value, OutAttribute->AddValue(Value));
+				}
+
+				Remap.Add(ValueKey, *OutKey);
+				ValueKey = *OutKey;
+			}
+
+			for (int j = 0; j < Scope.Write.Count; j++)
+			{
+				EntryKeys[j] = OutEntries[Scope.Write.Start + j];
+			}
+
+			OutAttribute->SetValuesFromValueKeys(TConstArrayView<PCGMetadataEntryKey>(EntryKeys), TConstArrayView<PCGMetadataValueKey>(ValueKeys));
+		}
+	}
+
 	// Builds one output attribute: the real attribute wins (type and points), and a same-named tag
 	// composites in where a source lacks it -- best-effort converted via PCGExTypeOps, no type gate.
 	class FCopyAttributeTask final : public PCGExMT::FPCGExIndexedTask
@@ -167,14 +282,23 @@ namespace PCGExPointIOMerger
 					// Typed path -- basic legacy types covered by PCGEX_FOREACH_SUPPORTEDTYPES.
 					using T = decltype(DummyValue);
 
-					TSharedPtr<PCGExData::TBuffer<T>> Buffer = Merger->UnionDataFacade->GetWritable(
-						TargetIdentifier,
-						bInitDefault && Identity.Attribute
+					const T DefaultValue = bInitDefault && Identity.Attribute
 						? (Identity.InDataDomain()
 							? PCGExData::Helpers::ReadDataValue<T>(Identity.Attribute)
 							: Identity.Attribute->GetValueFromItemKey<T>(PCGDefaultValueKey))
-						: T{},
-						bAllowsInterp, PCGExData::EBufferInit::New);
+						: T{};
+
+					if constexpr (std::is_same_v<T, FString> || std::is_same_v<T, FName> || std::is_same_v<T, FSoftObjectPath> || std::is_same_v<T, FSoftClassPath>)
+					{
+						if (Merger->WantsValueKeyRemap(TaskIndex))
+						{
+							MergeValueKeys<T>(Merger.Get(), Identity, DefaultValue);
+							return;
+						}
+					}
+
+					TSharedPtr<PCGExData::TBuffer<T>> Buffer = Merger->UnionDataFacade->GetWritable(
+						TargetIdentifier, DefaultValue, bAllowsInterp, PCGExData::EBufferInit::New);
 
 					for (int i = 0; i < Merger->IOSources.Num(); i++)
 					{
@@ -494,6 +618,39 @@ void FPCGExPointIOMerger::MergeAsync(const TSharedPtr<PCGExMT::FTaskManager>& Ta
 
 	UPCGBasePointData* OutPointData = UnionDataFacade->GetOut();
 	const bool bHasAttributes = !UniqueIdentities.IsEmpty();
+
+	// String-like element attributes are merged through value keys: their value tables are deduplicated, and a
+	// point buffer would copy every value in, then again on write. Domain conversions, tag composites and
+	// attributes the output already carries stay on the buffer path.
+	bool bAnyValueKeyRemap = false;
+	ValueKeyRemap.Init(false, UniqueIdentities.Num());
+	for (int i = 0; i < UniqueIdentities.Num(); i++)
+	{
+		const PCGExData::FAttributeIdentity& Identity = UniqueIdentities[i];
+		if (Identity.bTagOnly || Identity.InDataDomain() || TagValuesByName.Contains(Identity.Name))
+		{
+			continue;
+		}
+
+		switch (Identity.GetType())
+		{
+		case EPCGMetadataTypes::String:
+		case EPCGMetadataTypes::Name:
+		case EPCGMetadataTypes::SoftObjectPath:
+		case EPCGMetadataTypes::SoftClassPath:
+			break;
+		default:
+			continue;
+		}
+
+		if (PCGExMetaHelpers::HasAttribute(OutPointData, Identity.GetIdentifier()))
+		{
+			continue;
+		}
+
+		ValueKeyRemap[i] = true;
+		bAnyValueKeyRemap = true;
+	}
 	if (bHasAttributes)
 	{
 		EnumAddFlags(AllocateProperties, EPCGPointNativeProperties::MetadataEntry);
@@ -504,6 +661,12 @@ void FPCGExPointIOMerger::MergeAsync(const TSharedPtr<PCGExMT::FTaskManager>& Ta
 	if (bHasAttributes)
 	{
 		OutPointData->SetMetadataEntry(PCGInvalidEntryKey);
+
+		// Value keys are set per entry, every point needs one up front
+		if (bAnyValueKeyRemap)
+		{
+			UnionDataFacade->Source->InitializeMetadataEntries_Unsafe(true);
+		}
 	}
 
 	PCGEX_ASYNC_GROUP_CHKD_VOID(TaskManager, CopyProperties)
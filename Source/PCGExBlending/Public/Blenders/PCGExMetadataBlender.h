@@ -51,6 +51,15 @@ namespace PCGExBlending
 			return AttributeIdentifiers;
 		}
 
+		int32 GetNumBlenders() const
+		{
+			return Blenders.Num();
+		}
+
+		/** Moves the blenders matching the predicate out of this one, so callers can process them through a dedicated path.
+		 * Must happen before trackers are initialized. */
+		void ExtractBlenders(TFunctionRef<bool(const FProxyDataBlender&)> Predicate, TArray<TSharedPtr<FProxyDataBlender>>& OutBlenders);
+
 	protected:
 		bool bUseTargetAsSecondarySource = true;
 
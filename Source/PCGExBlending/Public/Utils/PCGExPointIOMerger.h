@@ -77,6 +77,12 @@ public:
 		return bInitDefault;
 	}
 
+	// Whether this identity is merged through value keys rather than a point buffer, see MergeAsync.
+	bool WantsValueKeyRemap(const int32 IdentityIndex) const
+	{
+		return ValueKeyRemap.IsValidIndex(IdentityIndex) && ValueKeyRemap[IdentityIndex];
+	}
+
 	TSharedPtr<FPCGExIntTracker> InternalTracker;
 
 protected:
@@ -88,6 +94,9 @@ protected:
 	// (vs. a zero-init T{}). Sourced from FPCGExCarryOverDetails::bPreserveAttributesDefaultValue.
 	bool bInitDefault = false;
 
+	// Per-identity: merged at the metadata level, by appending source values once and remapping value keys.
+	TBitArray<> ValueKeyRemap;
+
 	// Tag keys converted to attributes this merge; stripped from the merged data-domain tags before write.
 	TSet<FName> ConvertedTagNames;
 	int32 NumCompositePoints = 0;
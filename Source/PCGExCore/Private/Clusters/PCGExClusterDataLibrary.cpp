@@ -22,6 +22,10 @@ namespace PCGExClusters
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FDataLibrary::Build_Mixed);
 
+		// Interned once, so per-IO tag checks don't hash strings
+		const PCGExData::FTagAtom VtxAtom = PCGExData::TagAtoms::Intern(Labels::TagStr_PCGExVtx);
+		const PCGExData::FTagAtom EdgesAtom = PCGExData::TagAtoms::Intern(Labels::TagStr_PCGExEdges);
+
 		if (InMixedCollection->Pairs.IsEmpty())
 		{
 			return false;
@@ -33,9 +37,9 @@ namespace PCGExClusters
 		{
 			// Vtx ?
 
-			if (MainIO->Tags->IsTagged(Labels::TagStr_PCGExVtx))
+			if (MainIO->Tags->IsTagged(VtxAtom))
 			{
-				if (MainIO->Tags->IsTagged(Labels::TagStr_PCGExEdges))
+				if (MainIO->Tags->IsTagged(EdgesAtom))
 				{
 					Invalidate(MainIO, EProblem::DoubleMarking);
 					continue;
@@ -53,9 +57,9 @@ namespace PCGExClusters
 
 			// Edge ?
 
-			if (MainIO->Tags->IsTagged(Labels::TagStr_PCGExEdges))
+			if (MainIO->Tags->IsTagged(EdgesAtom))
 			{
-				if (MainIO->Tags->IsTagged(Labels::TagStr_PCGExVtx))
+				if (MainIO->Tags->IsTagged(VtxAtom))
 				{
 					Invalidate(MainIO, EProblem::DoubleMarking);
 					continue;
@@ -81,6 +85,9 @@ namespace PCGExClusters
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FDataLibrary::Build);
 
+		const PCGExData::FTagAtom VtxAtom = PCGExData::TagAtoms::Intern(Labels::TagStr_PCGExVtx);
+		const PCGExData::FTagAtom EdgesAtom = PCGExData::TagAtoms::Intern(Labels::TagStr_PCGExEdges);
+
 		if (InVtxCollection->IsEmpty() || InEdgeCollection->IsEmpty())
 		{
 			return false;
@@ -89,9 +96,9 @@ namespace PCGExClusters
 		// Gather Vtx inputs
 		for (const TSharedPtr<PCGExData::FPointIO>& VtxIO : InVtxCollection->Pairs)
 		{
-			if (VtxIO->Tags->IsTagged(Labels::TagStr_PCGExVtx))
+			if (VtxIO->Tags->IsTagged(VtxAtom))
 			{
-				if (VtxIO->Tags->IsTagged(Labels::TagStr_PCGExEdges))
+				if (VtxIO->Tags->IsTagged(EdgesAtom))
 				{
 					Invalidate(VtxIO, EProblem::DoubleMarking);
 					continue;
@@ -107,9 +114,9 @@ namespace PCGExClusters
 				continue;
 			}
 
-			if (VtxIO->Tags->IsTagged(Labels::TagStr_PCGExEdges))
+			if (VtxIO->Tags->IsTagged(EdgesAtom))
 			{
-				if (VtxIO->Tags->IsTagged(Labels::TagStr_PCGExVtx))
+				if (VtxIO->Tags->IsTagged(VtxAtom))
 				{
 					Invalidate(VtxIO, EProblem::DoubleMarking);
 					continue;
@@ -125,9 +132,9 @@ namespace PCGExClusters
 		// Gather Edge inputs
 		for (const TSharedPtr<PCGExData::FPointIO>& MainIO : InEdgeCollection->Pairs)
 		{
-			if (MainIO->Tags->IsTagged(Labels::TagStr_PCGExEdges))
+			if (MainIO->Tags->IsTagged(EdgesAtom))
 			{
-				if (MainIO->Tags->IsTagged(Labels::TagStr_PCGExVtx))
+				if (MainIO->Tags->IsTagged(VtxAtom))
 				{
 					Invalidate(MainIO, EProblem::DoubleMarking);
 					continue;
@@ -143,9 +150,9 @@ namespace PCGExClusters
 				continue;
 			}
 
-			if (MainIO->Tags->IsTagged(Labels::TagStr_PCGExVtx))
+			if (MainIO->Tags->IsTagged(VtxAtom))
 			{
-				if (MainIO->Tags->IsTagged(Labels::TagStr_PCGExEdges))
+				if (MainIO->Tags->IsTagged(EdgesAtom))
 				{
 					Invalidate(MainIO, EProblem::DoubleMarking);
 					continue;
@@ -0,0 +1,294 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Containers/PCGExArena.h"
+
+#include <atomic>
+#include "Misc/ScopeLock.h"
+
+namespace PCGExMT
+{
+	namespace Arena
+	{
+		static thread_local FArenaPool* GBoundPool = nullptr;
+		static thread_local FArena* GBoundArena = nullptr;
+
+#if PCGEX_ARENA_STATS
+		static std::atomic<int64> GNumPools{0};
+		static std::atomic<int64> GNumArenas{0};
+		static std::atomic<int64> GNumAllocations{0};
+		static std::atomic<int64> GNumInPlaceResizes{0};
+		static std::atomic<int64> GNumHeapFallbacks{0};
+		static std::atomic<int64> GAllocatedBytes{0};
+		static std::atomic<int64> GReservedBytes{0};
+
+		void CountHeapFallback()
+		{
+			GNumHeapFallbacks.fetch_add(1, std::memory_order_relaxed);
+		}
+#endif
+
+		FArenaPool* GetBoundPool() { return GBoundPool; }
+		FArena* GetBoundArena() { return GBoundArena; }
+
+		FStats GetStats()
+		{
+			FStats Stats;
+#if PCGEX_ARENA_STATS
+			Stats.NumPools = GNumPools.load(std::memory_order_relaxed);
+			Stats.NumArenas = GNumArenas.load(std::memory_order_relaxed);
+			Stats.NumAllocations = GNumAllocations.load(std::memory_order_relaxed);
+			Stats.NumInPlaceResizes = GNumInPlaceResizes.load(std::memory_order_relaxed);
+			Stats.NumHeapFallbacks = GNumHeapFallbacks.load(std::memory_order_relaxed);
+			Stats.AllocatedBytes = GAllocatedBytes.load(std::memory_order_relaxed);
+			Stats.ReservedBytes = GReservedBytes.load(std::memory_order_relaxed);
+#endif
+			return Stats;
+		}
+
+		void ResetStats()
+		{
+#if PCGEX_ARENA_STATS
+			GNumPools.store(0, std::memory_order_relaxed);
+			GNumArenas.store(0, std::memory_order_relaxed);
+			GNumAllocations.store(0, std::memory_order_relaxed);
+			GNumInPlaceResizes.store(0, std::memory_order_relaxed);
+			GNumHeapFallbacks.store(0, std::memory_order_relaxed);
+			GAllocatedBytes.store(0, std::memory_order_relaxed);
+			GReservedBytes.store(0, std::memory_order_relaxed);
+#endif
+		}
+	}
+
+#pragma region FArena
+
+	FArena::~FArena()
+	{
+		for (void* Block : Blocks) { FMemory::Free(Block); }
+	}
+
+	void* FArena::AllocateBlock(const SIZE_T InBytes)
+	{
+		void* Block = FMemory::Malloc(InBytes, 16);
+		Blocks.Add(Block);
+		ReservedBytes += InBytes;
+		return Block;
+	}
+
+	void* FArena::Allocate(const SIZE_T InBytes, const uint32 InAlignment)
+	{
+		const uint32 Alignment = FMath::Max<uint32>(InAlignment, 8);
+		uint8* Ptr = Align(Cursor, Alignment);
+
+		if (!Cursor || Ptr + InBytes > End)
+		{
+			if (InBytes + Alignment > BlockSize / 2)
+			{
+				// Oversized request gets a dedicated block, the current one keeps serving small allocations
+				uint8* Block = static_cast<uint8*>(AllocateBlock(InBytes + Alignment));
+				NumAllocations++;
+				AllocatedBytes += InBytes;
+				return Align(Block, Alignment);
+			}
+
+			Cursor = static_cast<uint8*>(AllocateBlock(BlockSize));
+			End = Cursor + BlockSize;
+			Ptr = Align(Cursor, Alignment);
+		}
+
+		Cursor = Ptr + InBytes;
+		NumAllocations++;
+		AllocatedBytes += InBytes;
+		return Ptr;
+	}
+
+	bool FArena::TryResizeInPlace(void* Ptr, const SIZE_T InOldBytes, const SIZE_T InNewBytes)
+	{
+		uint8* Start = static_cast<uint8*>(Ptr);
+		if (Start + InOldBytes != Cursor || Start + InNewBytes > End)
+		{
+			return false;
+		}
+
+		Cursor = Start + InNewBytes;
+		NumInPlaceResizes++;
+		if (InNewBytes > InOldBytes) { AllocatedBytes += InNewBytes - InOldBytes; }
+		return true;
+	}
+
+	void FArena::Free(void* Ptr, const SIZE_T InBytes)
+	{
+		uint8* Start = static_cast<uint8*>(Ptr);
+		if (Start + InBytes == Cursor) { Cursor = Start; }
+	}
+
+#pragma endregion
+
+#pragma region FArenaPool
+
+	FArenaPool::~FArenaPool()
+	{
+#if PCGEX_ARENA_STATS
+		Arena::GNumPools.fetch_add(1, std::memory_order_relaxed);
+		Arena::GNumArenas.fetch_add(Arenas.Num(), std::memory_order_relaxed);
+		for (const TUniquePtr<FArena>& A : Arenas)
+		{
+			Arena::GNumAllocations.fetch_add(A->NumAllocations, std::memory_order_relaxed);
+			Arena::GNumInPlaceResizes.fetch_add(A->NumInPlaceResizes, std::memory_order_relaxed);
+			Arena::GAllocatedBytes.fetch_add(A->AllocatedBytes, std::memory_order_relaxed);
+			Arena::GReservedBytes.fetch_add(A->ReservedBytes, std::memory_order_relaxed);
+		}
+#endif
+	}
+
+	FArena* FArenaPool::Acquire()
+	{
+		FScopeLock Lock(&PoolLock);
+		if (!Available.IsEmpty()) { return Available.Pop(EAllowShrinking::No); }
+		return Arenas.Add_GetRef(MakeUnique<FArena>()).Get();
+	}
+
+	void FArenaPool::Release(FArena* InArena)
+	{
+		FScopeLock Lock(&PoolLock);
+		Available.Add(InArena);
+	}
+
+#pragma endregion
+
+#pragma region FArenaScope
+
+	FArenaScope::FArenaScope(FArenaPool* InPool)
+		: PreviousPool(Arena::GBoundPool), PreviousArena(Arena::GBoundArena)
+	{
+		if (!InPool || InPool == PreviousPool)
+		{
+			return;
+		}
+
+		Pool = InPool;
+		Arena = Pool->Acquire();
+
+		Arena::GBoundPool = Pool;
+		Arena::GBoundArena = Arena;
+	}
+
+	FArenaScope::~FArenaScope()
+	{
+		if (!Pool)
+		{
+			return;
+		}
+
+		Arena::GBoundPool = PreviousPool;
+		Arena::GBoundArena = PreviousArena;
+
+		Pool->Release(Arena);
+	}
+
+#pragma endregion
+
+#pragma region FArenaAllocator
+
+	void FArenaAllocator::ForAnyElementType::MoveToEmpty(ForAnyElementType& Other)
+	{
+		check(this != &Other);
+
+		Release();
+
+		Data = Other.Data;
+		Bytes = Other.Bytes;
+		Arena = Other.Arena;
+		Pool = MoveTemp(Other.Pool);
+
+		Other.Data = nullptr;
+		Other.Bytes = 0;
+		Other.Arena = nullptr;
+	}
+
+	void FArenaAllocator::ForAnyElementType::Release()
+	{
+		if (!Data)
+		{
+			return;
+		}
+
+		if (!Arena)
+		{
+			FMemory::Free(Data);
+		}
+		else if (Arena == Arena::GBoundArena)
+		{
+			// Only the thread currently owning the arena may touch its cursor
+			Arena->Free(Data, Bytes);
+		}
+
+		Data = nullptr;
+		Bytes = 0;
+		Arena = nullptr;
+		Pool.Reset();
+	}
+
+	void FArenaAllocator::ForAnyElementType::ResizeAllocation(const SizeType CurrentNum, const SizeType NewMax, const SIZE_T NumBytesPerElement, const uint32 AlignmentOfElement)
+	{
+		if (NewMax <= 0)
+		{
+			Release();
+			return;
+		}
+
+		const SIZE_T NewBytes = static_cast<SIZE_T>(NewMax) * NumBytesPerElement;
+
+		if (Data && !Arena)
+		{
+			// Heap-backed until emptied
+			Data = static_cast<FScriptContainerElement*>(FMemory::Realloc(Data, NewBytes, AlignmentOfElement));
+			Bytes = NewBytes;
+			return;
+		}
+
+		FArena* BoundArena = Arena::GBoundArena;
+
+		if (!BoundArena)
+		{
+			Arena::CountHeapFallback();
+
+			void* NewData = FMemory::Malloc(NewBytes, AlignmentOfElement);
+			if (Data) { FMemory::Memcpy(NewData, Data, static_cast<SIZE_T>(CurrentNum) * NumBytesPerElement); }
+
+			Data = static_cast<FScriptContainerElement*>(NewData);
+			Bytes = NewBytes;
+			Arena = nullptr;
+			Pool.Reset();
+			return;
+		}
+
+		if (Data)
+		{
+			if (Arena == BoundArena && BoundArena->TryResizeInPlace(Data, Bytes, NewBytes))
+			{
+				Bytes = NewBytes;
+				return;
+			}
+
+			// Arena shrink: keep the data where it is
+			if (NewBytes <= Bytes)
+			{
+				return;
+			}
+		}
+
+		void* NewData = BoundArena->Allocate(NewBytes, AlignmentOfElement);
+		if (Data) { FMemory::Memcpy(NewData, Data, static_cast<SIZE_T>(CurrentNum) * NumBytesPerElement); }
+
+		// Previous memory stays in its arena until the pool is released
+		Data = static_cast<FScriptContainerElement*>(NewData);
+		Bytes = NewBytes;
+		Arena = BoundArena;
+
+		FArenaPool* BoundPool = Arena::GBoundPool;
+		if (Pool.Get() != BoundPool) { Pool = BoundPool->AsShared(); }
+	}
+
+#pragma endregion
+}
@@ -7,6 +7,7 @@
 #include "PCGExLog.h"
 #include "PCGExSettingsCacheBody.h"
 #include "PCGExSubSystem.h"
+#include "Containers/PCGExArena.h"
 #include "Async/Async.h"
 #include "UObject/GarbageCollection.h"
 #include "UObject/UObjectGlobals.h"
@@ -828,10 +829,7 @@ namespace PCGExMT
 				FRegistrationGuard Guard(SharedThis(this));
 
 				RegisterExpected(NumScopes);
-				if (OnPrepareSubLoopsCallback)
-				{
-					OnPrepareSubLoopsCallback(Loops);
-				}
+				PrepareSubLoops(Loops);
 
 				PCGEX_MAKE_SHARED(Task, FScopeIterationTask)
 				Task->bPrepareOnly = bPreparationOnly;
@@ -857,11 +855,7 @@ namespace PCGExMT
 				FRegistrationGuard Guard(SharedThis(this));
 
 				RegisterExpected(NumScopes);
-
-				if (OnPrepareSubLoopsCallback)
-				{
-					OnPrepareSubLoopsCallback(Loops);
-				}
+				PrepareSubLoops(Loops);
 
 				// Counter bookkeeping: mark all scopes started in one shot so CheckCompletion's
 				// Started==Completed invariant holds when the guard destructor fires.
@@ -926,12 +920,37 @@ namespace PCGExMT
 		StartHandlesBatchImpl(Tasks);
 	}
 
+	void FTaskGroup::OnEnd(const bool bWasCancelled)
+	{
+		IAsyncHandleGroup::OnEnd(bWasCancelled);
+
+		// Bulk release -- arena-backed containers still alive keep their pool until they're done with it.
+		// A cancelled group may still have scopes winding down, those hold the group alive & the pool goes with it.
+		if (!bWasCancelled) { ArenaPool.Reset(); }
+	}
+
+	void FTaskGroup::PrepareSubLoops(const TArray<FScope>& Loops)
+	{
+		if (bUseArena && !ArenaPool)
+		{
+			ArenaPool = MakeShared<FArenaPool>();
+		}
+
+		if (OnPrepareSubLoopsCallback)
+		{
+			FArenaScope ArenaScope(ArenaPool.Get());
+			OnPrepareSubLoopsCallback(Loops);
+		}
+	}
+
 	void FTaskGroup::ExecScopeIteration(const FScope& Scope, const bool bPrepareOnly) const
 	{
 		if (!IsAvailable())
 		{
 			return;
 		}
+
+		FArenaScope ArenaScope(ArenaPool.Get());
 		if (OnSubLoopStartCallback)
 		{
 			OnSubLoopStartCallback(Scope);
@@ -3,8 +3,71 @@
 
 #include "Data/PCGExDataTags.h"
 
+#include "Algo/BinarySearch.h"
+
 namespace PCGExData
 {
+	namespace TagAtoms
+	{
+		// Sharded by name hash, so concurrent interning of unrelated tags rarely contends.
+		// Atoms pack the shard in their low bits and the 1-based slot in the shard above, so 0 is never handed out.
+		constexpr int32 ShardBits = 4;
+		constexpr uint32 ShardMask = (1 << ShardBits) - 1;
+
+		struct FShard
+		{
+			FRWLock Lock;
+			TMap<FString, FTagAtom> Atoms; // FString hashing and equality are case-insensitive, like tag lookups
+			TArray<FString> Names;
+		};
+
+		static FShard& GetShard(const uint32 Index)
+		{
+			static FShard Shards[1 << ShardBits];
+			return Shards[Index & ShardMask];
+		}
+
+		FTagAtom Intern(const FString& InName)
+		{
+			const uint32 Hash = GetTypeHash(InName);
+			FShard& Shard = GetShard(Hash);
+
+			{
+				FReadScopeLock ReadScopeLock(Shard.Lock);
+				if (const FTagAtom* Atom = Shard.Atoms.FindByHash(Hash, InName)) { return *Atom; }
+			}
+
+			FWriteScopeLock WriteScopeLock(Shard.Lock);
+			if (const FTagAtom* Atom = Shard.Atoms.FindByHash(Hash, InName)) { return *Atom; }
+
+			const FTagAtom Atom = (static_cast<uint32>(Shard.Names.Num() + 1) << ShardBits) | (Hash & ShardMask);
+			Shard.Names.Add(InName);
+			Shard.Atoms.AddByHash(Hash, InName, Atom);
+			return Atom;
+		}
+
+		FTagAtom Find(const FString& InName)
+		{
+			const uint32 Hash = GetTypeHash(InName);
+			FShard& Shard = GetShard(Hash);
+
+			FReadScopeLock ReadScopeLock(Shard.Lock);
+			const FTagAtom* Atom = Shard.Atoms.FindByHash(Hash, InName);
+			return Atom ? *Atom : InvalidTagAtom;
+		}
+
+		FString ToString(const FTagAtom InAtom)
+		{
+			if (InAtom == InvalidTagAtom) { return FString(); }
+
+			FShard& Shard = GetShard(InAtom);
+			const int32 Slot = static_cast<int32>(InAtom >> ShardBits) - 1;
+
+			FReadScopeLock ReadScopeLock(Shard.Lock);
+			return Shard.Names.IsValidIndex(Slot) ? Shard.Names[Slot] : FString();
+		}
+	}
+
 	int32 FTags::Num() const
 	{
 		return RawTags.Num() + ValueTags.Num();
@@ -38,7 +101,44 @@ namespace PCGExData
 
 	void FTags::Append(const TSharedRef<FTags>& InTags)
 	{
-		Append(InTags->FlattenToArray());
+		if (&InTags.Get() == this)
+		{
+			return;
+		}
+
+		// Raw tags and their atoms carry over as-is; value tags go through a flatten/parse round trip so values aren't shared
+		TSet<FString> OtherRawTags;
+		TArray<FTagAtom> OtherRawAtoms;
+		TArray<FString> OtherValueTags;
+
+		{
+			FReadScopeLock ReadScopeLock(InTags->TagsLock);
+			OtherRawTags = InTags->RawTags;
+			OtherRawAtoms = InTags->RawAtoms;
+			OtherValueTags.Reserve(InTags->ValueTags.Num());
+			for (const TPair<FString, TSharedPtr<IDataValue>>& Pair : InTags->ValueTags)
+			{
+				OtherValueTags.Add(Pair.Value->Flatten(Pair.Key));
+			}
+		}
+
+		FWriteScopeLock WriteScopeLock(TagsLock);
+
+		if (RawTags.IsEmpty())
+		{
+			RawTags = MoveTemp(OtherRawTags);
+			RawAtoms = MoveTemp(OtherRawAtoms);
+		}
+		else
+		{
+			RawTags.Append(OtherRawTags);
+			for (const FTagAtom Atom : OtherRawAtoms) { AddAtom(RawAtoms, Atom); }
+		}
+
+		for (const FString& TagString : OtherValueTags)
+		{
+			ParseAndAdd(TagString);
+		}
 	}
 
 	void FTags::Append(const TArray<FString>& InTags)
@@ -65,6 +165,8 @@ namespace PCGExData
 
 		RawTags.Empty();
 		ValueTags.Empty();
+		RawAtoms.Empty();
+		KeyAtoms.Empty();
 	}
 
 	void FTags::Reset(const TSharedPtr<FTags>& InTags)
@@ -183,8 +285,7 @@ namespace PCGExData
 	void FTags::Remove(const FString& Key)
 	{
 		FWriteScopeLock WriteScopeLock(TagsLock);
-		ValueTags.Remove(Key);
-		RawTags.Remove(Key);
+		RemoveUnsafe(Key);
 	}
 
 	void FTags::Remove(const TSet<FString>& InSet)
@@ -192,8 +293,7 @@ namespace PCGExData
 		FWriteScopeLock WriteScopeLock(TagsLock);
 		for (const FString& Tag : InSet)
 		{
-			ValueTags.Remove(Tag);
-			RawTags.Remove(Tag);
+			RemoveUnsafe(Tag);
 		}
 	}
 
@@ -202,9 +302,7 @@ namespace PCGExData
 		FWriteScopeLock WriteScopeLock(TagsLock);
 		for (const FName& Tag : InSet)
 		{
-			FString Key = Tag.ToString();
-			ValueTags.Remove(Key);
-			RawTags.Remove(Key);
+			RemoveUnsafe(Tag.ToString());
 		}
 	}
 
@@ -230,6 +328,72 @@ namespace PCGExData
 		return (ValueTags.Contains(Key) || RawTags.Contains(Key)) ? !bInvert : bInvert;
 	}
 
+	bool FTags::IsTagged(const FTagAtom Atom) const
+	{
+		FReadScopeLock ReadScopeLock(TagsLock);
+		return Algo::BinarySearch(RawAtoms, Atom) != INDEX_NONE || Algo::BinarySearch(KeyAtoms, Atom) != INDEX_NONE;
+	}
+
+	namespace
+	{
+		bool AtomsIntersect(const TArray<FTagAtom>& A, const TArray<FTagAtom>& B)
+		{
+			int32 i = 0;
+			int32 j = 0;
+			while (i < A.Num() && j < B.Num())
+			{
+				if (A[i] == B[j]) { return true; }
+				if (A[i] < B[j]) { i++; }
+				else { j++; }
+			}
+			return false;
+		}
+
+		bool AtomsInclude(const TArray<FTagAtom>& A, const TArray<FTagAtom>& B)
+		{
+			if (B.Num() > A.Num()) { return false; }
+
+			int32 i = 0;
+			for (const FTagAtom Atom : B)
+			{
+				while (i < A.Num() && A[i] < Atom) { i++; }
+				if (i == A.Num() || A[i] != Atom) { return false; }
+			}
+			return true;
+		}
+	}
+
+	bool FTags::SharesAnyTag(const FTags& Other) const
+	{
+		if (&Other == this)
+		{
+			return !IsEmpty();
+		}
+
+		FReadScopeLock ReadScopeLock(TagsLock);
+		FReadScopeLock OtherReadScopeLock(Other.TagsLock);
+		return AtomsIntersect(RawAtoms, Other.RawAtoms) || AtomsIntersect(KeyAtoms, Other.KeyAtoms);
+	}
+
+	bool FTags::HasAllTagsOf(const FTags& Other) const
+	{
+		if (&Other == this)
+		{
+			return true;
+		}
+
+		FReadScopeLock ReadScopeLock(TagsLock);
+		FReadScopeLock OtherReadScopeLock(Other.TagsLock);
+		return AtomsInclude(RawAtoms, Other.RawAtoms) && AtomsInclude(KeyAtoms, Other.KeyAtoms);
+	}
+
+	void FTags::GetAtoms(TArray<FTagAtom>& OutRawAtoms, TArray<FTagAtom>& OutKeyAtoms) const
+	{
+		FReadScopeLock ReadScopeLock(TagsLock);
+		OutRawAtoms = RawAtoms;
+		OutKeyAtoms = KeyAtoms;
+	}
+
 	void FTags::ParseAndAdd(const FString& InTag)
 	{
 		FString InKey = TEXT("");
@@ -237,10 +401,40 @@ namespace PCGExData
 		if (const TSharedPtr<IDataValue> TagValue = TryGetValueFromTag(InTag, InKey))
 		{
 			ValueTags.Add(InKey, TagValue);
+			AddAtom(KeyAtoms, TagAtoms::Intern(InKey));
 			return;
 		}
 
-		RawTags.Add(InTag);
+		bool bAlreadySet = false;
+		RawTags.Add(InTag, &bAlreadySet);
+		if (!bAlreadySet) { AddAtom(RawAtoms, TagAtoms::Intern(InTag)); }
+	}
+
+	void FTags::RemoveUnsafe(const FString& Key)
+	{
+		const bool bHadValue = ValueTags.Remove(Key) > 0;
+		const bool bHadRaw = RawTags.Remove(Key) > 0;
+
+		if (bHadValue || bHadRaw)
+		{
+			// Whatever was there was interned when added
+			const FTagAtom Atom = TagAtoms::Find(Key);
+			if (bHadValue) { RemoveAtom(KeyAtoms, Atom); }
+			if (bHadRaw) { RemoveAtom(RawAtoms, Atom); }
+		}
+	}
+
+	void FTags::AddAtom(TArray<FTagAtom>& InAtoms, const FTagAtom Atom)
+	{
+		const int32 Index = Algo::LowerBound(InAtoms, Atom);
+		if (Index < InAtoms.Num() && InAtoms[Index] == Atom) { return; }
+		InAtoms.Insert(Atom, Index);
+	}
+
+	void FTags::RemoveAtom(TArray<FTagAtom>& InAtoms, const FTagAtom Atom)
+	{
+		const int32 Index = Algo::BinarySearch(InAtoms, Atom);
+		if (Index != INDEX_NONE) { InAtoms.RemoveAt(Index, 1, EAllowShrinking::No); }
 	}
 
 	bool FTags::GetTagFromString(const FString& Input, FString& OutKey, FString& OutValue)
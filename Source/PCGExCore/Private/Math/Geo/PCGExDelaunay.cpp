@@ -7,10 +7,12 @@
 #include "PCGExCoreSettingsCache.h"
 
 #include "PCGExSettingsCacheBody.h"
+#include "Algo/Unique.h"
 #include "Async/ParallelFor.h"
 #include "Core/PCGExMTCommon.h"
 #include "Math/PCGExProjectionDetails.h"
 #include "Math/Geo/PCGExGeo.h"
+#include "Math/Geo/PCGExDelaunayBuilder.h"
 #include "Math/Geo/PCGExPrimtives.h"
 #include "CompGeom/ExactPredicates.h"
 #include "ThirdParty/Delaunator/include/delaunator.hpp"
@@ -69,15 +71,61 @@ namespace PCGExMath::Geo
 		Clear();
 	}
 
+	namespace
+	{
+		void SortUnique(TArray<int32>& InOut)
+		{
+			InOut.Sort();
+			InOut.SetNum(Algo::Unique(InOut));
+		}
+
+		// Remove the (sorted, unique) hashes in Removed from the sorted Edges, in a single merge pass
+		void RemoveSorted(TArray<uint64>& Edges, const TArray<uint64>& Removed)
+		{
+			int32 r = 0;
+			int32 NumKept = 0;
+			for (int32 i = 0; i < Edges.Num(); i++)
+			{
+				const uint64 Edge = Edges[i];
+				while (r < Removed.Num() && Removed[r] < Edge) { r++; }
+				if (r < Removed.Num() && Removed[r] == Edge) { continue; }
+				Edges[NumKept++] = Edge;
+			}
+			Edges.SetNum(NumKept);
+		}
+
+		template <typename T>
+		void GatherLongestEdges(const TArrayView<FVector>& Positions, const TArray<T>& Sites, TArray<uint64>& OutEdges)
+		{
+			OutEdges.SetNumUninitialized(Sites.Num());
+			PCGEX_PARALLEL_FOR(
+				Sites.Num(),
+				GetLongestEdge(Positions, Sites[i].Vtx, OutEdges[i]);
+				)
+
+			Algo::Sort(OutEdges);
+			OutEdges.SetNum(Algo::Unique(OutEdges));
+		}
+	}
+
 	void TDelaunay2::Clear()
 	{
 		Sites.Empty();
+		Edges.Empty();
+		Hull.Empty();
 		DelaunayEdges.Empty();
 		DelaunayHull.Empty();
 
 		IsValid = false;
 	}
 
+	void TDelaunay2::MirrorToSets()
+	{
+		if (!bMirrorToSets) { return; }
+		DelaunayEdges.Append(Edges);
+		DelaunayHull.Append(Hull);
+	}
+
 	bool TDelaunay2::Process(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails, const bool bComputeDelaunayEdges, const bool bComputeHull)
 	{
 		Clear();
@@ -218,11 +266,11 @@ namespace PCGExMath::Geo
 			if (bComputeDelaunayEdges)
 			{
 				// Interior edges are shared by two halfedges, hull edges by one.
-				DelaunayEdges.Reserve(static_cast<int32>((NumHalfedges - NumHullEdges) / 2 + NumHullEdges));
+				Edges.Reserve(static_cast<int32>((NumHalfedges - NumHullEdges) / 2 + NumHullEdges));
 			}
 			if (bComputeHull)
 			{
-				DelaunayHull.Reserve(static_cast<int32>(NumHullEdges));
+				Hull.Reserve(static_cast<int32>(NumHullEdges * 2));
 			}
 
 			// Each undirected edge is visited exactly once: hull halfedges have no twin,
@@ -243,18 +291,22 @@ namespace PCGExMath::Geo
 
 				if (bComputeDelaunayEdges)
 				{
-					DelaunayEdges.Add(PCGEx::H64U(A, B));
+					Edges.Add(PCGEx::H64U(A, B));
 				}
 
 				if (bHullEdge && bComputeHull)
 				{
-					DelaunayHull.Add(A);
-					DelaunayHull.Add(B);
+					Hull.Add(A);
+					Hull.Add(B);
 				}
 			}
+
+			Algo::Sort(Edges);
+			SortUnique(Hull);
 		}
 
 		IsValid = true;
+		MirrorToSets();
 		return IsValid;
 	}
 
@@ -320,42 +372,41 @@ namespace PCGExMath::Geo
 		if (bComputeHull)
 		{
 			// Edges still in EdgeMap were never matched to a second triangle: hull edges.
-			DelaunayHull.Reserve(EdgeMap.Num());
+			Hull.Reserve(EdgeMap.Num() * 2);
 			for (const TPair<uint64, int32>& HullEdge : EdgeMap)
 			{
-				DelaunayHull.Add(static_cast<int32>(PCGEx::H64A(HullEdge.Key)));
-				DelaunayHull.Add(static_cast<int32>(PCGEx::H64B(HullEdge.Key)));
+				Hull.Add(static_cast<int32>(PCGEx::H64A(HullEdge.Key)));
+				Hull.Add(static_cast<int32>(PCGEx::H64B(HullEdge.Key)));
 			}
+			SortUnique(Hull);
 		}
 
 		if (bComputeDelaunayEdges)
 		{
-			DelaunayEdges = MoveTemp(SeenEdges);
+			Edges = SeenEdges.Array();
+			Algo::Sort(Edges);
 		}
 
 		IsValid = true;
+		MirrorToSets();
 		return IsValid;
 	}
 
 	void TDelaunay2::RemoveLongestEdges(const TArrayView<FVector>& Positions)
 	{
-		uint64 Edge;
-		for (const FDelaunaySite2& Site : Sites)
-		{
-			GetLongestEdge(Positions, Site.Vtx, Edge);
-			DelaunayEdges.Remove(Edge);
-		}
+		TArray<uint64> LongestEdges;
+		GatherLongestEdges(Positions, Sites, LongestEdges);
+		RemoveSorted(Edges, LongestEdges);
+		if (bMirrorToSets) { for (const uint64 Edge : LongestEdges) { DelaunayEdges.Remove(Edge); } }
 	}
 
 	void TDelaunay2::RemoveLongestEdges(const TArrayView<FVector>& Positions, TSet<uint64>& LongestEdges)
 	{
-		uint64 Edge;
-		for (const FDelaunaySite2& Site : Sites)
-		{
-			GetLongestEdge(Positions, Site.Vtx, Edge);
-			DelaunayEdges.Remove(Edge);
-			LongestEdges.Add(Edge);
-		}
+		TArray<uint64> Removed;
+		GatherLongestEdges(Positions, Sites, Removed);
+		RemoveSorted(Edges, Removed);
+		if (bMirrorToSets) { for (const uint64 Edge : Removed) { DelaunayEdges.Remove(Edge); } }
+		LongestEdges.Append(Removed);
 	}
 
 	void TDelaunay2::GetMergedSites(const int32 SiteIndex, const TSet<uint64>& EdgeConnectors, TSet<int32>& OutMerged, TSet<uint64>& OutUEdges, TBitArray<>& VisitedSites)
@@ -431,30 +482,131 @@ namespace PCGExMath::Geo
 	void TDelaunay3::Clear()
 	{
 		Sites.Empty();
+		Edges.Empty();
+		Hull.Empty();
+		Neighbors.Empty();
 		DelaunayEdges.Empty();
 		DelaunayHull.Empty();
+		Adjacency.Empty();
 
 		IsValid = false;
 	}
 
-	void TDelaunay3::RemoveLongestEdges(const TArrayView<FVector>& Positions)
+	bool TDelaunay3::ProcessInternal(const TArrayView<FVector>& Positions, const bool bComputeAdjacency, const bool bComputeHull)
 	{
-		uint64 Edge;
-		for (const FDelaunaySite3& Site : Sites)
+		TRACE_CPUPROFILER_EVENT_SCOPE(TDelaunay3::Process);
+
+		Clear();
+
+		const int32 NumPositions = Positions.Num();
+		if (NumPositions <= 3)
+		{
+			return false;
+		}
+
+		FDelaunayBuilder3 Builder;
+
+		if (PCGEX_CORE_SETTINGS.bParallelDelaunay && NumPositions >= PCGEX_CORE_SETTINGS.ParallelDelaunayThreshold)
+		{
+			// Comes out with neighbors already linked
+			if (!Builder.TriangulateParallel(Positions)) { return false; }
+		}
+		else
+		{
+			if (!Builder.Triangulate(Positions)) { return false; }
+			if ((bComputeAdjacency || bComputeHull) && !Builder.LinkNeighbors(NumPositions)) { return false; }
+		}
+
+		IsValid = true;
+
+		const int32 NumSites = Builder.Tets.Num();
+		Sites.SetNumUninitialized(NumSites);
+
+		const bool bNeedsNeighbors = bComputeAdjacency || bComputeHull;
+		if (bNeedsNeighbors) { Neighbors.SetNumUninitialized(NumSites); }
+
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(Delaunay3D::BuildSites);
+
+			PCGEX_PARALLEL_FOR(
+				NumSites,
+				const FIntVector4& Tet = Builder.Tets[i];
+				Sites[i] = FDelaunaySite3(Tet, i);
+				FDelaunaySite3& Site = Sites[i];
+
+				if (!bNeedsNeighbors) { return; }
+
+				// Site vertices are sorted; face f leaves out the vertex at sorted position 3 - f (see MTX)
+				FIntVector4& SiteNeighbors = Neighbors[i];
+				for (int f = 0; f < 4; f++)
+				{
+					const int32 Opposite = Site.Vtx[3 - f];
+					const int32 k = Tet.X == Opposite ? 0 : Tet.Y == Opposite ? 1 : Tet.Z == Opposite ? 2 : 3;
+					SiteNeighbors[f] = Builder.Neighbors[i][k];
+					if (SiteNeighbors[f] == -1) { Site.bOnHull = true; }
+				}
+
+				if (bMirrorToSets) { Site.ComputeFaces(); }
+				)
+		}
+
+		Builder.GetEdges(NumPositions, Edges);
+
+		if (bComputeHull)
+		{
+			for (int32 i = 0; i < NumSites; i++)
+			{
+				if (!Sites[i].bOnHull) { continue; }
+				for (int f = 0; f < 4; f++)
+				{
+					if (Neighbors[i][f] != -1) { continue; }
+					for (int fi = 0; fi < 3; fi++) { Hull.Add(Sites[i].Vtx[MTX[f][fi]]); }
+				}
+			}
+
+			SortUnique(Hull);
+		}
+
+		if (bMirrorToSets)
 		{
-			GetLongestEdge(Positions, Site.Vtx, Edge);
-			DelaunayEdges.Remove(Edge);
+			DelaunayEdges.Append(Edges);
+			DelaunayHull.Append(Hull);
+
+			if (bComputeAdjacency)
+			{
+				// Legacy layout: face hash -> NH64(-1, Site) on the hull, NH64(Later, Earlier) for shared faces
+				Adjacency.Reserve(NumSites * 2 + NumSites / 2);
+				for (int32 i = 0; i < NumSites; i++)
+				{
+					for (int f = 0; f < 4; f++)
+					{
+						const int32 Other = Neighbors[i][f];
+						if (Other == -1) { Adjacency.Add(Sites[i].Faces[f], PCGEx::NH64(-1, i)); }
+						else if (Other < i) { Adjacency.Add(Sites[i].Faces[f], PCGEx::NH64(i, Other)); }
+					}
+				}
+			}
 		}
+
+		if (!bComputeAdjacency) { Neighbors.Empty(); }
+
+		return IsValid;
+	}
+
+	void TDelaunay3::RemoveLongestEdges(const TArrayView<FVector>& Positions)
+	{
+		TArray<uint64> LongestEdges;
+		GatherLongestEdges(Positions, Sites, LongestEdges);
+		RemoveSorted(Edges, LongestEdges);
+		if (bMirrorToSets) { for (const uint64 Edge : LongestEdges) { DelaunayEdges.Remove(Edge); } }
 	}
 
 	void TDelaunay3::RemoveLongestEdges(const TArrayView<FVector>& Positions, TSet<uint64>& LongestEdges)
 	{
-		uint64 Edge;
-		for (const FDelaunaySite3& Site : Sites)
-		{
-			GetLongestEdge(Positions, Site.Vtx, Edge);
-			DelaunayEdges.Remove(Edge);
-			LongestEdges.Add(Edge);
-		}
+		TArray<uint64> Removed;
+		GatherLongestEdges(Positions, Sites, Removed);
+		RemoveSorted(Edges, Removed);
+		if (bMirrorToSets) { for (const uint64 Edge : Removed) { DelaunayEdges.Remove(Edge); } }
+		LongestEdges.Append(Removed);
 	}
 }
@@ -0,0 +1,885 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Math/Geo/PCGExDelaunayBuilder.h"
+
+#include <algorithm>
+#include <atomic>
+
+#include "PCGExH.h"
+#include "Core/PCGExMTCommon.h"
+#include "Math/Geo/PCGExGeo.h"
+#include "Sorting/PCGExSortingHelpers.h"
+#include "CompGeom/Delaunay3.h"
+#include "CompGeom/ExactPredicates.h"
+
+namespace PCGExMath::Geo
+{
+	namespace Builder
+	{
+		void EnsurePredicates()
+		{
+			// Thread-safe no-op after the first call, see TDelaunay2::ProcessDelaunator
+			static const bool bExactPredicatesReady = []()
+			{
+				UE::Geometry::ExactPredicates::GlobalInit();
+				return true;
+			}();
+			(void)bExactPredicatesReady;
+		}
+
+		// Shewchuk conventions: Orient3 > 0 for positively oriented tets, InSphere > 0 when the last point lies strictly inside
+		FORCEINLINE double Orient3(const FVector& A, const FVector& B, const FVector& C, const FVector& D)
+		{
+			return UE::Geometry::ExactPredicates::Orient3D(&A.X, &B.X, &C.X, &D.X);
+		}
+
+		FORCEINLINE double InSphere(const FVector& A, const FVector& B, const FVector& C, const FVector& D, const FVector& E)
+		{
+			return UE::Geometry::ExactPredicates::InSphere(&A.X, &B.X, &C.X, &D.X, &E.X);
+		}
+
+		FORCEINLINE bool OppositeSigns(const double A, const double B)
+		{
+			return (A > 0 && B < 0) || (A < 0 && B > 0);
+		}
+
+		FORCEINLINE int32 IndexOf(const FIntVector4& Tet, const int32 Vtx)
+		{
+			for (int32 i = 0; i < 4; i++) { if (Tet[i] == Vtx) { return i; } }
+			return -1;
+		}
+
+		FORCEINLINE bool Contains(const FIntVector4& Tet, const int32 Vtx)
+		{
+			return Tet.X == Vtx || Tet.Y == Vtx || Tet.Z == Vtx || Tet.W == Vtx;
+		}
+
+		// Sorted vertices of the face opposite vertex K
+		FORCEINLINE FIntVector FaceKey(const FIntVector4& Tet, const int32 K)
+		{
+			int32 V[3];
+			int32 n = 0;
+			for (int32 i = 0; i < 4; i++) { if (i != K) { V[n++] = Tet[i]; } }
+
+			if (V[0] > V[1]) { Swap(V[0], V[1]); }
+			if (V[1] > V[2]) { Swap(V[1], V[2]); }
+			if (V[0] > V[1]) { Swap(V[0], V[1]); }
+
+			return FIntVector(V[0], V[1], V[2]);
+		}
+
+		FORCEINLINE FIntVector4 TetKey(const FIntVector4& Tet)
+		{
+			int32 V[4] = {Tet.X, Tet.Y, Tet.Z, Tet.W};
+			Algo::Sort(V);
+			return FIntVector4(V[0], V[1], V[2], V[3]);
+		}
+
+		FORCEINLINE bool FaceLess(const FIntVector& A, const FIntVector& B)
+		{
+			return A.X != B.X ? A.X < B.X : A.Y != B.Y ? A.Y < B.Y : A.Z < B.Z;
+		}
+
+		FORCEINLINE bool TetLess(const FIntVector4& A, const FIntVector4& B)
+		{
+			return A.X != B.X ? A.X < B.X : A.Y != B.Y ? A.Y < B.Y : A.Z != B.Z ? A.Z < B.Z : A.W < B.W;
+		}
+
+		// Skilling, "Programming the Hilbert curve": 16-bit axes to a 48-bit Hilbert index
+		FORCEINLINE uint64 HilbertKey(const uint32 X, const uint32 Y, const uint32 Z)
+		{
+			constexpr int32 Bits = 16;
+			uint32 V[3] = {X, Y, Z};
+
+			for (uint32 Q = 1u << (Bits - 1); Q > 1; Q >>= 1)
+			{
+				const uint32 P = Q - 1;
+				for (int32 i = 0; i < 3; i++)
+				{
+					if (V[i] & Q)
+					{
+						V[0] ^= P;
+					}
+					else
+					{
+						const uint32 T = (V[0] ^ V[i]) & P;
+						V[0] ^= T;
+						V[i] ^= T;
+					}
+				}
+			}
+
+			V[1] ^= V[0];
+			V[2] ^= V[1];
+
+			uint32 T = 0;
+			for (uint32 Q = 1u << (Bits - 1); Q > 1; Q >>= 1) { if (V[2] & Q) { T ^= Q - 1; } }
+			for (int32 i = 0; i < 3; i++) { V[i] ^= T; }
+
+			uint64 Key = 0;
+			for (int32 b = Bits - 1; b >= 0; b--)
+			{
+				for (int32 i = 0; i < 3; i++) { Key = Key << 1 | ((V[i] >> b) & 1); }
+			}
+
+			return Key;
+		}
+
+		// Make every tet positively oriented. Returns false if any of them is flat.
+		bool Orient(const TArrayView<FVector>& Positions, TArray<FIntVector4>& InOutTets)
+		{
+			std::atomic<bool> bFlat{false};
+			PCGExMT::ParallelOrSequential(
+				InOutTets.Num(),
+				[&](const int32 t)
+				{
+					FIntVector4& Tet = InOutTets[t];
+					const double O = Orient3(Positions[Tet.X], Positions[Tet.Y], Positions[Tet.Z], Positions[Tet.W]);
+					if (O < 0) { Swap(Tet.X, Tet.Y); }
+					else if (O == 0) { bFlat.store(true, std::memory_order_relaxed); }
+				});
+
+			return !bFlat.load();
+		}
+
+		void LinkNeighbors(const int32 NumVertices, const TArray<FIntVector4>& InTets, TArray<FIntVector4>& OutNeighbors, bool& bOutManifold)
+		{
+			const int32 NumTets = InTets.Num();
+			OutNeighbors.SetNumUninitialized(NumTets);
+
+			// Vertex -> incident tets, in ascending tet order
+			TArray<int32> Start;
+			Start.SetNumZeroed(NumVertices + 1);
+			for (const FIntVector4& Tet : InTets)
+			{
+				if (Tet.X == -1) { continue; }
+				for (int32 k = 0; k < 4; k++) { Start[Tet[k] + 1]++; }
+			}
+
+			for (int32 v = 0; v < NumVertices; v++) { Start[v + 1] += Start[v]; }
+
+			TArray<int32> Incident;
+			Incident.SetNumUninitialized(Start[NumVertices]);
+
+			{
+				TArray<int32> Cursor(Start.GetData(), NumVertices);
+				for (int32 t = 0; t < NumTets; t++)
+				{
+					const FIntVector4& Tet = InTets[t];
+					if (Tet.X == -1) { continue; }
+					for (int32 k = 0; k < 4; k++) { Incident[Cursor[Tet[k]]++] = t; }
+				}
+			}
+
+			// A face's other tet is incident to all three of its vertices: scan the shortest of the three lists
+			std::atomic<bool> bManifold{true};
+			PCGExMT::ParallelOrSequential(
+				NumTets,
+				[&](const int32 t)
+				{
+					const FIntVector4& Tet = InTets[t];
+					FIntVector4& Out = OutNeighbors[t];
+					Out = FIntVector4(-1);
+
+					if (Tet.X == -1) { return; }
+
+					for (int32 k = 0; k < 4; k++)
+					{
+						const int32 A = Tet[(k + 1) % 4];
+						const int32 B = Tet[(k + 2) % 4];
+						const int32 C = Tet[(k + 3) % 4];
+
+						int32 V = A;
+						if (Start[B + 1] - Start[B] < Start[V + 1] - Start[V]) { V = B; }
+						if (Start[C + 1] - Start[C] < Start[V + 1] - Start[V]) { V = C; }
+
+						int32 NumFound = 0;
+						for (int32 j = Start[V]; j < Start[V + 1]; j++)
+						{
+							const int32 u = Incident[j];
+							if (u == t) { continue; }
+
+							const FIntVector4& Other = InTets[u];
+							if (Contains(Other, A) && Contains(Other, B) && Contains(Other, C))
+							{
+								if (!NumFound++) { Out[k] = u; }
+							}
+						}
+
+						if (NumFound > 1) { bManifold.store(false, std::memory_order_relaxed); }
+					}
+				});
+
+			bOutManifold = bManifold.load();
+		}
+
+		bool IsLocallyDelaunay(const TArrayView<FVector>& Positions, const TArray<FIntVector4>& InTets, const TArray<FIntVector4>& InNeighbors)
+		{
+			std::atomic<bool> bDelaunay{true};
+			PCGExMT::ParallelOrSequential(
+				InTets.Num(),
+				[&](const int32 t)
+				{
+					if (!bDelaunay.load(std::memory_order_relaxed)) { return; }
+
+					const FIntVector4& Tet = InTets[t];
+					for (int32 k = 0; k < 4; k++)
+					{
+						// Each interior face is checked once, from its lower tet
+						const int32 u = InNeighbors[t][k];
+						if (u < t) { continue; }
+
+						// Links must be mutual, the two apexes on either side of the shared face,
+						// and the far apex must not be inside the circumsphere
+						const int32 Back = IndexOf(InNeighbors[u], t);
+						if (Back == -1)
+						{
+							bDelaunay.store(false, std::memory_order_relaxed);
+							return;
+						}
+
+						const FVector& Apex = Positions[InTets[u][Back]];
+						const FVector& A = Positions[Tet[(k + 1) % 4]];
+						const FVector& B = Positions[Tet[(k + 2) % 4]];
+						const FVector& C = Positions[Tet[(k + 3) % 4]];
+
+						if (!OppositeSigns(Orient3(A, B, C, Positions[Tet[k]]), Orient3(A, B, C, Apex)) ||
+							InSphere(Positions[Tet.X], Positions[Tet.Y], Positions[Tet.Z], Positions[Tet.W], Apex) > 0)
+						{
+							bDelaunay.store(false, std::memory_order_relaxed);
+							return;
+						}
+					}
+				});
+
+			return bDelaunay.load();
+		}
+
+		// A kd-tree leaf: a contiguous range of the partitioned order, and the half-open cell it covers.
+		// Cells are unbounded on the outside of the point set.
+		struct FBlock
+		{
+			int32 Start = 0;
+			int32 End = 0;
+			FVector CellMin = FVector(-TNumericLimits<double>::Max());
+			FVector CellMax = FVector(TNumericLimits<double>::Max());
+
+			TArray<FIntVector4> Kept;          // Tets certified as global Delaunay tets
+			TArray<FIntVector4> Open;          // Sorted vertices of the other tets
+			TArray<FIntVector> KeptBoundary;   // Sorted faces between kept tets and the rest, sorted
+			bool bValid = true;
+		};
+	}
+
+	void ComputeInsertionOrder(const TArrayView<FVector>& Positions, TArray<int32>& OutOrder, const int32 Seed)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExMath::Geo::ComputeInsertionOrder);
+
+		const int32 NumPoints = Positions.Num();
+		OutOrder.SetNumUninitialized(NumPoints);
+		if (!NumPoints) { return; }
+
+		FBox Bounds(ForceInit);
+		for (const FVector& P : Positions) { Bounds += P; }
+
+		// Uniform scale so the curve doesn't get stretched along flat inputs
+		const double Scale = 65535.0 / FMath::Max(Bounds.GetSize().GetMax(), UE_SMALL_NUMBER);
+
+		for (int32 i = 0; i < NumPoints; i++) { OutOrder[i] = i; }
+
+		FRandomStream Random(Seed);
+		for (int32 i = NumPoints - 1; i > 0; i--) { Swap(OutOrder[i], OutOrder[Random.RandRange(0, i)]); }
+
+		// The j-th point of the shuffled order goes into round FloorLog2(j + 1): rounds of 1, 2, 4, 8... points
+		TArray<PCGEx::FIndexKey> Keys;
+		Keys.SetNumUninitialized(NumPoints);
+
+		PCGEX_PARALLEL_FOR(
+			NumPoints,
+			const int32 Index = OutOrder[i];
+			const FVector L = (Positions[Index] - Bounds.Min) * Scale;
+			const uint64 Round = FMath::FloorLog2(static_cast<uint32>(i) + 1);
+			Keys[i] = PCGEx::FIndexKey(Index, Round << 48 | Builder::HilbertKey(
+				static_cast<uint32>(FMath::Clamp(L.X, 0.0, 65535.0)),
+				static_cast<uint32>(FMath::Clamp(L.Y, 0.0, 65535.0)),
+				static_cast<uint32>(FMath::Clamp(L.Z, 0.0, 65535.0))));
+			)
+
+		PCGExSortingHelpers::RadixSort(Keys);
+
+		for (int32 i = 0; i < NumPoints; i++) { OutOrder[i] = Keys[i].Index; }
+	}
+
+	void BuildSortedEdges(const int32 NumVertices, const int32 NumElements, const int32 VerticesPerElement, TFunctionRef<int32(int32, int32)> Vertex, TArray<uint64>& OutEdges)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExMath::Geo::BuildSortedEdges);
+
+		check(VerticesPerElement <= 4);
+
+		OutEdges.Reset();
+		if (!NumVertices || !NumElements) { return; }
+
+		// Bucket every element edge under its higher vertex, storing the lower one
+		TArray<int32> Start;
+		Start.SetNumZeroed(NumVertices + 1);
+
+		int32 V[4];
+		for (int32 e = 0; e < NumElements; e++)
+		{
+			for (int32 a = 0; a < VerticesPerElement; a++) { V[a] = Vertex(e, a); }
+			for (int32 a = 0; a < VerticesPerElement; a++)
+			{
+				for (int32 b = a + 1; b < VerticesPerElement; b++) { Start[FMath::Max(V[a], V[b]) + 1]++; }
+			}
+		}
+
+		for (int32 v = 0; v < NumVertices; v++) { Start[v + 1] += Start[v]; }
+
+		TArray<int32> Lower;
+		Lower.SetNumUninitialized(Start[NumVertices]);
+
+		{
+			TArray<int32> Cursor(Start.GetData(), NumVertices);
+			for (int32 e = 0; e < NumElements; e++)
+			{
+				for (int32 a = 0; a < VerticesPerElement; a++) { V[a] = Vertex(e, a); }
+				for (int32 a = 0; a < VerticesPerElement; a++)
+				{
+					for (int32 b = a + 1; b < VerticesPerElement; b++)
+					{
+						Lower[Cursor[FMath::Max(V[a], V[b])]++] = FMath::Min(V[a], V[b]);
+					}
+				}
+			}
+		}
+
+		// Sort & dedup each bucket in place; buckets are tiny
+		TArray<int32> Offsets;
+		Offsets.SetNumUninitialized(NumVertices + 1);
+
+		PCGEX_PARALLEL_FOR(
+			NumVertices,
+			int32* Bucket = Lower.GetData() + Start[i];
+			const int32 Num = Start[i + 1] - Start[i];
+			Algo::Sort(MakeArrayView(Bucket, Num));
+			int32 NumUnique = 0;
+			for (int32 j = 0; j < Num; j++) { if (!NumUnique || Bucket[NumUnique - 1] != Bucket[j]) { Bucket[NumUnique++] = Bucket[j]; } }
+			Offsets[i + 1] = NumUnique;
+			)
+
+		Offsets[0] = 0;
+		for (int32 v = 0; v < NumVertices; v++) { Offsets[v + 1] += Offsets[v]; }
+
+		// H64U puts the higher vertex in the upper bits: bucket order is hash order
+		OutEdges.SetNumUninitialized(Offsets[NumVertices]);
+		PCGEX_PARALLEL_FOR(
+			NumVertices,
+			const int32* Bucket = Lower.GetData() + Start[i];
+			uint64* Out = OutEdges.GetData() + Offsets[i];
+			const int32 Num = Offsets[i + 1] - Offsets[i];
+			for (int32 j = 0; j < Num; j++) { Out[j] = PCGEx::H64U(i, Bucket[j]); }
+			)
+	}
+
+#pragma region FDelaunayBuilder3
+
+	bool FDelaunayBuilder3::Triangulate(const TArrayView<FVector>& Positions)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FDelaunayBuilder3::Triangulate);
+
+		Tets.Reset();
+		Neighbors.Reset();
+
+		if (Positions.Num() <= 3)
+		{
+			return false;
+		}
+
+		Builder::EnsurePredicates();
+
+		{
+			UE::Geometry::FDelaunay3 Tetrahedralization;
+			if (!Tetrahedralization.Triangulate(Positions))
+			{
+				return false;
+			}
+
+			Tets = Tetrahedralization.GetTetrahedra();
+		}
+
+		Builder::Orient(Positions, Tets);
+		return !Tets.IsEmpty();
+	}
+
+	bool FDelaunayBuilder3::TriangulateParallel(const TArrayView<FVector>& Positions, const int32 InMinBlockSize)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FDelaunayBuilder3::TriangulateParallel);
+
+		Tets.Reset();
+		Neighbors.Reset();
+		bUsedFallback = false;
+
+		const int32 NumPoints = Positions.Num();
+		const int32 NumLevels = FMath::Min(FMath::FloorLog2(static_cast<uint32>(NumPoints / FMath::Max(InMinBlockSize, 64))), 4);
+
+		auto Fallback = [&]()
+		{
+			bUsedFallback = true;
+			return Triangulate(Positions);
+		};
+
+		if (NumLevels < 1)
+		{
+			return Fallback();
+		}
+
+		Builder::EnsurePredicates();
+
+		// Partition: median splits along the longest axis. Block count only depends on the point count,
+		// so the result is the same whatever the number of workers.
+		TArray<int32> Order;
+		Order.SetNumUninitialized(NumPoints);
+		for (int32 i = 0; i < NumPoints; i++) { Order[i] = i; }
+
+		TArray<Builder::FBlock> Blocks;
+		Blocks.SetNum(1);
+		Blocks[0].End = NumPoints;
+
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(FDelaunayBuilder3::Partition);
+
+			for (int32 Level = 0; Level < NumLevels; Level++)
+			{
+				TArray<Builder::FBlock> Split;
+				Split.Reserve(Blocks.Num() * 2);
+
+				for (const Builder::FBlock& Block : Blocks)
+				{
+					FBox Bounds(ForceInit);
+					for (int32 i = Block.Start; i < Block.End; i++) { Bounds += Positions[Order[i]]; }
+
+					const FVector Size = Bounds.GetSize();
+					const int32 Axis = Size.X >= Size.Y && Size.X >= Size.Z ? 0 : Size.Y >= Size.Z ? 1 : 2;
+					const int32 Mid = (Block.Start + Block.End) / 2;
+
+					std::nth_element(
+						Order.GetData() + Block.Start, Order.GetData() + Mid, Order.GetData() + Block.End,
+						[&](const int32 A, const int32 B)
+						{
+							const double CA = Positions[A][Axis];
+							const double CB = Positions[B][Axis];
+							return CA < CB || (CA == CB && A < B);
+						});
+
+					const double Plane = Positions[Order[Mid]][Axis];
+
+					Builder::FBlock& Left = Split.Add_GetRef(Block);
+					Left.End = Mid;
+					Left.CellMax[Axis] = Plane;
+
+					Builder::FBlock& Right = Split.Add_GetRef(Block);
+					Right.Start = Mid;
+					Right.CellMin[Axis] = Plane;
+				}
+
+				Blocks = MoveTemp(Split);
+			}
+		}
+
+		const int32 NumBlocks = Blocks.Num();
+		TArray<int32> VtxBlock;
+		VtxBlock.SetNumUninitialized(NumPoints);
+		for (int32 b = 0; b < NumBlocks; b++)
+		{
+			for (int32 i = Blocks[b].Start; i < Blocks[b].End; i++) { VtxBlock[Order[i]] = b; }
+		}
+
+		// Vertices whose neighborhood isn't settled by kept tets alone, triangulated again as a whole afterward.
+		// Blocks only ever write their own vertices.
+		TArray<int8> Border;
+		Border.Init(0, NumPoints);
+
+		const double Tolerance = 1e-9 * FMath::Max(1.0, FBox(Positions.GetData(), NumPoints).GetSize().GetMax());
+
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(FDelaunayBuilder3::TriangulateBlocks);
+
+			PCGExMT::ParallelOrSequential(
+				NumBlocks,
+				[&](const int32 b)
+				{
+					Builder::FBlock& Block = Blocks[b];
+					const int32 Num = Block.End - Block.Start;
+
+					TArray<FVector> LocalPositions;
+					LocalPositions.SetNumUninitialized(Num);
+					for (int32 i = 0; i < Num; i++) { LocalPositions[i] = Positions[Order[Block.Start + i]]; }
+
+					TArray<int32> Insertion;
+					ComputeInsertionOrder(LocalPositions, Insertion, b);
+
+					TArray<int32> ToGlobal;
+					ToGlobal.SetNumUninitialized(Num);
+					for (int32 i = 0; i < Num; i++)
+					{
+						ToGlobal[i] = Order[Block.Start + Insertion[i]];
+						LocalPositions[i] = Positions[ToGlobal[i]];
+					}
+
+					TArray<FIntVector4> LocalTets;
+					{
+						UE::Geometry::FDelaunay3 Tetrahedralization;
+						if (!Tetrahedralization.Triangulate(LocalPositions))
+						{
+							Block.bValid = false;
+							return;
+						}
+						LocalTets = Tetrahedralization.GetTetrahedra();
+					}
+
+					const int32 NumLocalTets = LocalTets.Num();
+					TArray<FIntVector4> LocalNeighbors;
+					bool bManifold = true;
+					Builder::LinkNeighbors(Num, LocalTets, LocalNeighbors, bManifold);
+
+					if (!bManifold)
+					{
+						Block.bValid = false;
+						return;
+					}
+
+					// A tet whose circumsphere fits strictly inside this block's cell can't have
+					// a point from any other block inside it: it's a tet of the global triangulation.
+					TBitArray<> Kept(false, NumLocalTets);
+					TBitArray<> Used(false, Num);
+
+					for (int32 t = 0; t < NumLocalTets; t++)
+					{
+						FIntVector4& Tet = LocalTets[t];
+						for (int32 k = 0; k < 4; k++) { Used[Tet[k]] = true; }
+
+						const double O = Builder::Orient3(LocalPositions[Tet.X], LocalPositions[Tet.Y], LocalPositions[Tet.Z], LocalPositions[Tet.W]);
+						if (O < 0)
+						{
+							Swap(Tet.X, Tet.Y);
+							Swap(LocalNeighbors[t].X, LocalNeighbors[t].Y);
+						}
+						else if (O == 0)
+						{
+							continue;
+						}
+
+						FSphere Sphere;
+						if (!FindSphereFrom4Points(LocalPositions[Tet.X], LocalPositions[Tet.Y], LocalPositions[Tet.Z], LocalPositions[Tet.W], Sphere))
+						{
+							continue;
+						}
+
+						const double Reach = Sphere.W * (1 + 1e-6) + Tolerance;
+						Kept[t] =
+							Sphere.Center.X - Reach > Block.CellMin.X && Sphere.Center.X + Reach < Block.CellMax.X &&
+							Sphere.Center.Y - Reach > Block.CellMin.Y && Sphere.Center.Y + Reach < Block.CellMax.Y &&
+							Sphere.Center.Z - Reach > Block.CellMin.Z && Sphere.Center.Z + Reach < Block.CellMax.Z;
+					}
+
+					auto ToGlobalTet = [&](const FIntVector4& Tet)
+					{
+						return FIntVector4(ToGlobal[Tet.X], ToGlobal[Tet.Y], ToGlobal[Tet.Z], ToGlobal[Tet.W]);
+					};
+
+					for (int32 t = 0; t < NumLocalTets; t++)
+					{
+						const FIntVector4& Tet = LocalTets[t];
+
+						if (!Kept[t])
+						{
+							for (int32 k = 0; k < 4; k++) { Border[ToGlobal[Tet[k]]] = 1; }
+							Block.Open.Add(Builder::TetKey(ToGlobalTet(Tet)));
+							continue;
+						}
+
+						const FIntVector4 GlobalTet = ToGlobalTet(Tet);
+						Block.Kept.Add(GlobalTet);
+
+						for (int32 k = 0; k < 4; k++)
+						{
+							const int32 u = LocalNeighbors[t][k];
+							if (u == -1)
+							{
+								// Local hull: whatever lies beyond comes from other blocks
+								for (int32 j = 1; j < 4; j++) { Border[GlobalTet[(k + j) % 4]] = 1; }
+							}
+
+							if (u == -1 || !Kept[u]) { Block.KeptBoundary.Add(Builder::FaceKey(GlobalTet, k)); }
+						}
+					}
+
+					// Vertices dropped by the triangulation (duplicates) get another chance with the border pass
+					for (int32 i = 0; i < Num; i++) { if (!Used[i]) { Border[ToGlobal[i]] = 1; } }
+
+					Block.KeptBoundary.Sort([](const FIntVector& A, const FIntVector& B) { return Builder::FaceLess(A, B); });
+				}, 2);
+		}
+
+		for (const Builder::FBlock& Block : Blocks)
+		{
+			if (!Block.bValid) { return Fallback(); }
+		}
+
+		// Border pass: every global tet that wasn't kept has all of its vertices in the border set,
+		// and being Delaunay for all points it's also Delaunay for that subset.
+		TArray<int32> BorderVertices;
+		BorderVertices.Reserve(NumPoints / 4);
+		for (int32 i = 0; i < NumPoints; i++) { if (Border[i]) { BorderVertices.Add(i); } }
+
+		// Past this point the border pass costs about as much as doing it all serially
+		if (BorderVertices.Num() > NumPoints / 2 || BorderVertices.Num() <= 3)
+		{
+			return Fallback();
+		}
+
+		const int32 NumBorder = BorderVertices.Num();
+		TArray<FIntVector4> BorderTets;
+		TArray<FIntVector4> BorderNeighbors;
+		TBitArray<> BorderUsed(false, NumPoints);
+
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(FDelaunayBuilder3::TriangulateBorder);
+
+			TArray<FVector> BorderPositions;
+			BorderPositions.SetNumUninitialized(NumBorder);
+			for (int32 i = 0; i < NumBorder; i++) { BorderPositions[i] = Positions[BorderVertices[i]]; }
+
+			TArray<int32> Insertion;
+			ComputeInsertionOrder(BorderPositions, Insertion, NumBlocks);
+
+			TArray<int32> ToGlobal;
+			ToGlobal.SetNumUninitialized(NumBorder);
+			for (int32 i = 0; i < NumBorder; i++)
+			{
+				ToGlobal[i] = BorderVertices[Insertion[i]];
+				BorderPositions[i] = Positions[ToGlobal[i]];
+			}
+
+			{
+				UE::Geometry::FDelaunay3 Tetrahedralization;
+				if (!Tetrahedralization.Triangulate(BorderPositions))
+				{
+					return Fallback();
+				}
+				BorderTets = Tetrahedralization.GetTetrahedra();
+			}
+
+			bool bManifold = true;
+			Builder::LinkNeighbors(NumBorder, BorderTets, BorderNeighbors, bManifold);
+			if (!bManifold)
+			{
+				return Fallback();
+			}
+
+			for (FIntVector4& Tet : BorderTets)
+			{
+				Tet = FIntVector4(ToGlobal[Tet.X], ToGlobal[Tet.Y], ToGlobal[Tet.Z], ToGlobal[Tet.W]);
+				for (int32 k = 0; k < 4; k++) { BorderUsed[Tet[k]] = true; }
+			}
+		}
+
+		// Stitch: border tets are either global tets that weren't kept, or fill space already covered by kept tets.
+		// Flood from tets that are surely of the first kind -- spanning several blocks, or matching a tet a block
+		// didn't keep -- and never cross a face bounding kept tets.
+		TBitArray<> Selected(false, BorderTets.Num());
+
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(FDelaunayBuilder3::Stitch);
+
+			TArray<FIntVector4> OpenTets;
+			for (const Builder::FBlock& Block : Blocks) { OpenTets.Append(Block.Open); }
+			OpenTets.Sort([](const FIntVector4& A, const FIntVector4& B) { return Builder::TetLess(A, B); });
+
+			auto IsKeptBoundary = [&](const FIntVector4& Tet, const int32 K)
+			{
+				const FIntVector Face = Builder::FaceKey(Tet, K);
+				const int32 b = VtxBlock[Face.X];
+				if (VtxBlock[Face.Y] != b || VtxBlock[Face.Z] != b) { return false; }
+				return Algo::BinarySearch(Blocks[b].KeptBoundary, Face, [](const FIntVector& A, const FIntVector& B) { return Builder::FaceLess(A, B); }) != INDEX_NONE;
+			};
+
+			TArray<int32> Stack;
+			for (int32 t = 0; t < BorderTets.Num(); t++)
+			{
+				const FIntVector4& Tet = BorderTets[t];
+				const int32 b = VtxBlock[Tet.X];
+				const bool bSpanning = VtxBlock[Tet.Y] != b || VtxBlock[Tet.Z] != b || VtxBlock[Tet.W] != b;
+
+				if (bSpanning ||
+					Algo::BinarySearch(OpenTets, Builder::TetKey(Tet), [](const FIntVector4& A, const FIntVector4& B) { return Builder::TetLess(A, B); }) != INDEX_NONE)
+				{
+					Selected[t] = true;
+					Stack.Add(t);
+				}
+			}
+
+			while (!Stack.IsEmpty())
+			{
+				const int32 t = Stack.Pop(EAllowShrinking::No);
+				for (int32 k = 0; k < 4; k++)
+				{
+					const int32 u = BorderNeighbors[t][k];
+					if (u == -1 || Selected[u] || IsKeptBoundary(BorderTets[t], k)) { continue; }
+
+					Selected[u] = true;
+					Stack.Add(u);
+				}
+			}
+		}
+
+		for (Builder::FBlock& Block : Blocks)
+		{
+			Tets.Append(Block.Kept);
+			Block.Kept.Empty();
+		}
+
+		for (TConstSetBitIterator<> It(Selected); It; ++It) { Tets.Add(BorderTets[It.GetIndex()]); }
+
+		// A vertex the border pass placed must appear in the merged mesh too
+		TBitArray<> Used(false, NumPoints);
+		for (const FIntVector4& Tet : Tets) { for (int32 k = 0; k < 4; k++) { Used[Tet[k]] = true; } }
+		for (TConstSetBitIterator<> It(BorderUsed); It; ++It)
+		{
+			if (!Used[It.GetIndex()]) { return Fallback(); }
+		}
+
+		if (!Builder::Orient(Positions, Tets) || !LinkNeighbors(NumPoints) || !IsValidDelaunay(Positions))
+		{
+			return Fallback();
+		}
+
+		return true;
+	}
+
+	bool FDelaunayBuilder3::LinkNeighbors(const int32 NumVertices)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FDelaunayBuilder3::LinkNeighbors);
+
+		bool bManifold = true;
+		Builder::LinkNeighbors(NumVertices, Tets, Neighbors, bManifold);
+		return bManifold;
+	}
+
+	void FDelaunayBuilder3::GetEdges(const int32 NumVertices, TArray<uint64>& OutEdges) const
+	{
+		BuildSortedEdges(NumVertices, Tets.Num(), 4, [&](const int32 e, const int32 k) { return Tets[e][k]; }, OutEdges);
+	}
+
+	bool FDelaunayBuilder3::IsValidDelaunay(const TArrayView<FVector>& Positions) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FDelaunayBuilder3::IsValidDelaunay);
+
+		// Positively oriented tets glued face to face, each interior face shared by tets on either side,
+		// bounded by a single convex surface: a triangulation of the convex hull.
+		// Locally Delaunay everywhere on top of that: the Delaunay triangulation.
+		return IsHullConvex(Positions, Tets, Neighbors, true) && Builder::IsLocallyDelaunay(Positions, Tets, Neighbors);
+	}
+
+	bool FDelaunayBuilder3::IsHullConvex(const TArrayView<FVector>& Positions, const TArray<FIntVector4>& InTets, const TArray<FIntVector4>& InNeighbors, const bool bRequireConnected)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FDelaunayBuilder3::IsHullConvex);
+
+		// Union-find over hull faces (Tet * 4 + opposite vertex), only used to count surface components
+		TMap<int32, int32> Parents;
+		auto Find = [&](int32 X)
+		{
+			while (true)
+			{
+				const int32* P = Parents.Find(X);
+				if (!P || *P == X) { return X; }
+				X = *P;
+			}
+		};
+
+		// For each hull edge, turn around it through the tets until reaching the other hull face,
+		// whose apex must not sit outside this face's plane.
+		for (int32 t = 0; t < InTets.Num(); t++)
+		{
+			const FIntVector4& Tet = InTets[t];
+			if (Tet.X == -1) { continue; }
+
+			for (int32 k = 0; k < 4; k++)
+			{
+				if (InNeighbors[t][k] != -1) { continue; }
+
+				int32 F[3];
+				int32 n = 0;
+				for (int32 i = 0; i < 4; i++) { if (i != k) { F[n++] = Tet[i]; } }
+
+				const int32 D = Tet[k];
+				const double InnerSide = Builder::Orient3(Positions[F[0]], Positions[F[1]], Positions[F[2]], Positions[D]);
+
+				for (int32 e = 0; e < 3; e++)
+				{
+					const int32 A = F[e];
+					const int32 B = F[(e + 1) % 3];
+
+					int32 Current = t;
+					int32 X = F[(e + 2) % 3]; // Vertex of the face we came through
+					int32 Y = D;              // Vertex of the face we leave through
+					bool bReachedHull = false;
+
+					for (int32 Step = 0; Step < 256; Step++)
+					{
+						const int32 Next = InNeighbors[Current][Builder::IndexOf(InTets[Current], X)];
+						if (Next == -1)
+						{
+							bReachedHull = true;
+							break;
+						}
+
+						const FIntVector4& NextTet = InTets[Next];
+						int32 Z = -1;
+						for (int32 i = 0; i < 4; i++)
+						{
+							const int32 V = NextTet[i];
+							if (V != A && V != B && V != Y) { Z = V; }
+						}
+
+						X = Y;
+						Y = Z;
+						Current = Next;
+					}
+
+					if (!bReachedHull) { return false; }
+
+					const double ApexSide = Builder::Orient3(Positions[F[0]], Positions[F[1]], Positions[F[2]], Positions[Y]);
+					if (Builder::OppositeSigns(InnerSide, ApexSide)) { return false; }
+
+					if (bRequireConnected)
+					{
+						const int32 RootA = Find(t * 4 + k);
+						const int32 RootB = Find(Current * 4 + Builder::IndexOf(InTets[Current], X));
+						if (RootA != RootB) { Parents.Add(FMath::Max(RootA, RootB), FMath::Min(RootA, RootB)); }
+					}
+				}
+			}
+		}
+
+		if (bRequireConnected)
+		{
+			int32 NumComponents = 0;
+			for (int32 t = 0; t < InTets.Num(); t++)
+			{
+				if (InTets[t].X == -1) { continue; }
+				for (int32 k = 0; k < 4; k++)
+				{
+					if (InNeighbors[t][k] == -1 && Find(t * 4 + k) == t * 4 + k) { NumComponents++; }
+				}
+			}
+
+			return NumComponents == 1;
+		}
+
+		return true;
+	}
+
+#pragma endregion
+}
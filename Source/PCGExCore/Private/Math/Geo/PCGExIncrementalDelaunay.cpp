@@ -0,0 +1,664 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Math/Geo/PCGExIncrementalDelaunay.h"
+
+#include <atomic>
+
+#include "PCGExH.h"
+#include "Core/PCGExMTCommon.h"
+#include "Math/PCGExProjectionDetails.h"
+#include "Math/Geo/PCGExDelaunay.h"
+#include "Math/Geo/PCGExDelaunayBuilder.h"
+#include "CompGeom/Delaunay3.h"
+#include "CompGeom/ExactPredicates.h"
+
+namespace PCGExMath::Geo
+{
+	namespace Incremental
+	{
+		void EnsurePredicates()
+		{
+			// Thread-safe no-op after the first call, see TDelaunay2::ProcessDelaunator
+			static const bool bExactPredicatesReady = []()
+			{
+				UE::Geometry::ExactPredicates::GlobalInit();
+				return true;
+			}();
+			(void)bExactPredicatesReady;
+		}
+
+		// Exact predicates, Shewchuk conventions: positive orientation means counter-clockwise (2D) / Orient3 > 0 (3D),
+		// and InCircle/InSphere are positive when the last point lies strictly inside.
+
+		FORCEINLINE double Orient2(const FVector2D& A, const FVector2D& B, const FVector2D& C)
+		{
+			return UE::Geometry::ExactPredicates::Orient2D(&A.X, &B.X, &C.X);
+		}
+
+		FORCEINLINE double InCircle(const FVector2D& A, const FVector2D& B, const FVector2D& C, const FVector2D& D)
+		{
+			return UE::Geometry::ExactPredicates::InCircle(&A.X, &B.X, &C.X, &D.X);
+		}
+
+		FORCEINLINE double Orient3(const FVector& A, const FVector& B, const FVector& C, const FVector& D)
+		{
+			return UE::Geometry::ExactPredicates::Orient3D(&A.X, &B.X, &C.X, &D.X);
+		}
+
+		FORCEINLINE double InSphere(const FVector& A, const FVector& B, const FVector& C, const FVector& D, const FVector& E)
+		{
+			return UE::Geometry::ExactPredicates::InSphere(&A.X, &B.X, &C.X, &D.X, &E.X);
+		}
+
+		FORCEINLINE bool OppositeSigns(const double A, const double B)
+		{
+			return (A > 0 && B < 0) || (A < 0 && B > 0);
+		}
+
+		template <typename T>
+		FORCEINLINE int32 IndexOf(const T& Element, const int32 Vtx, const int32 Num)
+		{
+			for (int32 i = 0; i < Num; i++) { if (Element[i] == Vtx) { return i; } }
+			return -1;
+		}
+
+		// Sorted vertices of the face opposite vertex K
+		FORCEINLINE FIntVector FaceKey(const FIntVector4& Tet, const int32 K)
+		{
+			int32 V[3];
+			int32 n = 0;
+			for (int32 i = 0; i < 4; i++) { if (i != K) { V[n++] = Tet[i]; } }
+
+			if (V[0] > V[1]) { Swap(V[0], V[1]); }
+			if (V[1] > V[2]) { Swap(V[1], V[2]); }
+			if (V[0] > V[1]) { Swap(V[0], V[1]); }
+
+			return FIntVector(V[0], V[1], V[2]);
+		}
+	}
+
+#pragma region FIncrementalDelaunay2
+
+	bool FIncrementalDelaunay2::Build(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FIncrementalDelaunay2::Build);
+
+		Incremental::EnsurePredicates();
+
+		NumRebuilds++;
+		bCanRepair = false;
+		Triangles.Reset();
+		Neighbors.Reset();
+
+		TDelaunay2 Delaunay;
+		if (!Delaunay.Process(Positions, ProjectionDetails, false, false))
+		{
+			return false;
+		}
+
+		ProjectionDetails.Project(Positions, Projected);
+
+		const int32 NumTriangles = Delaunay.Sites.Num();
+		Triangles.SetNumUninitialized(NumTriangles);
+		Neighbors.Init(FIntVector3(-1), NumTriangles);
+
+		bool bDegenerate = false;
+		TBitArray<> Used(false, Positions.Num());
+
+		TMap<uint64, int32> HalfEdges; // Directed edge -> Triangle * 3 + opposite vertex
+		HalfEdges.Reserve(NumTriangles * 3);
+
+		for (int32 t = 0; t < NumTriangles; t++)
+		{
+			const FDelaunaySite2& Site = Delaunay.Sites[t];
+			FIntVector3 Tri(Site.Vtx[0], Site.Vtx[1], Site.Vtx[2]);
+
+			const double Orient = Incremental::Orient2(Projected[Tri.X], Projected[Tri.Y], Projected[Tri.Z]);
+			if (Orient < 0) { Swap(Tri.Y, Tri.Z); }
+			else if (Orient == 0) { bDegenerate = true; }
+
+			Triangles[t] = Tri;
+
+			for (int32 k = 0; k < 3; k++)
+			{
+				Used[Tri[k]] = true;
+				HalfEdges.Add(PCGEx::H64(Tri[(k + 1) % 3], Tri[(k + 2) % 3]), t * 3 + k);
+			}
+		}
+
+		for (int32 t = 0; t < NumTriangles; t++)
+		{
+			const FIntVector3& Tri = Triangles[t];
+			for (int32 k = 0; k < 3; k++)
+			{
+				if (const int32* Twin = HalfEdges.Find(PCGEx::H64(Tri[(k + 2) % 3], Tri[(k + 1) % 3]))) { Neighbors[t][k] = *Twin / 3; }
+			}
+		}
+
+		// Flips can't bring back vertices the triangulation left out (duplicates), nor start from degenerate triangles
+		bCanRepair = !bDegenerate && Used.CountSetBits() == Positions.Num();
+
+		return true;
+	}
+
+	bool FIncrementalDelaunay2::Update(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FIncrementalDelaunay2::Update);
+
+		if (!bCanRepair || Projected.Num() != Positions.Num())
+		{
+			return Build(Positions, ProjectionDetails);
+		}
+
+		ProjectionDetails.Project(Positions, Projected);
+
+		if (!IsStillValid() || !FlipToDelaunay())
+		{
+			return Build(Positions, ProjectionDetails);
+		}
+
+		return true;
+	}
+
+	bool FIncrementalDelaunay2::IsStillValid() const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FIncrementalDelaunay2::IsStillValid);
+
+		std::atomic<bool> bInverted{false};
+		PCGExMT::ParallelOrSequential(
+			Triangles.Num(),
+			[&](const int32 t)
+			{
+				if (bInverted.load(std::memory_order_relaxed)) { return; }
+				const FIntVector3& Tri = Triangles[t];
+				if (Incremental::Orient2(Projected[Tri.X], Projected[Tri.Y], Projected[Tri.Z]) <= 0) { bInverted.store(true, std::memory_order_relaxed); }
+			});
+
+		if (bInverted.load())
+		{
+			return false;
+		}
+
+		// The hull must still be convex, otherwise the mesh no longer covers the convex hull of the points
+		TArray<int32> HullNext;
+		HullNext.Init(-1, Projected.Num());
+
+		for (int32 t = 0; t < Triangles.Num(); t++)
+		{
+			for (int32 k = 0; k < 3; k++)
+			{
+				if (Neighbors[t][k] == -1) { HullNext[Triangles[t][(k + 1) % 3]] = Triangles[t][(k + 2) % 3]; }
+			}
+		}
+
+		for (int32 A = 0; A < HullNext.Num(); A++)
+		{
+			const int32 B = HullNext[A];
+			if (B == -1) { continue; }
+
+			const int32 C = HullNext[B];
+			if (C == -1 || Incremental::Orient2(Projected[A], Projected[B], Projected[C]) < 0) { return false; }
+		}
+
+		return true;
+	}
+
+	bool FIncrementalDelaunay2::FlipToDelaunay()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FIncrementalDelaunay2::FlipToDelaunay);
+
+		const int32 NumTriangles = Triangles.Num();
+		const int32 MaxFlips = NumTriangles * 16 + 1024;
+		int32 Flips = 0;
+
+		TArray<FIntPoint> Stack; // Triangle, opposite vertex of the edge to check
+		Stack.Reserve(NumTriangles * 2);
+
+		for (int32 t = 0; t < NumTriangles; t++)
+		{
+			for (int32 k = 0; k < 3; k++) { if (Neighbors[t][k] > t) { Stack.Emplace(t, k); } }
+		}
+
+		auto Relink = [&](const int32 Tri, const int32 From, const int32 To)
+		{
+			if (Tri == -1) { return; }
+			FIntVector3& N = Neighbors[Tri];
+			for (int32 k = 0; k < 3; k++)
+			{
+				if (N[k] == From)
+				{
+					N[k] = To;
+					return;
+				}
+			}
+		};
+
+		while (!Stack.IsEmpty())
+		{
+			const FIntPoint Edge = Stack.Pop(EAllowShrinking::No);
+			const int32 T = Edge.X;
+			const int32 U = Neighbors[T][Edge.Y];
+
+			if (U == -1)
+			{
+				continue;
+			}
+
+			const FIntVector3 TriT = Triangles[T];
+			const FIntVector3 TriU = Triangles[U];
+
+			const int32 P = TriT[Edge.Y];
+			const int32 E1 = TriT[(Edge.Y + 1) % 3];
+			const int32 E2 = TriT[(Edge.Y + 2) % 3];
+			const int32 Q = TriU[Incremental::IndexOf(Neighbors[U], T, 3)];
+
+			if (Incremental::InCircle(Projected[P], Projected[E1], Projected[E2], Projected[Q]) <= 0)
+			{
+				continue;
+			}
+
+			// A non-locally-Delaunay edge always sits in a strictly convex quad: flip it
+			if (++Flips > MaxFlips)
+			{
+				return false;
+			}
+
+			const int32 NT1 = Neighbors[T][(Edge.Y + 1) % 3];                  // Across (E2, P)
+			const int32 NT2 = Neighbors[T][(Edge.Y + 2) % 3];                  // Across (P, E1)
+			const int32 NU1 = Neighbors[U][Incremental::IndexOf(TriU, E1, 3)]; // Across (Q, E2)
+			const int32 NU2 = Neighbors[U][Incremental::IndexOf(TriU, E2, 3)]; // Across (E1, Q)
+
+			Triangles[T] = FIntVector3(P, E1, Q);
+			Neighbors[T] = FIntVector3(NU2, U, NT2);
+
+			Triangles[U] = FIntVector3(Q, E2, P);
+			Neighbors[U] = FIntVector3(NT1, T, NU1);
+
+			Relink(NU2, U, T);
+			Relink(NT1, T, U);
+
+			Stack.Emplace(T, 0);
+			Stack.Emplace(T, 2);
+			Stack.Emplace(U, 0);
+			Stack.Emplace(U, 2);
+		}
+
+		NumFlips += Flips;
+		return true;
+	}
+
+	void FIncrementalDelaunay2::AccumulateCentroids(const TArrayView<FVector>& Positions, TArray<FVector>& InOutSum, TArray<double>& InOutCounts) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FIncrementalDelaunay2::AccumulateCentroids);
+
+		const int32 NumTriangles = Triangles.Num();
+
+		TArray<FVector> Centroids;
+		Centroids.SetNumUninitialized(NumTriangles);
+
+		PCGEX_PARALLEL_FOR(
+			NumTriangles,
+			const FIntVector3& Tri = Triangles[i];
+			Centroids[i] = (Positions[Tri.X] + Positions[Tri.Y] + Positions[Tri.Z]) / 3;
+			)
+
+		// Scatter stays sequential so sums don't depend on scheduling
+		for (int32 t = 0; t < NumTriangles; t++)
+		{
+			for (int32 k = 0; k < 3; k++)
+			{
+				const int32 Vtx = Triangles[t][k];
+				InOutSum[Vtx] += Centroids[t];
+				InOutCounts[Vtx] += 1;
+			}
+		}
+	}
+
+#pragma endregion
+
+#pragma region FIncrementalDelaunay3
+
+	bool FIncrementalDelaunay3::Build(const TArrayView<FVector>& Positions)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FIncrementalDelaunay3::Build);
+
+		Incremental::EnsurePredicates();
+
+		NumRebuilds++;
+		bCanRepair = false;
+		Tets.Reset();
+		Neighbors.Reset();
+		FreeTets.Reset();
+
+		if (Positions.Num() <= 3)
+		{
+			return false;
+		}
+
+		{
+			UE::Geometry::FDelaunay3 Tetrahedralization;
+			if (!Tetrahedralization.Triangulate(Positions))
+			{
+				return false;
+			}
+
+			Tets = Tetrahedralization.GetTetrahedra();
+		}
+
+		const int32 NumTets = Tets.Num();
+		Neighbors.Init(FIntVector4(-1), NumTets);
+
+		bool bDegenerate = false;
+		TBitArray<> Used(false, Positions.Num());
+
+		TMap<FIntVector, int32> OpenFaces; // Face -> Tet * 4 + opposite vertex, until its twin shows up
+		OpenFaces.Reserve(NumTets);
+
+		for (int32 t = 0; t < NumTets; t++)
+		{
+			FIntVector4& Tet = Tets[t];
+
+			const double Orient = Incremental::Orient3(Positions[Tet.X], Positions[Tet.Y], Positions[Tet.Z], Positions[Tet.W]);
+			if (Orient < 0) { Swap(Tet.X, Tet.Y); }
+			else if (Orient == 0) { bDegenerate = true; }
+
+			for (int32 k = 0; k < 4; k++)
+			{
+				Used[Tet[k]] = true;
+
+				const FIntVector Key = Incremental::FaceKey(Tet, k);
+				if (int32 Twin = -1; OpenFaces.RemoveAndCopyValue(Key, Twin))
+				{
+					Neighbors[t][k] = Twin / 4;
+					Neighbors[Twin / 4][Twin % 4] = t;
+				}
+				else
+				{
+					OpenFaces.Add(Key, t * 4 + k);
+				}
+			}
+		}
+
+		bCanRepair = !bDegenerate && Used.CountSetBits() == Positions.Num();
+
+		return true;
+	}
+
+	bool FIncrementalDelaunay3::Update(const TArrayView<FVector>& Positions)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FIncrementalDelaunay3::Update);
+
+		if (!bCanRepair || !IsStillValid(Positions) || !FlipToDelaunay(Positions))
+		{
+			return Build(Positions);
+		}
+
+		return true;
+	}
+
+	bool FIncrementalDelaunay3::IsStillValid(const TArrayView<FVector>& Positions) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FIncrementalDelaunay3::IsStillValid);
+
+		std::atomic<bool> bInverted{false};
+		PCGExMT::ParallelOrSequential(
+			Tets.Num(),
+			[&](const int32 t)
+			{
+				const FIntVector4& Tet = Tets[t];
+				if (Tet.X == -1 || bInverted.load(std::memory_order_relaxed)) { return; }
+				if (Incremental::Orient3(Positions[Tet.X], Positions[Tet.Y], Positions[Tet.Z], Positions[Tet.W]) <= 0) { bInverted.store(true, std::memory_order_relaxed); }
+			});
+
+		if (bInverted.load())
+		{
+			return false;
+		}
+
+		// The hull must still be convex
+		return FDelaunayBuilder3::IsHullConvex(Positions, Tets, Neighbors);
+	}
+
+	bool FIncrementalDelaunay3::FlipToDelaunay(const TArrayView<FVector>& Positions)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FIncrementalDelaunay3::FlipToDelaunay);
+
+		const int32 MaxFlips = Tets.Num() * 16 + 1024;
+		int32 Flips = 0;
+
+		TArray<FIntPoint> Stack; // Tet, opposite vertex of the face to check
+		TArray<FIntPoint> Skipped;
+		Stack.Reserve(Tets.Num() * 2);
+
+		for (int32 t = 0; t < Tets.Num(); t++)
+		{
+			if (Tets[t].X == -1) { continue; }
+			for (int32 k = 0; k < 4; k++) { if (Neighbors[t][k] > t) { Stack.Emplace(t, k); } }
+		}
+
+		auto IsLocallyDelaunay = [&](const int32 T, const int32 K)
+		{
+			const FIntVector4& Tet = Tets[T];
+			const int32 U = Neighbors[T][K];
+			if (Tet.X == -1 || U == -1) { return true; }
+
+			const int32 Q = Tets[U][Incremental::IndexOf(Neighbors[U], T, 4)];
+			return Incremental::InSphere(Positions[Tet.X], Positions[Tet.Y], Positions[Tet.Z], Positions[Tet.W], Positions[Q]) <= 0;
+		};
+
+		while (!Stack.IsEmpty())
+		{
+			const FIntPoint Face = Stack.Pop(EAllowShrinking::No);
+			if (IsLocallyDelaunay(Face.X, Face.Y))
+			{
+				continue;
+			}
+
+			const int32 T = Face.X;
+			const int32 U = Neighbors[T][Face.Y];
+			const FIntVector4 TetT = Tets[T];
+			const FIntVector4 TetU = Tets[U];
+
+			const int32 P = TetT[Face.Y];
+			const int32 Q = TetU[Incremental::IndexOf(Neighbors[U], T, 4)];
+
+			int32 F[3];
+			int32 n = 0;
+			for (int32 i = 0; i < 4; i++) { if (i != Face.Y) { F[n++] = TetT[i]; } }
+			if (Incremental::Orient3(Positions[F[0]], Positions[F[1]], Positions[F[2]], Positions[P]) < 0) { Swap(F[0], F[1]); }
+
+			// Which side of each shared edge segment PQ passes
+			double Side[3];
+			int32 NumNegative = 0;
+			bool bAnyZero = false;
+			for (int32 e = 0; e < 3; e++)
+			{
+				Side[e] = Incremental::Orient3(Positions[F[e]], Positions[F[(e + 1) % 3]], Positions[Q], Positions[P]);
+				NumNegative += Side[e] < 0;
+				bAnyZero |= Side[e] == 0;
+			}
+
+			if (!NumNegative && !bAnyZero)
+			{
+				// PQ crosses the shared face: 2-3
+				if (++Flips > MaxFlips) { return false; }
+
+				const int32 Old[2] = {T, U};
+				const FIntVector4 New[3] = {
+					FIntVector4(F[0], F[1], Q, P),
+					FIntVector4(F[1], F[2], Q, P),
+					FIntVector4(F[2], F[0], Q, P)};
+
+				if (!ReplaceTets(Old, New, Stack)) { return false; }
+				continue;
+			}
+
+			if (NumNegative == 1 && !bAnyZero)
+			{
+				// PQ passes beyond one edge: 3-2, if that edge is surrounded by exactly T, U and a third tet spanning P & Q
+				const int32 e = Side[0] < 0 ? 0 : Side[1] < 0 ? 1 : 2;
+				const int32 E0 = F[e];
+				const int32 E1 = F[(e + 1) % 3];
+				const int32 R = F[(e + 2) % 3];
+
+				const int32 W = Neighbors[T][Incremental::IndexOf(TetT, R, 4)];
+				if (W != -1 && W == Neighbors[U][Incremental::IndexOf(TetU, R, 4)])
+				{
+					FIntVector4 N0(P, Q, R, E0);
+					FIntVector4 N1(P, Q, R, E1);
+
+					const double O0 = Incremental::Orient3(Positions[P], Positions[Q], Positions[R], Positions[E0]);
+					const double O1 = Incremental::Orient3(Positions[P], Positions[Q], Positions[R], Positions[E1]);
+
+					if (Incremental::OppositeSigns(O0, O1))
+					{
+						if (++Flips > MaxFlips) { return false; }
+
+						if (O0 < 0) { Swap(N0.X, N0.Y); }
+						if (O1 < 0) { Swap(N1.X, N1.Y); }
+
+						const int32 Old[3] = {T, U, W};
+						const FIntVector4 New[2] = {N0, N1};
+
+						if (!ReplaceTets(Old, New, Stack)) { return false; }
+						continue;
+					}
+				}
+			}
+
+			// Unflippable for now; may resolve as neighboring flips change its surroundings
+			Skipped.Add(Face);
+		}
+
+		for (const FIntPoint& Face : Skipped)
+		{
+			if (!IsLocallyDelaunay(Face.X, Face.Y)) { return false; }
+		}
+
+		NumFlips += Flips;
+		return true;
+	}
+
+	bool FIncrementalDelaunay3::ReplaceTets(TConstArrayView<int32> InOld, TConstArrayView<FIntVector4> InNew, TArray<FIntPoint>& OutFaces)
+	{
+		struct FOuterFace
+		{
+			FIntVector Key;
+			int32 Tet;
+		};
+
+		// Faces of the cavity boundary, and whoever is on the other side
+		TArray<FOuterFace, TInlineAllocator<8>> Outer;
+		for (const int32 Old : InOld)
+		{
+			for (int32 k = 0; k < 4; k++)
+			{
+				const int32 N = Neighbors[Old][k];
+				if (!InOld.Contains(N)) { Outer.Add({Incremental::FaceKey(Tets[Old], k), N}); }
+			}
+		}
+
+		TArray<int32, TInlineAllocator<4>> Slots;
+		for (int32 i = 0; i < InNew.Num(); i++)
+		{
+			if (i < InOld.Num()) { Slots.Add(InOld[i]); }
+			else if (!FreeTets.IsEmpty()) { Slots.Add(FreeTets.Pop(EAllowShrinking::No)); }
+			else
+			{
+				Slots.Add(Tets.Add(FIntVector4(-1)));
+				Neighbors.Add(FIntVector4(-1));
+			}
+		}
+
+		for (int32 i = InNew.Num(); i < InOld.Num(); i++)
+		{
+			Tets[InOld[i]] = FIntVector4(-1);
+			Neighbors[InOld[i]] = FIntVector4(-1);
+			FreeTets.Add(InOld[i]);
+		}
+
+		for (int32 i = 0; i < InNew.Num(); i++) { Tets[Slots[i]] = InNew[i]; }
+
+		for (int32 i = 0; i < InNew.Num(); i++)
+		{
+			const int32 Slot = Slots[i];
+
+			for (int32 k = 0; k < 4; k++)
+			{
+				const FIntVector Key = Incremental::FaceKey(InNew[i], k);
+				int32 Across = -2;
+
+				for (int32 j = 0; j < InNew.Num() && Across == -2; j++)
+				{
+					if (j == i) { continue; }
+					for (int32 kk = 0; kk < 4; kk++)
+					{
+						if (Incremental::FaceKey(InNew[j], kk) == Key)
+						{
+							Across = Slots[j];
+							break;
+						}
+					}
+				}
+
+				if (Across == -2)
+				{
+					for (const FOuterFace& OuterFace : Outer)
+					{
+						if (OuterFace.Key != Key) { continue; }
+
+						Across = OuterFace.Tet;
+						if (Across != -1)
+						{
+							int32 Back = -1;
+							for (int32 kk = 0; kk < 4 && Back == -1; kk++) { if (Incremental::FaceKey(Tets[Across], kk) == Key) { Back = kk; } }
+							if (Back == -1) { return false; }
+							Neighbors[Across][Back] = Slot;
+						}
+						break;
+					}
+				}
+
+				// Cavity and new tets don't match up; topology is unusable, caller rebuilds
+				if (Across == -2) { return false; }
+
+				Neighbors[Slot][k] = Across;
+				OutFaces.Emplace(Slot, k);
+			}
+		}
+
+		return true;
+	}
+
+	void FIncrementalDelaunay3::AccumulateCentroids(const TArrayView<FVector>& Positions, TArray<FVector>& InOutSum, TArray<double>& InOutCounts) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FIncrementalDelaunay3::AccumulateCentroids);
+
+		const int32 NumTets = Tets.Num();
+
+		TArray<FVector> Centroids;
+		Centroids.SetNumUninitialized(NumTets);
+
+		PCGEX_PARALLEL_FOR(
+			NumTets,
+			const FIntVector4& Tet = Tets[i];
+			if (Tet.X != -1) { Centroids[i] = (Positions[Tet.X] + Positions[Tet.Y] + Positions[Tet.Z] + Positions[Tet.W]) / 4; }
+			)
+
+		// Scatter stays sequential so sums don't depend on scheduling
+		for (int32 t = 0; t < NumTets; t++)
+		{
+			const FIntVector4& Tet = Tets[t];
+			if (Tet.X == -1) { continue; }
+
+			for (int32 k = 0; k < 4; k++)
+			{
+				InOutSum[Tet[k]] += Centroids[t];
+				InOutCounts[Tet[k]] += 1;
+			}
+		}
+	}
+
+#pragma endregion
+}
@@ -0,0 +1,307 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Math/Geo/PCGExPointBVH.h"
+
+#include "PCGExH.h"
+#include "Core/PCGExMTCommon.h"
+#include "Math/PCGExMorton.h"
+#include "Sorting/PCGExSortingHelpers.h"
+
+namespace PCGExMath::Geo
+{
+	namespace PointBVH
+	{
+		FORCEINLINE double BoxDistSquared(const FBox& A, const FBox& B)
+		{
+			double DistSquared = 0;
+			for (int32 k = 0; k < 3; k++)
+			{
+				const double Gap = FMath::Max3(0.0, A.Min[k] - B.Max[k], B.Min[k] - A.Max[k]);
+				DistSquared += Gap * Gap;
+			}
+			return DistSquared;
+		}
+	}
+
+	FPointBVH::FPointBVH(TArray<FEntry>&& InEntries)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExMath::Geo::FPointBVH::Build);
+
+		const int32 NumEntries = InEntries.Num();
+		if (!NumEntries)
+		{
+			return;
+		}
+
+		FBox Bounds(ForceInit);
+		for (const FEntry& Entry : InEntries) { Bounds += Entry.Position; }
+
+		// Quantize positions to 21 bits per axis
+		const FVector Min = Bounds.Min;
+		const FVector Size = Bounds.GetSize();
+		const FVector Scale(
+			Size.X > 0 ? 0x1FFFFF / Size.X : 0,
+			Size.Y > 0 ? 0x1FFFFF / Size.Y : 0,
+			Size.Z > 0 ? 0x1FFFFF / Size.Z : 0);
+
+		TArray<PCGEx::FIndexKey> Keys;
+		Keys.SetNumUninitialized(NumEntries);
+
+		for (int32 i = 0; i < NumEntries; i++)
+		{
+			const FVector C = (InEntries[i].Position - Min) * Scale;
+			Keys[i] = PCGEx::FIndexKey(
+				i,
+				PCGExMath::Morton3(static_cast<uint64>(C.X), static_cast<uint64>(C.Y), static_cast<uint64>(C.Z)));
+		}
+
+		// Stable: entries sharing a key keep their input order
+		PCGExSortingHelpers::RadixSort(Keys);
+
+		Entries.SetNumUninitialized(NumEntries);
+		for (int32 i = 0; i < NumEntries; i++) { Entries[i] = InEntries[Keys[i].Index]; }
+
+		InEntries.Empty();
+
+		Nodes.Reserve(2 * FMath::DivideAndRoundUp(NumEntries, MaxLeafEntries));
+		BuildNode(0, NumEntries);
+
+		RemapGroups([](const int32 Group) { return Group; });
+	}
+
+	void FPointBVH::RemapGroups(TFunctionRef<int32(int32)> Remap)
+	{
+		for (FEntry& Entry : Entries) { Entry.Group = Remap(Entry.Group); }
+
+		// Children always come after their parent, walking backward resolves them first
+		for (int32 n = Nodes.Num() - 1; n >= 0; n--)
+		{
+			FNode& Node = Nodes[n];
+
+			if (Node.Count)
+			{
+				Node.Group = Entries[Node.Start].Group;
+				for (int32 i = Node.Start + 1; i < Node.Start + Node.Count; i++)
+				{
+					if (Entries[i].Group != Node.Group)
+					{
+						Node.Group = -1;
+						break;
+					}
+				}
+				continue;
+			}
+
+			const int32 LeftGroup = Nodes[Node.Left].Group;
+			Node.Group = LeftGroup == Nodes[Node.Right].Group ? LeftGroup : -1;
+		}
+	}
+
+	int32 FPointBVH::BuildNode(const int32 Start, const int32 Count)
+	{
+		const int32 NodeIndex = Nodes.Emplace();
+
+		if (Count <= MaxLeafEntries)
+		{
+			FBox Bounds(ForceInit);
+			for (int32 i = Start; i < Start + Count; i++) { Bounds += Entries[i].Position; }
+
+			FNode& Node = Nodes[NodeIndex];
+			Node.Bounds = Bounds;
+			Node.Start = Start;
+			Node.Count = Count;
+			return NodeIndex;
+		}
+
+		// Entries are already in Morton order, halving it gives spatially coherent children
+		const int32 Half = Count / 2;
+		const int32 Left = BuildNode(Start, Half);
+		const int32 Right = BuildNode(Start + Half, Count - Half);
+
+		FNode& Node = Nodes[NodeIndex];
+		Node.Bounds = Nodes[Left].Bounds + Nodes[Right].Bounds;
+		Node.Left = Left;
+		Node.Right = Right;
+
+		return NodeIndex;
+	}
+
+	void FindClosestPair(const FPointBVH& A, const FPointBVH& B, FClosestPair& InOutBest, const int32 ExcludedGroup)
+	{
+		if (A.IsEmpty() || B.IsEmpty())
+		{
+			return;
+		}
+
+		const TArray<FPointBVH::FNode>& NodesA = A.GetNodes();
+		const TArray<FPointBVH::FNode>& NodesB = B.GetNodes();
+		const TArray<FPointBVH::FEntry>& EntriesA = A.GetEntries();
+		const TArray<FPointBVH::FEntry>& EntriesB = B.GetEntries();
+
+		struct FNodePair
+		{
+			int32 A;
+			int32 B;
+			double DistSquared;
+		};
+
+		TArray<FNodePair, TInlineAllocator<128>> Stack;
+
+		auto MakePair = [&](const int32 NodeA, const int32 NodeB)
+		{
+			if (ExcludedGroup != -1 && NodesB[NodeB].Group == ExcludedGroup) { return FNodePair{NodeA, NodeB, TNumericLimits<double>::Max()}; }
+			return FNodePair{NodeA, NodeB, PointBVH::BoxDistSquared(NodesA[NodeA].Bounds, NodesB[NodeB].Bounds)};
+		};
+
+		Stack.Add(MakePair(0, 0));
+
+		while (!Stack.IsEmpty())
+		{
+			const FNodePair Pair = Stack.Pop(EAllowShrinking::No);
+			if (Pair.DistSquared >= InOutBest.DistSquared)
+			{
+				continue;
+			}
+
+			const FPointBVH::FNode& NodeA = NodesA[Pair.A];
+			const FPointBVH::FNode& NodeB = NodesB[Pair.B];
+
+			if (NodeA.Count && NodeB.Count)
+			{
+				for (int32 i = NodeA.Start; i < NodeA.Start + NodeA.Count; i++)
+				{
+					const FVector& PosA = EntriesA[i].Position;
+					for (int32 j = NodeB.Start; j < NodeB.Start + NodeB.Count; j++)
+					{
+						if (ExcludedGroup != -1 && EntriesB[j].Group == ExcludedGroup) { continue; }
+						if (const double DistSquared = FVector::DistSquared(PosA, EntriesB[j].Position);
+							DistSquared < InOutBest.DistSquared)
+						{
+							InOutBest.A = i;
+							InOutBest.B = j;
+							InOutBest.DistSquared = DistSquared;
+						}
+					}
+				}
+				continue;
+			}
+
+			// Descend into the larger of the two nodes, nearest child pair on top of the stack
+			const bool bSplitA = !NodeA.Count && (NodeB.Count || NodeA.Bounds.GetSize().SizeSquared() >= NodeB.Bounds.GetSize().SizeSquared());
+			const FNodePair First = bSplitA ? MakePair(NodeA.Left, Pair.B) : MakePair(Pair.A, NodeB.Left);
+			const FNodePair Second = bSplitA ? MakePair(NodeA.Right, Pair.B) : MakePair(Pair.A, NodeB.Right);
+
+			if (First.DistSquared <= Second.DistSquared)
+			{
+				if (Second.DistSquared < InOutBest.DistSquared) { Stack.Add(Second); }
+				if (First.DistSquared < InOutBest.DistSquared) { Stack.Add(First); }
+			}
+			else
+			{
+				if (First.DistSquared < InOutBest.DistSquared) { Stack.Add(First); }
+				if (Second.DistSquared < InOutBest.DistSquared) { Stack.Add(Second); }
+			}
+		}
+	}
+
+	void FindGroupMST(const TArray<TSharedPtr<FPointBVH>>& Groups, FPointBVH& All, TArray<FGroupBridge>& OutBridges)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExMath::Geo::FindGroupMST);
+
+		const int32 NumGroups = Groups.Num();
+
+		TArray<int32> OriginalGroups;
+		OriginalGroups.SetNumUninitialized(All.Num());
+		for (int32 i = 0; i < All.Num(); i++) { OriginalGroups[i] = All.GetEntries()[i].Group; }
+
+		TArray<int32> Parents;
+		Parents.SetNumUninitialized(NumGroups);
+		for (int32 g = 0; g < NumGroups; g++) { Parents[g] = g; }
+
+		auto Find = [&](int32 X)
+		{
+			while (Parents[X] != X)
+			{
+				Parents[X] = Parents[Parents[X]];
+				X = Parents[X];
+			}
+			return X;
+		};
+
+		TArray<int32> Roots;
+		TArray<int32> Slots;
+		TArray<TArray<int32>> Members;
+		TArray<FClosestPair> Best;
+		TArray<int32> BestFrom;
+
+		// Each round at least halves the number of components
+		while (true)
+		{
+			Roots.Reset();
+			Members.Reset();
+			Slots.Init(-1, NumGroups);
+
+			for (int32 g = 0; g < NumGroups; g++)
+			{
+				if (!Groups[g] || Groups[g]->IsEmpty()) { continue; }
+
+				const int32 Root = Find(g);
+				if (Slots[Root] == -1)
+				{
+					Slots[Root] = Roots.Add(Root);
+					Members.Emplace();
+				}
+
+				Members[Slots[Root]].Add(g);
+			}
+
+			const int32 NumComponents = Roots.Num();
+			if (NumComponents <= 1)
+			{
+				break;
+			}
+
+			All.RemapGroups([&](const int32 Group) { return Find(Group); });
+
+			Best.Reset();
+			Best.SetNum(NumComponents);
+			BestFrom.Init(-1, NumComponents);
+
+			PCGExMT::ParallelOrSequential(
+				NumComponents,
+				[&](const int32 c)
+				{
+					for (const int32 g : Members[c])
+					{
+						const double Previous = Best[c].DistSquared;
+						FindClosestPair(*Groups[g], All, Best[c], Roots[c]);
+						if (Best[c].DistSquared < Previous) { BestFrom[c] = g; }
+					}
+				}, 2);
+
+			bool bMerged = false;
+			for (int32 c = 0; c < NumComponents; c++)
+			{
+				if (!Best[c].IsValid()) { continue; }
+
+				const FPointBVH::FEntry& From = Groups[BestFrom[c]]->GetEntries()[Best[c].A];
+				const FPointBVH::FEntry& To = All.GetEntries()[Best[c].B];
+
+				// Both components may have picked the same bridge
+				const int32 RootA = Find(Roots[c]);
+				const int32 RootB = Find(To.Group);
+				if (RootA == RootB) { continue; }
+
+				Parents[FMath::Max(RootA, RootB)] = FMath::Min(RootA, RootB);
+				OutBridges.Add(FGroupBridge{BestFrom[c], OriginalGroups[Best[c].B], From.Index, To.Index});
+				bMerged = true;
+			}
+
+			if (!bMerged)
+			{
+				break;
+			}
+		}
+	}
+}
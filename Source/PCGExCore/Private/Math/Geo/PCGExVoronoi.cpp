@@ -232,6 +232,8 @@ namespace PCGExMath::Geo
 	void TVoronoi3::Clear()
 	{
 		Delaunay.Reset();
+		VoronoiEdges.Empty();
+		Circumspheres.Empty();
 		Centroids.Empty();
 		IsValid = false;
 	}
@@ -239,6 +241,7 @@ namespace PCGExMath::Geo
 	bool TVoronoi3::Process(const TArrayView<FVector>& Positions)
 	{
 		IsValid = false;
+		VoronoiEdges.Reset();
 		Delaunay = MakeShared<TDelaunay3>();
 
 		if (!Delaunay->Process<true, false>(Positions))
@@ -254,24 +257,27 @@ namespace PCGExMath::Geo
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(GeoVoronoi::FindVoronoiEdges);
 
-			for (FDelaunaySite3& Site : Delaunay->Sites)
-			{
-				FindSphereFrom4Points(Positions, Site.Vtx, Circumspheres[Site.Id]);
-				GetCentroid(Positions, Site.Vtx, Centroids[Site.Id]);
-			}
+			PCGEX_PARALLEL_FOR(
+				NumSites,
+				const FDelaunaySite3& Site = Delaunay->Sites[i];
+				FindSphereFrom4Points(Positions, Site.Vtx, Circumspheres[i]);
+				GetCentroid(Positions, Site.Vtx, Centroids[i]);
+				)
 
-			for (const TPair<uint32, uint64>& AdjacencyPair : Delaunay->Adjacency)
+			// Each shared face is claimed by its higher site; walking sites in order keeps the hashes sorted
+			VoronoiEdges.Reserve(NumSites * 2);
+			for (int32 i = 0; i < NumSites; i++)
 			{
-				int32 A = -1;
-				int32 B = -1;
-				PCGEx::NH64(AdjacencyPair.Value, A, B);
-
-				if (A == -1 || B == -1)
+				int32 Lower[4];
+				int32 NumLower = 0;
+				for (int32 f = 0; f < 4; f++)
 				{
-					continue;
+					const int32 Other = Delaunay->Neighbors[i][f];
+					if (Other != -1 && Other < i) { Lower[NumLower++] = Other; }
 				}
 
-				VoronoiEdges.Add(PCGEx::H64U(A, B));
+				Algo::Sort(MakeArrayView(Lower, NumLower));
+				for (int32 j = 0; j < NumLower; j++) { VoronoiEdges.Add(PCGEx::H64U(i, Lower[j])); }
 			}
 		}
 
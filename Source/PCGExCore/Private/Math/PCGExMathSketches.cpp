@@ -0,0 +1,137 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Math/PCGExMathSketches.h"
+
+namespace PCGExMath
+{
+	FHyperLogLog::FHyperLogLog()
+	{
+		Registers.SetNumZeroed(NumRegisters);
+	}
+
+	void FHyperLogLog::Merge(const FHyperLogLog& Other)
+	{
+		for (int32 i = 0; i < NumRegisters; i++) { Registers[i] = FMath::Max(Registers[i], Other.Registers[i]); }
+	}
+
+	double FHyperLogLog::Estimate() const
+	{
+		constexpr double M = NumRegisters;
+		constexpr double Alpha = 0.7213 / (1 + 1.079 / M);
+
+		double Sum = 0;
+		int32 NumZeros = 0;
+		for (const uint8 Register : Registers)
+		{
+			Sum += FMath::Pow(2.0, -static_cast<double>(Register));
+			if (!Register) { NumZeros++; }
+		}
+
+		const double Raw = Alpha * M * M / Sum;
+
+		// Small range: linear counting is more accurate while registers are still sparse
+		if (Raw <= 2.5 * M && NumZeros) { return M * FMath::Loge(M / NumZeros); }
+
+		return Raw;
+	}
+
+	FTDigest::FTDigest(const double InCompression)
+		: Compression(FMath::Max(InCompression, 10.0))
+	{
+		BufferSize = static_cast<int32>(Compression) * 8;
+		Buffer.Reserve(BufferSize);
+	}
+
+	void FTDigest::Merge(const FTDigest& Other)
+	{
+		Buffer.Append(Other.Centroids);
+		Buffer.Append(Other.Buffer);
+		Min = FMath::Min(Min, Other.Min);
+		Max = FMath::Max(Max, Other.Max);
+		Flush();
+	}
+
+	double FTDigest::Quantile(const double Q)
+	{
+		Flush();
+
+		if (Centroids.IsEmpty()) { return 0; }
+		if (Centroids.Num() == 1) { return Centroids[0].Mean; }
+
+		// Interpolate between centroid centers; the extremes are pinned to the exact min/max
+		const double Target = FMath::Clamp(Q, 0.0, 1.0) * TotalWeight;
+
+		double Cumulative = Centroids[0].Weight * 0.5;
+		if (Target < Cumulative)
+		{
+			return FMath::Lerp(Min, Centroids[0].Mean, Target / Cumulative);
+		}
+
+		for (int32 i = 0; i < Centroids.Num() - 1; i++)
+		{
+			const double Step = (Centroids[i].Weight + Centroids[i + 1].Weight) * 0.5;
+			if (Target < Cumulative + Step)
+			{
+				return FMath::Lerp(Centroids[i].Mean, Centroids[i + 1].Mean, (Target - Cumulative) / Step);
+			}
+			Cumulative += Step;
+		}
+
+		const double Tail = Centroids.Last().Weight * 0.5;
+		return FMath::Lerp(Centroids.Last().Mean, Max, Tail > 0 ? FMath::Min((Target - Cumulative) / Tail, 1.0) : 1.0);
+	}
+
+	double FTDigest::BufferedWeight() const
+	{
+		double Weight = 0;
+		for (const FCentroid& C : Buffer) { Weight += C.Weight; }
+		return Weight;
+	}
+
+	void FTDigest::Flush()
+	{
+		if (Buffer.IsEmpty()) { return; }
+
+		for (const FCentroid& C : Buffer)
+		{
+			Min = FMath::Min(Min, C.Mean);
+			Max = FMath::Max(Max, C.Mean);
+			TotalWeight += C.Weight;
+		}
+
+		Buffer.Append(Centroids);
+		Buffer.Sort([](const FCentroid& A, const FCentroid& B) { return A.Mean < B.Mean; });
+
+		// k1 scale function: centroids may only span one unit of k, so they stay small near the tails
+		const double Normalizer = Compression / (2 * UE_DOUBLE_PI);
+		auto K = [&](const double Q) { return Normalizer * FMath::Asin(FMath::Clamp(2 * Q - 1, -1.0, 1.0)); };
+
+		Centroids.Reset();
+
+		FCentroid Current = Buffer[0];
+		double WeightSoFar = 0;
+		double KLow = K(0);
+
+		for (int32 i = 1; i < Buffer.Num(); i++)
+		{
+			const FCentroid& Next = Buffer[i];
+			const double Proposed = Current.Weight + Next.Weight;
+
+			if (K((WeightSoFar + Proposed) / TotalWeight) - KLow <= 1)
+			{
+				Current.Mean += (Next.Mean - Current.Mean) * Next.Weight / Proposed;
+				Current.Weight = Proposed;
+				continue;
+			}
+
+			Centroids.Add(Current);
+			WeightSoFar += Current.Weight;
+			KLow = K(WeightSoFar / TotalWeight);
+			Current = Next;
+		}
+
+		Centroids.Add(Current);
+		Buffer.Reset();
+	}
+}
@@ -9,6 +9,7 @@
 #include "Math/PCGExMathAxis.h"
 #include "Misc/ScopeLock.h"
 #include "Paths/PCGExPathIntersectionDetails.h"
+#include "Paths/PCGExPathQueryGrid.h"
 #include "Paths/PCGExPathsHelpers.h"
 
 #include "Data/PCGPolygon2DData.h"
@@ -254,6 +255,15 @@ namespace PCGExPaths
 		}
 	}
 
+	void FPath::BuildQueryGrid(const int32 MinEdges)
+	{
+		if (QueryGrid || NumEdges < FMath::Max(1, MinEdges))
+		{
+			return;
+		}
+		QueryGrid = MakeShared<FPathQueryGrid>(*this);
+	}
+
 	void FPath::UpdateConvexity(const int32 Index)
 	{
 		if (!bIsConvex)
@@ -354,6 +364,10 @@ namespace PCGExPaths
 		{
 			return false;
 		}
+		if (QueryGrid)
+		{
+			return QueryGrid->IsInside(ProjectedPoint);
+		}
 		return FGeomTools2D::IsPointInPolygon(ProjectedPoint, ProjectedPoints);
 	}
 
@@ -381,6 +395,7 @@ namespace PCGExPaths
 
 	void FPath::BuildProjection()
 	{
+		QueryGrid.Reset();
 		BuildProjectedPoints2D(Positions, Projection, ProjectedPoints, ProjectedBounds);
 	}
 
@@ -402,6 +417,8 @@ namespace PCGExPaths
 			return;
 		}
 
+		QueryGrid.Reset();
+
 		const int32 N = ProjectedPoints.Num();
 		if (N < 3)
 		{
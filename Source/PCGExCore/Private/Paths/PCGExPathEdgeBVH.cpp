@@ -0,0 +1,114 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Paths/PCGExPathEdgeBVH.h"
+
+#include "PCGExH.h"
+#include "Math/PCGExMorton.h"
+#include "Paths/PCGExPath.h"
+#include "Sorting/PCGExSortingHelpers.h"
+
+namespace PCGExPaths
+{
+	FPathEdgeBVH::FPathEdgeBVH(const TArray<TSharedPtr<FPath>>& InPaths, TFunctionRef<bool(int32, int32)> CanIndex)
+		: Paths(InPaths)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPaths::FPathEdgeBVH::Build);
+
+		int32 NumCandidates = 0;
+		for (const TSharedPtr<FPath>& Path : Paths) { if (Path) { NumCandidates += Path->NumEdges; } }
+
+		TArray<FEntry> Unordered;
+		Unordered.Reserve(NumCandidates);
+
+		FBox Bounds(ForceInit);
+
+		for (int32 p = 0; p < Paths.Num(); p++)
+		{
+			const TSharedPtr<FPath>& Path = Paths[p];
+			if (!Path)
+			{
+				continue;
+			}
+
+			for (int32 e = 0; e < Path->NumEdges; e++)
+			{
+				const FPathEdge& Edge = Path->Edges[e];
+				if (!Path->IsEdgeValid(Edge) || !CanIndex(p, e))
+				{
+					continue;
+				}
+
+				FEntry& Entry = Unordered.Emplace_GetRef();
+				Entry.Bounds = Edge.Bounds.GetBox();
+				Entry.Path = p;
+				Entry.Edge = e;
+
+				Bounds += Entry.Bounds;
+			}
+		}
+
+		const int32 NumEntries = Unordered.Num();
+		if (!NumEntries)
+		{
+			return;
+		}
+
+		// Quantize centers to 21 bits per axis
+		const FVector Min = Bounds.Min;
+		const FVector Size = Bounds.GetSize();
+		const FVector Scale(
+			Size.X > 0 ? 0x1FFFFF / Size.X : 0,
+			Size.Y > 0 ? 0x1FFFFF / Size.Y : 0,
+			Size.Z > 0 ? 0x1FFFFF / Size.Z : 0);
+
+		TArray<PCGEx::FIndexKey> Keys;
+		Keys.SetNumUninitialized(NumEntries);
+
+		for (int32 i = 0; i < NumEntries; i++)
+		{
+			const FVector C = (Unordered[i].Bounds.GetCenter() - Min) * Scale;
+			Keys[i] = PCGEx::FIndexKey(
+				i,
+				PCGExMath::Morton3(static_cast<uint64>(C.X), static_cast<uint64>(C.Y), static_cast<uint64>(C.Z)));
+		}
+
+		// Stable: entries sharing a key keep their (path, edge) order
+		PCGExSortingHelpers::RadixSort(Keys);
+
+		Entries.SetNumUninitialized(NumEntries);
+		for (int32 i = 0; i < NumEntries; i++) { Entries[i] = Unordered[Keys[i].Index]; }
+
+		Nodes.Reserve(2 * FMath::DivideAndRoundUp(NumEntries, MaxLeafEntries));
+		BuildNode(0, NumEntries);
+	}
+
+	int32 FPathEdgeBVH::BuildNode(const int32 Start, const int32 Count)
+	{
+		const int32 NodeIndex = Nodes.Emplace();
+
+		if (Count <= MaxLeafEntries)
+		{
+			FBox Bounds(ForceInit);
+			for (int32 i = Start; i < Start + Count; i++) { Bounds += Entries[i].Bounds; }
+
+			FNode& Node = Nodes[NodeIndex];
+			Node.Bounds = Bounds;
+			Node.Start = Start;
+			Node.Count = Count;
+			return NodeIndex;
+		}
+
+		// Entries are already in Morton order, halving it gives spatially coherent children
+		const int32 Half = Count / 2;
+		const int32 Left = BuildNode(Start, Half);
+		const int32 Right = BuildNode(Start + Half, Count - Half);
+
+		FNode& Node = Nodes[NodeIndex];
+		Node.Bounds = Nodes[Left].Bounds + Nodes[Right].Bounds;
+		Node.Left = Left;
+		Node.Right = Right;
+
+		return NodeIndex;
+	}
+}
@@ -0,0 +1,286 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Paths/PCGExPathQueryGrid.h"
+
+#include "Paths/PCGExPath.h"
+
+namespace PCGExPaths
+{
+	namespace QueryGrid
+	{
+		// Hard cap on the grid resolution, per axis
+		constexpr int32 MaxResolution = 2048;
+
+		FORCEINLINE double Orient(const FVector2D& A, const FVector2D& B, const FVector2D& C)
+		{
+			return (B.X - A.X) * (C.Y - A.Y) - (B.Y - A.Y) * (C.X - A.X);
+		}
+
+		// Half-open side classification so a polygon vertex lying exactly on the query segment
+		// is attributed to one side only, and counted consistently by the two edges sharing it.
+		FORCEINLINE bool Crosses(const FVector2D& A, const FVector2D& B, const FVector2D& C, const FVector2D& D)
+		{
+			return ((Orient(A, B, C) > 0) != (Orient(A, B, D) > 0)) && ((Orient(C, D, A) > 0) != (Orient(C, D, B) > 0));
+		}
+	}
+
+	FPathQueryGrid::FPathQueryGrid(const FPath& InPath, const double CellsPerEdge)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPathQueryGrid::Build);
+
+		const FPCGExGeo2DProjectionDetails& Projection = InPath.GetProjection();
+		const TConstPCGValueRange<FTransform>& Positions = InPath.GetPositions();
+
+		PolygonPoints = InPath.GetProjectedPoints();
+
+		FBox2D GridBounds(ForceInit);
+		for (const FVector2D& P : PolygonPoints) { GridBounds += P; }
+
+		PathPoints.SetNumUninitialized(Positions.Num());
+		for (int i = 0; i < Positions.Num(); i++)
+		{
+			const FVector P = Projection.ProjectFlat(Positions[i].GetLocation());
+			GridBounds += (PathPoints[i] = FVector2D(P.X, P.Y));
+		}
+
+		if (!GridBounds.bIsValid) { GridBounds = FBox2D(FVector2D::ZeroVector, FVector2D::ZeroVector); }
+
+		// Pad a little so points sitting exactly on the max boundary still map inside the grid
+		const FVector2D Size = GridBounds.GetSize();
+		const double Pad = FMath::Max(1e-3, Size.GetMax() * 1e-6);
+		GridBounds = GridBounds.ExpandBy(Pad);
+
+		const FVector2D PaddedSize = GridBounds.GetSize();
+		const int32 TargetCells = FMath::Max(1, FMath::CeilToInt32(FMath::Max(InPath.NumEdges, PolygonPoints.Num()) * CellsPerEdge));
+
+		// Square cells sized for ~TargetCells over the bounds area; degenerate (flat) bounds fall back to the longest side.
+		const double Area = PaddedSize.X * PaddedSize.Y;
+		CellSize = Area > UE_SMALL_NUMBER ? FMath::Sqrt(Area / TargetCells) : PaddedSize.GetMax() / TargetCells;
+		CellSize = FMath::Max3(CellSize, PaddedSize.GetMax() / QueryGrid::MaxResolution, UE_KINDA_SMALL_NUMBER);
+		InvCellSize = 1 / CellSize;
+
+		Origin = GridBounds.Min;
+		NumX = FMath::Clamp(FMath::CeilToInt32(PaddedSize.X * InvCellSize), 1, QueryGrid::MaxResolution);
+		NumY = FMath::Clamp(FMath::CeilToInt32(PaddedSize.Y * InvCellSize), 1, QueryGrid::MaxResolution);
+
+		// IsPointInPolygon always treats the projected polygon as closed
+		BuildCells(PolygonPoints, PolygonPoints.Num() > 2 ? PolygonPoints.Num() : 0, PolygonCellStart, PolygonCellItems);
+		BuildCells(PathPoints, InPath.NumEdges, EdgeCellStart, EdgeCellItems);
+
+		ClassifyCells();
+	}
+
+	template <typename Func>
+	void FPathQueryGrid::ForEachSegmentCell(const FVector2D& A, const FVector2D& B, Func&& Callback) const
+	{
+		// Conservative rasterization: for each row the segment spans, visit the column range
+		// covered by the portion of the segment clipped to that row's band.
+		const double Eps = CellSize * 1e-6;
+
+		const double MinY = FMath::Min(A.Y, B.Y);
+		const double MaxY = FMath::Max(A.Y, B.Y);
+		const double DY = B.Y - A.Y;
+		const bool bFlat = FMath::Abs(DY) <= UE_SMALL_NUMBER;
+
+		const int32 R0 = ToRow(MinY - Eps);
+		const int32 R1 = ToRow(MaxY + Eps);
+
+		for (int32 Row = R0; Row <= R1; Row++)
+		{
+			double X0;
+			double X1;
+
+			if (bFlat)
+			{
+				X0 = FMath::Min(A.X, B.X);
+				X1 = FMath::Max(A.X, B.X);
+			}
+			else
+			{
+				const double BandMin = FMath::Max(MinY, Origin.Y + Row * CellSize);
+				const double BandMax = FMath::Min(MaxY, Origin.Y + (Row + 1) * CellSize);
+				const double Slope = (B.X - A.X) / DY;
+				const double XA = A.X + (BandMin - A.Y) * Slope;
+				const double XB = A.X + (BandMax - A.Y) * Slope;
+				X0 = FMath::Min(XA, XB);
+				X1 = FMath::Max(XA, XB);
+			}
+
+			const int32 C0 = ToCol(X0 - Eps);
+			const int32 C1 = ToCol(X1 + Eps);
+			for (int32 Col = C0; Col <= C1; Col++) { Callback(Row * NumX + Col); }
+		}
+	}
+
+	void FPathQueryGrid::BuildCells(const TArray<FVector2D>& InPoints, const int32 NumSegments, TArray<int32>& OutStart, TArray<int32>& OutItems) const
+	{
+		const int32 NumCells = GetNumCells();
+		const int32 NumPoints = InPoints.Num();
+
+		OutStart.Init(0, NumCells + 1);
+
+		if (!NumSegments || NumPoints < 2) { return; }
+
+		// Count, prefix-sum, scatter
+		for (int i = 0; i < NumSegments; i++)
+		{
+			ForEachSegmentCell(InPoints[i], InPoints[(i + 1) % NumPoints], [&](const int32 Cell) { OutStart[Cell + 1]++; });
+		}
+
+		for (int i = 1; i <= NumCells; i++) { OutStart[i] += OutStart[i - 1]; }
+
+		OutItems.SetNumUninitialized(OutStart[NumCells]);
+		TArray<int32> Cursor(OutStart.GetData(), NumCells);
+
+		for (int i = 0; i < NumSegments; i++)
+		{
+			ForEachSegmentCell(InPoints[i], InPoints[(i + 1) % NumPoints], [&](const int32 Cell) { OutItems[Cursor[Cell]++] = i; });
+		}
+	}
+
+	void FPathQueryGrid::ClassifyCells()
+	{
+		// Containment of each cell center, resolved row by row: gather the polygon edges
+		// crossing the row's center line from the row's cells, sort crossing abscissas, then sweep columns.
+		// Uses the same half-open crossing rule as a standard even-odd point-in-polygon test.
+		CellCenterInside.Init(0, GetNumCells());
+
+		const int32 NumPoly = PolygonPoints.Num();
+		if (NumPoly < 3) { return; }
+
+		TArray<int32> Stamp;
+		Stamp.Init(-1, NumPoly);
+
+		TArray<double> Crossings;
+
+		for (int32 Row = 0; Row < NumY; Row++)
+		{
+			const double Y = Origin.Y + (Row + 0.5) * CellSize;
+			Crossings.Reset();
+
+			for (int32 Col = 0; Col < NumX; Col++)
+			{
+				const int32 Cell = Row * NumX + Col;
+				for (int32 k = PolygonCellStart[Cell]; k < PolygonCellStart[Cell + 1]; k++)
+				{
+					const int32 E = PolygonCellItems[k];
+					if (Stamp[E] == Row) { continue; }
+					Stamp[E] = Row;
+
+					const FVector2D& A = PolygonPoints[E];
+					const FVector2D& B = PolygonPoints[(E + 1) % NumPoly];
+					if ((A.Y > Y) == (B.Y > Y)) { continue; }
+
+					Crossings.Add(A.X + (Y - A.Y) * (B.X - A.X) / (B.Y - A.Y));
+				}
+			}
+
+			if (Crossings.IsEmpty()) { continue; }
+
+			Crossings.Sort();
+
+			// Inside when an odd number of crossings lie to the right of the center
+			int32 Passed = 0;
+			for (int32 Col = 0; Col < NumX; Col++)
+			{
+				const double X = Origin.X + (Col + 0.5) * CellSize;
+				while (Passed < Crossings.Num() && Crossings[Passed] <= X) { Passed++; }
+				CellCenterInside[Row * NumX + Col] = (Crossings.Num() - Passed) & 1;
+			}
+		}
+	}
+
+	bool FPathQueryGrid::IsInside(const FVector2D& InProjected) const
+	{
+		const int32 Col = ToCol(InProjected.X);
+		const int32 Row = ToRow(InProjected.Y);
+		const int32 Cell = Row * NumX + Col;
+
+		bool bInside = CellCenterInside[Cell] != 0;
+
+		const int32 Start = PolygonCellStart[Cell];
+		const int32 End = PolygonCellStart[Cell + 1];
+		if (Start == End) { return bInside; }
+
+		// Every polygon edge crossing the center->point segment overlaps this cell, so the cell list is exhaustive
+		const FVector2D Center = GetCellCenter(Col, Row);
+		const int32 NumPoly = PolygonPoints.Num();
+
+		for (int32 k = Start; k < End; k++)
+		{
+			const int32 E = PolygonCellItems[k];
+			if (QueryGrid::Crosses(Center, InProjected, PolygonPoints[E], PolygonPoints[(E + 1) % NumPoly])) { bInside = !bInside; }
+		}
+
+		return bInside;
+	}
+
+	int32 FPathQueryGrid::FindClosestEdge(const FPath& InPath, const FVector& WorldPosition, double& OutDistSquared) const
+	{
+		OutDistSquared = TNumericLimits<double>::Max();
+		if (!InPath.NumEdges) { return -1; }
+
+		const TConstPCGValueRange<FTransform>& Positions = InPath.GetPositions();
+		const FVector Flat = InPath.GetProjection().ProjectFlat(WorldPosition);
+		const FVector2D P(Flat.X, Flat.Y);
+
+		const int32 CX = ToCol(P.X);
+		const int32 CY = ToRow(P.Y);
+
+		int32 BestEdge = -1;
+
+		auto VisitCell = [&](const int32 Cell)
+		{
+			for (int32 k = EdgeCellStart[Cell]; k < EdgeCellStart[Cell + 1]; k++)
+			{
+				const int32 E = EdgeCellItems[k];
+				const FPathEdge& Edge = InPath.Edges[E];
+				const FVector Closest = FMath::ClosestPointOnSegment(WorldPosition, Positions[Edge.Start].GetLocation(), Positions[Edge.End].GetLocation());
+				const double DistSq = FVector::DistSquared(WorldPosition, Closest);
+				if (DistSq < OutDistSquared || (DistSq == OutDistSquared && E < BestEdge))
+				{
+					OutDistSquared = DistSq;
+					BestEdge = E;
+				}
+			}
+		};
+
+		const int32 MaxRing = FMath::Max(NumX, NumY);
+		for (int32 Ring = 0; Ring <= MaxRing; Ring++)
+		{
+			const int32 X0 = CX - Ring;
+			const int32 X1 = CX + Ring;
+			const int32 Y0 = CY - Ring;
+			const int32 Y1 = CY + Ring;
+
+			for (int32 Y = FMath::Max(Y0, 0); Y <= FMath::Min(Y1, NumY - 1); Y++)
+			{
+				if (Y == Y0 || Y == Y1)
+				{
+					for (int32 X = FMath::Max(X0, 0); X <= FMath::Min(X1, NumX - 1); X++) { VisitCell(Y * NumX + X); }
+				}
+				else
+				{
+					if (X0 >= 0) { VisitCell(Y * NumX + X0); }
+					if (X1 < NumX) { VisitCell(Y * NumX + X1); }
+				}
+			}
+
+			// Lower bound on the projected distance to any cell outside the visited block.
+			// Sides that reached the grid border have nothing left beyond them.
+			double LowerBound = TNumericLimits<double>::Max();
+			if (X0 > 0) { LowerBound = FMath::Min(LowerBound, P.X - (Origin.X + X0 * CellSize)); }
+			if (X1 < NumX - 1) { LowerBound = FMath::Min(LowerBound, (Origin.X + (X1 + 1) * CellSize) - P.X); }
+			if (Y0 > 0) { LowerBound = FMath::Min(LowerBound, P.Y - (Origin.Y + Y0 * CellSize)); }
+			if (Y1 < NumY - 1) { LowerBound = FMath::Min(LowerBound, (Origin.Y + (Y1 + 1) * CellSize) - P.Y); }
+
+			if (LowerBound == TNumericLimits<double>::Max()) { break; } // Whole grid visited
+
+			LowerBound = FMath::Max(0, LowerBound);
+			if (BestEdge != -1 && LowerBound * LowerBound > OutDistSquared) { break; }
+		}
+
+		return BestEdge;
+	}
+}
@@ -12,8 +12,10 @@ PRAGMA_ENABLE_EXPERIMENTAL_WARNINGS // FPCGSplineStruct
 #include "Data/PCGExPointIO.h"
 #include "Data/PCGPolygon2DData.h"
 #include "Math/PCGExBestFitPlane.h"
+#include "Paths/PCGExPathQueryGrid.h"
 #include "Paths/PCGExPathsCommon.h"
 #include "Paths/PCGExPathsHelpers.h"
+#include "Paths/PCGExSplineQuery.h"
 
 #define LOCTEXT_NAMESPACE "PCGExPaths"
 #define PCGEX_NAMESPACE PCGExPaths
@@ -63,6 +65,7 @@ namespace PCGExPaths
 	{
 		Spline = &SplineData->SplineStruct; // MakeSplineCopy(SplineData->SplineStruct);
 		bIsSplineBacked = true;
+		SplineQuery = MakeShared<FSplineQuery>(*Spline);
 
 		TArray<FVector> TempPolyline;
 		Spline->ConvertSplineToPolyLine(ESplineCoordinateSpace::World, FMath::Square(Fidelity), TempPolyline);
@@ -161,6 +164,20 @@ namespace PCGExPaths
 		OutLerp = 0;
 		if (Edges.IsEmpty()) { return 0; }
 
+		if (QueryGrid)
+		{
+			double DistSq = 0;
+			const int32 EdgeIndex = QueryGrid->FindClosestEdge(*this, WorldPosition, DistSq);
+			if (EdgeIndex != -1)
+			{
+				const FPathEdge& Edge = Edges[EdgeIndex];
+				const FVector Start = Positions[Edge.Start].GetLocation();
+				const FVector Closest = FMath::ClosestPointOnSegment(WorldPosition, Start, Positions[Edge.End].GetLocation());
+				OutLerp = Edge.Length > SMALL_NUMBER ? static_cast<float>(FVector::DotProduct(Closest - Start, Edge.Dir) / Edge.Length) : 0.0f;
+				return EdgeIndex;
+			}
+		}
+
 		double BestDistSq = TNumericLimits<double>::Max();
 		int32 BestEdge = 0;
 
@@ -201,6 +218,11 @@ namespace PCGExPaths
 		return FTransform(Rotation, Location, Scale);
 	}
 
+	float FPolyPath::FindSplineKeyClosest(const FVector& WorldPosition) const
+	{
+		return static_cast<float>(SplineQuery->FindInputKeyClosest(WorldPosition));
+	}
+
 	FTransform FPolyPath::GetClosestTransform(const FVector& WorldPosition, int32& OutEdgeIndex, float& OutLerp, const bool bUseScale) const
 	{
 		if (!bIsSplineBacked)
@@ -209,7 +231,7 @@ namespace PCGExPaths
 			return LerpEdgeTransform(OutEdgeIndex, OutLerp, bUseScale);
 		}
 
-		const float ClosestKey = Spline->FindInputKeyClosestToWorldLocation(WorldPosition);
+		const float ClosestKey = FindSplineKeyClosest(WorldPosition);
 		OutEdgeIndex = FMath::Min(FMath::FloorToInt32(ClosestKey), this->LastEdge);
 		OutLerp = ClosestKey - OutEdgeIndex;
 		return Spline->GetTransformAtSplineInputKey(ClosestKey, ESplineCoordinateSpace::World, bUseScale);
@@ -225,7 +247,7 @@ namespace PCGExPaths
 			return LerpEdgeTransform(EdgeIndex, Lerp, bUseScale);
 		}
 
-		const float ClosestKey = Spline->FindInputKeyClosestToWorldLocation(WorldPosition);
+		const float ClosestKey = FindSplineKeyClosest(WorldPosition);
 		OutAlpha = ClosestKey / Spline->GetNumberOfSplineSegments();
 		return Spline->GetTransformAtSplineInputKey(ClosestKey, ESplineCoordinateSpace::World, bUseScale);
 	}
@@ -239,7 +261,7 @@ namespace PCGExPaths
 			const int32 EdgeIndex = ClosestEdgeLerp(WorldPosition, Lerp);
 			return LerpEdgeTransform(EdgeIndex, Lerp, bUseScale);
 		}
-		return Spline->GetTransformAtSplineInputKey(Spline->FindInputKeyClosestToWorldLocation(WorldPosition), ESplineCoordinateSpace::World, bUseScale);
+		return Spline->GetTransformAtSplineInputKey(FindSplineKeyClosest(WorldPosition), ESplineCoordinateSpace::World, bUseScale);
 	}
 
 	FTransform FPolyPath::GetClosestTransform(const FVector& WorldPosition, const bool bUseScale) const
@@ -250,7 +272,7 @@ namespace PCGExPaths
 			const int32 EdgeIndex = ClosestEdgeLerp(WorldPosition, Lerp);
 			return LerpEdgeTransform(EdgeIndex, Lerp, bUseScale);
 		}
-		return Spline->GetTransformAtSplineInputKey(Spline->FindInputKeyClosestToWorldLocation(WorldPosition), ESplineCoordinateSpace::World, bUseScale);
+		return Spline->GetTransformAtSplineInputKey(FindSplineKeyClosest(WorldPosition), ESplineCoordinateSpace::World, bUseScale);
 	}
 
 	bool FPolyPath::GetClosestPosition(const FVector& WorldPosition, FVector& OutPosition) const
@@ -271,7 +293,7 @@ namespace PCGExPaths
 	{
 		if (!bIsSplineBacked) { return ClosestEdgeLerp(WorldPosition, OutLerp); }
 
-		const float ClosestKey = Spline->FindInputKeyClosestToWorldLocation(WorldPosition);
+		const float ClosestKey = FindSplineKeyClosest(WorldPosition);
 		const int32 OutEdgeIndex = FMath::FloorToInt32(ClosestKey);
 		OutLerp = ClosestKey - OutEdgeIndex;
 		return FMath::Min(OutEdgeIndex, this->LastEdge);
@@ -0,0 +1,262 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Paths/PCGExSplineQuery.h"
+
+PRAGMA_DISABLE_EXPERIMENTAL_WARNINGS // FPCGSplineStruct
+#include "Data/PCGSplineStruct.h"
+PRAGMA_ENABLE_EXPERIMENTAL_WARNINGS // FPCGSplineStruct
+
+namespace PCGExPaths
+{
+	FSplineQuery::FSplineQuery(const FPCGSplineStruct& InSpline)
+		: Transform(InSpline.GetTransform())
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPaths::FSplineQuery::Build);
+
+		const FInterpCurveVector& Curve = InSpline.GetSplinePointsPosition();
+		const TArray<FInterpCurvePoint<FVector>>& Points = Curve.Points;
+
+		const int32 NumKeys = Points.Num();
+		const int32 NumSegments = NumKeys == 0 ? 0 : Curve.bIsLooped ? NumKeys : NumKeys - 1;
+
+		if (NumSegments <= 0)
+		{
+			return;
+		}
+
+		constexpr int32 Stride = SamplesPerSegment + 1;
+
+		Segments.SetNum(NumSegments);
+		SegmentBounds.Init(FBox(ForceInit), NumSegments);
+		Samples.SetNumUninitialized(NumSegments * Stride);
+
+		for (int32 s = 0; s < NumSegments; s++)
+		{
+			// Mirrors FInterpCurve::Eval for the segment between two consecutive keys (the last one wraps when looped)
+			const FInterpCurvePoint<FVector>& Prev = Points[s];
+			const bool bWraps = s + 1 >= NumKeys;
+			const FInterpCurvePoint<FVector>& Next = Points[bWraps ? 0 : s + 1];
+
+			FSegment& Segment = Segments[s];
+			Segment.StartKey = Prev.InVal;
+			Segment.KeyRange = (bWraps ? Prev.InVal + Curve.LoopKeyOffset : Next.InVal) - Prev.InVal;
+
+			const FVector& P0 = Prev.OutVal;
+			const FVector& P1 = Next.OutVal;
+
+			FBox& Box = SegmentBounds[s];
+			Box += P0;
+
+			Segment.D = P0;
+
+			if (Segment.KeyRange <= 0 || Prev.InterpMode == CIM_Constant)
+			{
+				// Stays on P0 for the whole segment
+			}
+			else if (Prev.InterpMode == CIM_Linear)
+			{
+				Segment.C = P1 - P0;
+				Box += P1;
+			}
+			else
+			{
+				const FVector T0 = Prev.LeaveTangent * Segment.KeyRange;
+				const FVector T1 = Next.ArriveTangent * Segment.KeyRange;
+
+				// Hermite to power basis
+				Segment.A = 2 * P0 + T0 + T1 - 2 * P1;
+				Segment.B = 3 * (P1 - P0) - 2 * T0 - T1;
+				Segment.C = T0;
+
+				// Bezier control points; the curve is within their convex hull
+				Box += P0 + T0 / 3;
+				Box += P1 - T1 / 3;
+				Box += P1;
+			}
+
+			FVector* SegmentSamples = Samples.GetData() + s * Stride;
+			for (int32 k = 0; k < Stride; k++) { SegmentSamples[k] = Segment.Eval(static_cast<double>(k) / SamplesPerSegment); }
+		}
+
+		SegmentOrder.SetNumUninitialized(NumSegments);
+		for (int32 i = 0; i < NumSegments; i++) { SegmentOrder[i] = i; }
+
+		Nodes.Reserve(2 * FMath::DivideAndRoundUp(NumSegments, MaxLeafSegments));
+		BuildNode(0, NumSegments);
+	}
+
+	int32 FSplineQuery::BuildNode(const int32 Start, const int32 Count)
+	{
+		const int32 NodeIndex = Nodes.Emplace();
+
+		FBox Bounds(ForceInit);
+		FBox Centers(ForceInit);
+		for (int32 i = Start; i < Start + Count; i++)
+		{
+			const FBox& SegmentBox = SegmentBounds[SegmentOrder[i]];
+			Bounds += SegmentBox;
+			Centers += SegmentBox.GetCenter();
+		}
+
+		Nodes[NodeIndex].Bounds = Bounds;
+
+		if (Count <= MaxLeafSegments)
+		{
+			Nodes[NodeIndex].Start = Start;
+			Nodes[NodeIndex].Count = Count;
+			return NodeIndex;
+		}
+
+		// Median split along the widest spread of segment centers
+		const FVector Size = Centers.GetSize();
+		const int32 Axis = Size.X >= Size.Y && Size.X >= Size.Z ? 0 : Size.Y >= Size.Z ? 1 : 2;
+
+		MakeArrayView(SegmentOrder.GetData() + Start, Count).Sort([&](const int32 A, const int32 B)
+		{
+			const double CA = SegmentBounds[A].GetCenter()[Axis];
+			const double CB = SegmentBounds[B].GetCenter()[Axis];
+			return CA == CB ? A < B : CA < CB;
+		});
+
+		const int32 Half = Count / 2;
+
+		// Nodes may reallocate while recursing, don't hold a reference across
+		const int32 Left = BuildNode(Start, Half);
+		const int32 Right = BuildNode(Start + Half, Count - Half);
+
+		Nodes[NodeIndex].Left = Left;
+		Nodes[NodeIndex].Right = Right;
+
+		return NodeIndex;
+	}
+
+	double FSplineQuery::SolveSegment(const int32 SegmentIndex, const FVector& LocalPosition, double& OutT) const
+	{
+		constexpr int32 Stride = SamplesPerSegment + 1;
+		const FVector* SegmentSamples = Samples.GetData() + SegmentIndex * Stride;
+
+		// Seed from the closest table sample
+		int32 BestSample = 0;
+		double BestDistSq = FVector::DistSquared(SegmentSamples[0], LocalPosition);
+		for (int32 k = 1; k < Stride; k++)
+		{
+			const double DistSq = FVector::DistSquared(SegmentSamples[k], LocalPosition);
+			if (DistSq < BestDistSq)
+			{
+				BestDistSq = DistSq;
+				BestSample = k;
+			}
+		}
+
+		OutT = static_cast<double>(BestSample) / SamplesPerSegment;
+
+		const FSegment& Segment = Segments[SegmentIndex];
+
+		// Newton on d/dt |P(t) - X|^2 = 0
+		double T = OutT;
+		for (int32 i = 0; i < 6; i++)
+		{
+			const FVector Delta = Segment.Eval(T) - LocalPosition;
+			const FVector D1 = (3 * Segment.A * T + 2 * Segment.B) * T + Segment.C;
+			const FVector D2 = 6 * Segment.A * T + 2 * Segment.B;
+
+			const double Denominator = FVector::DotProduct(D1, D1) + FVector::DotProduct(Delta, D2);
+			if (Denominator <= UE_SMALL_NUMBER)
+			{
+				break;
+			}
+
+			const double NextT = FMath::Clamp(T - FVector::DotProduct(Delta, D1) / Denominator, 0.0, 1.0);
+			const bool bConverged = FMath::Abs(NextT - T) < 1e-6;
+			T = NextT;
+
+			if (bConverged)
+			{
+				break;
+			}
+		}
+
+		// Never worse than the seed
+		const double DistSq = FVector::DistSquared(Segment.Eval(T), LocalPosition);
+		if (DistSq < BestDistSq)
+		{
+			OutT = T;
+			return DistSq;
+		}
+
+		return BestDistSq;
+	}
+
+	double FSplineQuery::FindInputKeyClosest(const FVector& WorldLocation) const
+	{
+		if (Segments.IsEmpty())
+		{
+			return 0;
+		}
+
+		const FVector LocalPosition = Transform.InverseTransformPosition(WorldLocation);
+
+		double BestDistSq = TNumericLimits<double>::Max();
+		int32 BestSegment = 0;
+		double BestT = 0;
+
+		// (Node, squared distance to its bounds)
+		TArray<TPair<int32, double>, TInlineAllocator<64>> Stack;
+		Stack.Emplace(0, Nodes[0].Bounds.ComputeSquaredDistanceToPoint(LocalPosition));
+
+		while (!Stack.IsEmpty())
+		{
+			const TPair<int32, double> Entry = Stack.Pop(EAllowShrinking::No);
+
+			// Ties are kept alive so the lowest segment index wins, like a linear scan would
+			if (Entry.Value > BestDistSq)
+			{
+				continue;
+			}
+
+			const FNode& Node = Nodes[Entry.Key];
+
+			if (Node.Count)
+			{
+				for (int32 i = Node.Start; i < Node.Start + Node.Count; i++)
+				{
+					const int32 SegmentIndex = SegmentOrder[i];
+					if (SegmentBounds[SegmentIndex].ComputeSquaredDistanceToPoint(LocalPosition) > BestDistSq)
+					{
+						continue;
+					}
+
+					double T = 0;
+					const double DistSq = SolveSegment(SegmentIndex, LocalPosition, T);
+					if (DistSq < BestDistSq || (DistSq == BestDistSq && SegmentIndex < BestSegment))
+					{
+						BestDistSq = DistSq;
+						BestSegment = SegmentIndex;
+						BestT = T;
+					}
+				}
+
+				continue;
+			}
+
+			const double LeftDistSq = Nodes[Node.Left].Bounds.ComputeSquaredDistanceToPoint(LocalPosition);
+			const double RightDistSq = Nodes[Node.Right].Bounds.ComputeSquaredDistanceToPoint(LocalPosition);
+
+			// Nearest child is popped first
+			if (LeftDistSq <= RightDistSq)
+			{
+				Stack.Emplace(Node.Right, RightDistSq);
+				Stack.Emplace(Node.Left, LeftDistSq);
+			}
+			else
+			{
+				Stack.Emplace(Node.Left, LeftDistSq);
+				Stack.Emplace(Node.Right, RightDistSq);
+			}
+		}
+
+		const FSegment& Segment = Segments[BestSegment];
+		return Segment.StartKey + BestT * Segment.KeyRange;
+	}
+}
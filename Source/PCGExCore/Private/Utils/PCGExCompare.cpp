@@ -185,6 +185,13 @@ namespace PCGExCompare
 
 	bool HasMatchingTags(const TSharedPtr<PCGExData::FTags>& InTags, const FString& Query, const EPCGExStringMatchMode MatchMode, const bool bStrict)
 	{
+		if (bStrict && MatchMode == EPCGExStringMatchMode::Equals)
+		{
+			// A tag nobody ever used can't be there; otherwise it's a lookup on interned ids
+			const PCGExData::FTagAtom Atom = PCGExData::TagAtoms::Find(Query);
+			return Atom != PCGExData::InvalidTagAtom && InTags->IsTagged(Atom);
+		}
+
 		if (bStrict)
 		{
 			for (const TPair<FString, TSharedPtr<PCGExData::IDataValue>>& Pair : InTags->ValueTags)
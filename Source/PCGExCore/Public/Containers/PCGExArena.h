@@ -0,0 +1,241 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Containers/ContainerAllocationPolicies.h"
+#include "HAL/CriticalSection.h"
+
+#ifndef PCGEX_ARENA_STATS
+#define PCGEX_ARENA_STATS !UE_BUILD_SHIPPING
+#endif
+
+namespace PCGExMT
+{
+	class FArenaPool;
+
+	/**
+	 * Single-owner bump allocator. Memory is carved linearly out of large blocks and only ever returned in bulk,
+	 * when the owning pool goes away. Never touched by two threads at once: a pool hands each running scope its own arena.
+	 */
+	class PCGEXCORE_API FArena
+	{
+		friend class FArenaPool;
+
+	public:
+		static constexpr SIZE_T BlockSize = 64 * 1024;
+
+		FArena() = default;
+		~FArena();
+
+		FArena(const FArena&) = delete;
+		FArena& operator=(const FArena&) = delete;
+
+		void* Allocate(SIZE_T InBytes, uint32 InAlignment);
+
+		/** Extend or shrink the most recent allocation without moving it. Fails if Ptr isn't the last allocation or the block is full. */
+		bool TryResizeInPlace(void* Ptr, SIZE_T InOldBytes, SIZE_T InNewBytes);
+
+		/** Give back the tail of the current block if Ptr is the most recent allocation; otherwise a no-op. */
+		void Free(void* Ptr, SIZE_T InBytes);
+
+	protected:
+		TArray<void*> Blocks;
+		uint8* Cursor = nullptr;
+		uint8* End = nullptr;
+
+		// Plain counters, folded into the global stats when the pool is destroyed
+		int64 NumAllocations = 0;
+		int64 NumInPlaceResizes = 0;
+		int64 AllocatedBytes = 0;
+		int64 ReservedBytes = 0;
+
+		void* AllocateBlock(SIZE_T InBytes);
+	};
+
+	/**
+	 * Set of arenas owned by a task group. Scopes acquire an arena while they run and hand it back once done, so arenas
+	 * are reused across scopes rather than created per task. Everything is freed at once when the last reference goes away:
+	 * the group drops its own when it completes, arena-backed containers hold one for as long as they own memory.
+	 */
+	class PCGEXCORE_API FArenaPool : public TSharedFromThis<FArenaPool>
+	{
+	public:
+		FArenaPool() = default;
+		~FArenaPool();
+
+		FArena* Acquire();
+		void Release(FArena* InArena);
+
+	protected:
+		FCriticalSection PoolLock;
+		TArray<TUniquePtr<FArena>> Arenas;
+		TArray<FArena*> Available;
+	};
+
+	/**
+	 * Binds an arena from the given pool to the calling thread for the lifetime of the scope.
+	 * Arena-backed containers allocating on that thread in the meantime draw from it; with no binding, they fall back to the heap.
+	 * Nests safely -- re-binding the pool already bound on this thread is a no-op.
+	 */
+	class PCGEXCORE_API FArenaScope
+	{
+	public:
+		explicit FArenaScope(FArenaPool* InPool);
+		~FArenaScope();
+
+		FArenaScope(const FArenaScope&) = delete;
+		FArenaScope& operator=(const FArenaScope&) = delete;
+
+	protected:
+		FArenaPool* Pool = nullptr;
+		FArena* Arena = nullptr;
+		FArenaPool* PreviousPool = nullptr;
+		FArena* PreviousArena = nullptr;
+	};
+
+	namespace Arena
+	{
+		PCGEXCORE_API FArenaPool* GetBoundPool();
+		PCGEXCORE_API FArena* GetBoundArena();
+
+		struct FStats
+		{
+			int64 NumPools = 0;
+			int64 NumArenas = 0;
+			int64 NumAllocations = 0;       // Allocations served by an arena
+			int64 NumInPlaceResizes = 0;    // Growths/shrinks that didn't move memory
+			int64 NumHeapFallbacks = 0;     // Allocations made with no arena bound
+			int64 AllocatedBytes = 0;       // Bytes handed out by arenas
+			int64 ReservedBytes = 0;        // Bytes arenas requested from the heap
+		};
+
+		/** Snapshot of the counters accumulated since startup or the last reset. Arena counters are only folded in when their pool is released. */
+		PCGEXCORE_API FStats GetStats();
+		PCGEXCORE_API void ResetStats();
+
+#if PCGEX_ARENA_STATS
+		PCGEXCORE_API void CountHeapFallback();
+#else
+		FORCEINLINE void CountHeapFallback()
+		{
+		}
+#endif
+	}
+
+	/**
+	 * TArray allocator policy drawing from the arena bound to the current thread (see FArenaScope).
+	 *
+	 * - Growth of the most recent allocation happens in place; otherwise it bump-allocates and copies.
+	 * - Freeing is a no-op beyond rolling back the tail, memory is reclaimed when the pool is released.
+	 * - Each container keeps the pool it allocated from alive, so it may safely outlive the task group.
+	 * - Allocations made with no arena bound go to the heap, and the container stays heap-backed until emptied.
+	 *
+	 * Meant for transient per-scope scratch that grows and is thrown away; long-lived data belongs on the heap.
+	 */
+	class FArenaAllocator
+	{
+	public:
+		using SizeType = int32;
+
+		enum { NeedsElementType = false };
+		enum { RequireRangeCheck = true };
+
+		class PCGEXCORE_API ForAnyElementType
+		{
+		public:
+			ForAnyElementType() = default;
+
+			~ForAnyElementType()
+			{
+				Release();
+			}
+
+			ForAnyElementType(const ForAnyElementType&) = delete;
+			ForAnyElementType& operator=(const ForAnyElementType&) = delete;
+
+			void MoveToEmpty(ForAnyElementType& Other);
+
+			FORCEINLINE FScriptContainerElement* GetAllocation() const { return Data; }
+
+			FORCEINLINE void ResizeAllocation(const SizeType CurrentNum, const SizeType NewMax, const SIZE_T NumBytesPerElement)
+			{
+				ResizeAllocation(CurrentNum, NewMax, NumBytesPerElement, DEFAULT_ALIGNMENT);
+			}
+
+			void ResizeAllocation(SizeType CurrentNum, SizeType NewMax, SIZE_T NumBytesPerElement, uint32 AlignmentOfElement);
+
+			FORCEINLINE SizeType CalculateSlackReserve(const SizeType NewMax, const SIZE_T NumBytesPerElement) const
+			{
+				return DefaultCalculateSlackReserve(NewMax, NumBytesPerElement, false);
+			}
+
+			FORCEINLINE SizeType CalculateSlackReserve(const SizeType NewMax, const SIZE_T NumBytesPerElement, const uint32 AlignmentOfElement) const
+			{
+				return DefaultCalculateSlackReserve(NewMax, NumBytesPerElement, false, AlignmentOfElement);
+			}
+
+			// Shrinking never gives memory back to an arena, no point moving data around for it
+			FORCEINLINE SizeType CalculateSlackShrink(const SizeType NewMax, const SizeType CurrentMax, const SIZE_T NumBytesPerElement) const
+			{
+				return Arena ? CurrentMax : DefaultCalculateSlackShrink(NewMax, CurrentMax, NumBytesPerElement, true);
+			}
+
+			FORCEINLINE SizeType CalculateSlackShrink(const SizeType NewMax, const SizeType CurrentMax, const SIZE_T NumBytesPerElement, const uint32 AlignmentOfElement) const
+			{
+				return Arena ? CurrentMax : DefaultCalculateSlackShrink(NewMax, CurrentMax, NumBytesPerElement, true, AlignmentOfElement);
+			}
+
+			FORCEINLINE SizeType CalculateSlackGrow(const SizeType NewMax, const SizeType CurrentMax, const SIZE_T NumBytesPerElement) const
+			{
+				return DefaultCalculateSlackGrow(NewMax, CurrentMax, NumBytesPerElement, false);
+			}
+
+			FORCEINLINE SizeType CalculateSlackGrow(const SizeType NewMax, const SizeType CurrentMax, const SIZE_T NumBytesPerElement, const uint32 AlignmentOfElement) const
+			{
+				return DefaultCalculateSlackGrow(NewMax, CurrentMax, NumBytesPerElement, false, AlignmentOfElement);
+			}
+
+			FORCEINLINE SIZE_T GetAllocatedSize(const SizeType CurrentMax, const SIZE_T NumBytesPerElement) const
+			{
+				return CurrentMax * NumBytesPerElement;
+			}
+
+			FORCEINLINE bool HasAllocation() const { return !!Data; }
+			FORCEINLINE SizeType GetInitialCapacity() const { return 0; }
+
+		protected:
+			FScriptContainerElement* Data = nullptr;
+			SIZE_T Bytes = 0;
+			FArena* Arena = nullptr;           // Null when heap-backed
+			TSharedPtr<FArenaPool> Pool;       // Keeps the arena memory alive while we point into it
+
+			void Release();
+		};
+
+		template <typename ElementType>
+		class ForElementType : public ForAnyElementType
+		{
+		public:
+			ForElementType() = default;
+
+			FORCEINLINE ElementType* GetAllocation() const
+			{
+				return reinterpret_cast<ElementType*>(ForAnyElementType::GetAllocation());
+			}
+		};
+	};
+
+	/** Scratch array backed by the task group's arena when allocated from within one of its scopes. */
+	template <typename T>
+	using TArenaArray = TArray<T, FArenaAllocator>;
+}
+
+template <>
+struct TAllocatorTraits<PCGExMT::FArenaAllocator> : TAllocatorTraitsBase<PCGExMT::FArenaAllocator>
+{
+	enum { SupportsMove = true };
+	enum { IsZeroConstruct = true };
+	enum { SupportsElementAlignment = true };
+};
@@ -7,6 +7,7 @@
 #include "CoreMinimal.h"
 #include "Containers/StaticArray.h"
 #include "Core/PCGExMTCommon.h"
+#include "Containers/PCGExArena.h"
 #include "Misc/ScopeRWLock.h"
 
 namespace PCGExMT
@@ -333,6 +334,43 @@ namespace PCGExMT
 		}
 	};
 
+	/**
+	 * Arena-backed flavor of TScopedArray, for per-scope scratch that's collapsed once the group is done.
+	 * Only useful when the owning FTaskGroup has bUseArena set; otherwise it behaves like a regular heap array.
+	 */
+	template <typename T>
+	class TScopedArenaArray final : public TSharedFromThis<TScopedArenaArray<T>>
+	{
+	public:
+		TArray<TArenaArray<T>> Arrays;
+
+		explicit TScopedArenaArray(const TArray<FScope>& InScopes)
+		{
+			Arrays.SetNum(InScopes.Num());
+		}
+
+		~TScopedArenaArray() = default;
+
+		FORCEINLINE TArenaArray<T>& Get_Ref(const FScope& InScope)
+		{
+			return Arrays[InScope.LoopIndex];
+		}
+
+		int32 GetTotalNum() const
+		{
+			int32 TotalNum = 0;
+			for (const TArenaArray<T>& Array : Arrays) { TotalNum += Array.Num(); }
+			return TotalNum;
+		}
+
+		void Collapse(TArray<T>& InTarget)
+		{
+			InTarget.Reserve(InTarget.Num() + GetTotalNum());
+			for (TArenaArray<T>& Array : Arrays) { InTarget.Append(MoveTemp(Array)); }
+			Arrays.Empty();
+		}
+	};
+
 	template <typename T>
 	class TScopedSet final : public TSharedFromThis<TScopedSet<T>>
 	{
@@ -28,6 +28,8 @@ struct FPCGExContext;
 
 namespace PCGExMT
 {
+	class FArenaPool;
+
 	PCGEXCORE_API
 	int32 GetSanitizedBatchSize(const int32 NumIterations, const int32 DesiredBatchSize);
 
@@ -314,6 +316,11 @@ namespace PCGExMT
 		using FSubLoopStartCallback = std::function<void(const FScope&)>;
 		FSubLoopStartCallback OnSubLoopStartCallback;
 
+		// When enabled, sub-loop preparation & scopes run with an arena bound to their thread so
+		// arena-backed containers (see PCGExArena.h) draw from it instead of the global heap.
+		// The group lets go of the arenas once its completion callback has run.
+		bool bUseArena = false;
+
 		explicit FTaskGroup(const FName InName);
 
 		template <typename T, typename... Args>
@@ -333,10 +340,7 @@ namespace PCGExMT
 			TArray<FScope> Loops;
 			const int32 NumLoops = SubLoopScopes(Loops, NumIterations, FMath::Max(1, GetSanitizedBatchSize(NumIterations, ChunkSize)));
 
-			if (OnPrepareSubLoopsCallback)
-			{
-				OnPrepareSubLoopsCallback(Loops);
-			}
+			PrepareSubLoops(Loops);
 
 			Launch(NumLoops, [&](int32 i)
 			{
@@ -364,7 +368,11 @@ namespace PCGExMT
 
 	protected:
 		TArray<FSimpleCallback> SimpleCallbacks;
+		TSharedPtr<FArenaPool> ArenaPool;
+
+		virtual void OnEnd(bool bWasCancelled) override;
 
+		void PrepareSubLoops(const TArray<FScope>& Loops);
 		void ExecScopeIteration(const FScope& Scope, bool bPrepareOnly) const;
 		void TriggerSimpleCallback(int32 Index);
 	};
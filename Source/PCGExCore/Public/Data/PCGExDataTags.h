@@ -34,10 +34,33 @@ namespace PCGExData
 {
 	const FString TagSeparator = TEXT(":");
 
+	/**
+	 * Interned tag name or value tag prefix. Ids are process-wide and never recycled; two names share an id
+	 * exactly when they compare equal as FString (case-insensitive), so id equality can stand in for string equality.
+	 */
+	using FTagAtom = uint32;
+	constexpr FTagAtom InvalidTagAtom = 0;
+
+	namespace TagAtoms
+	{
+		/** Id of a name, interning it on first use. */
+		PCGEXCORE_API FTagAtom Intern(const FString& InName);
+
+		/** Id of a name if it was ever interned, InvalidTagAtom otherwise. Never grows the table. */
+		PCGEXCORE_API FTagAtom Find(const FString& InName);
+
+		/** Name of an atom, as first interned. */
+		PCGEXCORE_API FString ToString(const FTagAtom InAtom);
+	}
+
 	class PCGEXCORE_API FTags : public TSharedFromThis<FTags>
 	{
 		mutable FRWLock TagsLock;
 
+		// Sorted atoms of RawTags and ValueTags keys, kept in sync by every mutation
+		TArray<FTagAtom> RawAtoms;
+		TArray<FTagAtom> KeyAtoms;
+
 	public:
 		TSet<FString> RawTags;                           // Contains all data tag
 		TMap<FString, TSharedPtr<IDataValue>> ValueTags; // Prefix:ValueTag
@@ -90,6 +113,7 @@ namespace PCGExData
 
 				const TSharedPtr<TDataValue<T>> ValueTag = MakeShared<TDataValue<T>>(Value);
 				ValueTags.Add(Key, ValueTag);
+				AddAtom(KeyAtoms, TagAtoms::Intern(Key));
 				return ValueTag;
 			}
 		}
@@ -143,8 +167,24 @@ namespace PCGExData
 		bool IsTagged(const FString& Key) const;
 		bool IsTagged(const FString& Key, const bool bInvert) const;
 
+		/** Whether the atom is a raw tag or a value tag prefix. No string hashing involved. */
+		bool IsTagged(const FTagAtom Atom) const;
+
+		/** Whether any raw tag is also a raw tag of Other, or any value tag prefix also a value tag prefix of Other. Values are ignored. */
+		bool SharesAnyTag(const FTags& Other) const;
+
+		/** Whether every raw tag and value tag prefix of Other is also found here. Values are ignored; true if Other is empty. */
+		bool HasAllTagsOf(const FTags& Other) const;
+
+		/** Sorted atoms of raw tags and value tag prefixes. */
+		void GetAtoms(TArray<FTagAtom>& OutRawAtoms, TArray<FTagAtom>& OutKeyAtoms) const;
+
 	protected:
 		void ParseAndAdd(const FString& InTag);
+		void RemoveUnsafe(const FString& Key);
+
+		static void AddAtom(TArray<FTagAtom>& InAtoms, const FTagAtom Atom);
+		static void RemoveAtom(TArray<FTagAtom>& InAtoms, const FTagAtom Atom);
 
 		// NAME:VALUE
 		static bool GetTagFromString(const FString& Input, FString& OutKey, FString& OutValue);
@@ -7,8 +7,8 @@
 
 #include "CoreMinimal.h"
 #include "PCGExH.h"
+#include "Algo/BinarySearch.h"
 #include "CompGeom/Delaunay2.h"
-#include "CompGeom/Delaunay3.h"
 
 struct FPCGExGeo2DProjectionDetails;
 
@@ -51,8 +51,14 @@ namespace PCGExMath::Geo
 	public:
 		TArray<FDelaunaySite2> Sites;
 
+		TArray<uint64> Edges; // Unique H64U edges, sorted
+		TArray<int32> Hull;   // Hull vertices, sorted
+
+		/** Also fill the legacy DelaunayEdges/DelaunayHull sets. Off by default, the flat arrays are cheaper to build and to walk. */
+		bool bMirrorToSets = false;
 		TSet<uint64> DelaunayEdges;
 		TSet<int32> DelaunayHull;
+
 		bool IsValid = false;
 
 		mutable FRWLock ProcessLock;
@@ -62,6 +68,7 @@ namespace PCGExMath::Geo
 
 	protected:
 		void Clear();
+		void MirrorToSets();
 
 		bool ProcessDelaunator(const std::vector<double>& Coords, const bool bComputeDelaunayEdges, const bool bComputeHull);
 		bool ProcessFallback(const TArray<FVector2D>& ProjectedPositions, const bool bComputeDelaunayEdges, const bool bComputeHull);
@@ -70,14 +77,19 @@ namespace PCGExMath::Geo
 		/**
 		 * Triangulate the given positions, projected onto a working plane.
 		 * Sites (triangles + adjacency + per-site hull flag) are always built.
-		 * @param bComputeDelaunayEdges Populate the DelaunayEdges set (unique undirected vtx pairs). Skip when only Sites/adjacency are needed.
-		 * @param bComputeHull Populate the DelaunayHull vertex set.
+		 * @param bComputeDelaunayEdges Populate Edges (unique undirected vtx pairs). Skip when only Sites/adjacency are needed.
+		 * @param bComputeHull Populate Hull.
 		 */
 		bool Process(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails, const bool bComputeDelaunayEdges = true, const bool bComputeHull = true);
 
 		/** Same as Process, but positions are already projected onto the working plane (X/Y planar, Z carried along) -- skips the internal projection pass. */
 		bool ProcessProjected(const TArrayView<FVector>& ProjectedPositions, const bool bComputeDelaunayEdges = true, const bool bComputeHull = true);
 
+		FORCEINLINE bool IsOnHull(const int32 Index) const
+		{
+			return Algo::BinarySearch(Hull, Index) != INDEX_NONE;
+		}
+
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions);
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions, TSet<uint64>& LongestEdges);
 
@@ -101,6 +113,12 @@ namespace PCGExMath::Geo
 	public:
 		TArray<FDelaunaySite3> Sites;
 
+		TArray<uint64> Edges;          // Unique H64U edges, sorted
+		TArray<int32> Hull;            // Hull vertices, sorted
+		TArray<FIntVector4> Neighbors; // Per site, the site across each of its Faces; -1 on the hull
+
+		/** Also fill the legacy DelaunayEdges/DelaunayHull/Adjacency containers. Off by default, the flat arrays are cheaper to build and to walk. */
+		bool bMirrorToSets = false;
 		TSet<uint64> DelaunayEdges;
 		TSet<int32> DelaunayHull;
 		TMap<uint32, uint64> Adjacency;
@@ -115,140 +133,23 @@ namespace PCGExMath::Geo
 
 	protected:
 		void Clear();
+		bool ProcessInternal(const TArrayView<FVector>& Positions, const bool bComputeAdjacency, const bool bComputeHull);
 
 	public:
+		/**
+		 * Tetrahedralize the given positions. Sites and the sorted Edges are always built.
+		 * @tparam bComputeAdjacency Fill Neighbors (and Adjacency, when mirroring to sets).
+		 * @tparam bComputeHull Fill Hull and per-site hull flags.
+		 */
 		template <bool bComputeAdjacency = false, bool bComputeHull = false>
 		bool Process(const TArrayView<FVector>& Positions)
 		{
-			Clear();
-			if (Positions.IsEmpty() || Positions.Num() <= 3)
-			{
-				return false;
-			}
-
-			UE::Geometry::FDelaunay3 Tetrahedralization;
-
-			if (!Tetrahedralization.Triangulate(Positions))
-			{
-				Clear();
-				return false;
-			}
-
-			IsValid = true;
-
-			TArray<FIntVector4> Tetrahedra = Tetrahedralization.GetTetrahedra();
-
-			const int32 NumSites = Tetrahedra.Num();
-			const int32 NumReserve = NumSites * 3;
-
-			DelaunayEdges.Reserve(NumReserve);
-
-			TSet<uint32> FacesUsage;
-			if constexpr (bComputeAdjacency)
-			{
-				Adjacency.Reserve(NumSites * 4);
-			}
-			if constexpr (bComputeHull)
-			{
-				FacesUsage.Reserve(NumSites);
-			}
-
-			//PCGExArrayHelpers::InitArray(Sites, NumSites);
-			Sites.SetNumUninitialized(NumSites);
-
-			for (int i = 0; i < NumSites; i++)
-			{
-				Sites[i] = FDelaunaySite3(Tetrahedra[i], i);
-				FDelaunaySite3& Site = Sites[i];
-
-				for (int a = 0; a < 4; a++)
-				{
-					for (int b = a + 1; b < 4; b++)
-					{
-						DelaunayEdges.Add(PCGEx::H64U(Site.Vtx[a], Site.Vtx[b]));
-					}
-				}
-
-				if constexpr (bComputeHull || bComputeAdjacency)
-				{
-					Site.ComputeFaces();
-				}
-
-				if constexpr (bComputeHull && bComputeAdjacency)
-				{
-					for (int f = 0; f < 4; f++)
-					{
-						const uint32 FH = Site.Faces[f];
-
-						bool bAlreadySet = false;
-						FacesUsage.Add(FH, &bAlreadySet);
-						if (bAlreadySet)
-						{
-							FacesUsage.Remove(FH);
-						}
-
-						if (const uint64* AH = Adjacency.Find(FH))
-						{
-							Adjacency.Add(FH, PCGEx::NH64(i, PCGEx::NH64B(*AH)));
-						}
-						else
-						{
-							Adjacency.Add(FH, PCGEx::NH64(-1, i));
-						}
-					}
-				}
-				else if constexpr (bComputeHull)
-				{
-					for (int f = 0; f < 4; f++)
-					{
-						const uint32 FH = Site.Faces[f];
-						bool bAlreadySet = false;
-						FacesUsage.Add(FH, &bAlreadySet);
-						if (bAlreadySet)
-						{
-							FacesUsage.Remove(FH);
-						}
-					}
-				}
-				else if constexpr (bComputeAdjacency)
-				{
-					for (int f = 0; f < 4; f++)
-					{
-						const uint32 FH = Site.Faces[f];
-						if (const uint64* AH = Adjacency.Find(FH))
-						{
-							Adjacency.Add(FH, PCGEx::NH64(i, PCGEx::NH64B(*AH)));
-						}
-						else
-						{
-							Adjacency.Add(FH, PCGEx::NH64(-1, i));
-						}
-					}
-				}
-			}
-
-			if constexpr (bComputeHull)
-			{
-				for (FDelaunaySite3& Site : Sites)
-				{
-					for (int f = 0; f < 4; f++)
-					{
-						if (FacesUsage.Contains(Site.Faces[f]))
-						{
-							for (int fi = 0; fi < 3; fi++)
-							{
-								DelaunayHull.Add(Site.Vtx[MTX[f][fi]]);
-							}
-							Site.bOnHull = true;
-						}
-					}
-				}
-			}
-
-			FacesUsage.Empty();
-			Tetrahedra.Empty();
-
-			return IsValid;
+			return ProcessInternal(Positions, bComputeAdjacency, bComputeHull);
+		}
+
+		FORCEINLINE bool IsOnHull(const int32 Index) const
+		{
+			return Algo::BinarySearch(Hull, Index) != INDEX_NONE;
 		}
 
 		void RemoveLongestEdges(const TArrayView<FVector>& Positions);
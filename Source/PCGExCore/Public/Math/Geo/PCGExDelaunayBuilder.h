@@ -0,0 +1,68 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExMath::Geo
+{
+	/**
+	 * Biased randomized insertion order (BRIO): points are dealt at random into rounds of doubling size,
+	 * each round sorted along a 3D Hilbert curve. Incremental insertion stays spatially coherent
+	 * while keeping the expected-case behavior of a random order. Deterministic for a given seed.
+	 */
+	PCGEXCORE_API void ComputeInsertionOrder(const TArrayView<FVector>& Positions, TArray<int32>& OutOrder, const int32 Seed = 0);
+
+	/**
+	 * Unique undirected edges of a simplicial mesh, as H64U hashes sorted in ascending order.
+	 * Every vertex pair within an element is an edge; Vertex(Element, k) returns the k-th of VerticesPerElement vertices.
+	 * Edges are bucketed under their higher vertex instead of hashed, so memory stays linear and there is no dedup set.
+	 */
+	PCGEXCORE_API void BuildSortedEdges(const int32 NumVertices, const int32 NumElements, const int32 VerticesPerElement, TFunctionRef<int32(int32, int32)> Vertex, TArray<uint64>& OutEdges);
+
+	/**
+	 * Flat tetrahedralization: tets are positively oriented, Neighbors[t][k] is the tet across the face
+	 * opposite vertex k, -1 on the hull. Neighbors are only filled on demand, see LinkNeighbors.
+	 */
+	class PCGEXCORE_API FDelaunayBuilder3
+	{
+	public:
+		TArray<FIntVector4> Tets;
+		TArray<FIntVector4> Neighbors;
+
+		/** Whether the last TriangulateParallel call had to fall back to a single serial pass. */
+		bool bUsedFallback = false;
+
+		/** Single UE::Geometry::FDelaunay3 pass over the positions, in input order. */
+		bool Triangulate(const TArrayView<FVector>& Positions);
+
+		/**
+		 * Partition-and-merge construction for large inputs:
+		 * - Points are split into kd-tree blocks of at least InMinBlockSize, each triangulated in parallel in BRIO order.
+		 * - Tets whose circumsphere fits strictly inside their own block can't contain foreign points and are kept as-is.
+		 * - The remaining vertices (block borders and local hulls) are triangulated together, and the tets that fill
+		 *   the space left between kept tets are stitched in.
+		 * The merged mesh is verified with exact predicates (manifold, convex hull, locally Delaunay).
+		 * When verification fails -- typically on co-spherical lattices, where block and border passes may disagree
+		 * on how to split a degenerate cell -- it falls back to Triangulate, so the result is always a valid Delaunay tetrahedralization.
+		 */
+		bool TriangulateParallel(const TArrayView<FVector>& Positions, const int32 InMinBlockSize = 32768);
+
+		/** Fill Neighbors from Tets. Returns false if a face is shared by more than two tets. */
+		bool LinkNeighbors(const int32 NumVertices);
+
+		/** Sorted unique H64U edges. */
+		void GetEdges(const int32 NumVertices, TArray<uint64>& OutEdges) const;
+
+		/**
+		 * Whether the hull faces form a closed, convex surface. Walks around each hull edge through the tets
+		 * to find the adjacent hull face. Tets with X == -1 are treated as free slots and ignored.
+		 * @param bRequireConnected Also require the hull to be a single connected surface.
+		 */
+		static bool IsHullConvex(const TArrayView<FVector>& Positions, const TArray<FIntVector4>& InTets, const TArray<FIntVector4>& InNeighbors, const bool bRequireConnected = false);
+
+	protected:
+		bool IsValidDelaunay(const TArrayView<FVector>& Positions) const;
+	};
+}
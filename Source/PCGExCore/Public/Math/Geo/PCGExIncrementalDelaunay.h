@@ -0,0 +1,72 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPCGExGeo2DProjectionDetails;
+
+namespace PCGExMath::Geo
+{
+	/**
+	 * 2D Delaunay triangulation kept alive across vertex relocations, e.g. relaxation iterations.
+	 * Update() checks the mesh is still a valid triangulation of the moved points (no flipped triangle, convex hull)
+	 * and restores the Delaunay property with Lawson edge flips. Whenever that isn't possible, it rebuilds from scratch.
+	 */
+	class PCGEXCORE_API FIncrementalDelaunay2
+	{
+	public:
+		TArray<FIntVector3> Triangles; // Counter-clockwise in projected space
+		TArray<FIntVector3> Neighbors; // Triangle across the edge opposite each vertex, -1 on the hull
+
+		int32 NumRebuilds = 0;
+		int32 NumFlips = 0;
+
+		FIncrementalDelaunay2() = default;
+
+		bool Build(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails);
+		bool Update(const TArrayView<FVector>& Positions, const FPCGExGeo2DProjectionDetails& ProjectionDetails);
+
+		/** Adds each triangle's centroid to its vertices' sum, and 1 to their count. */
+		void AccumulateCentroids(const TArrayView<FVector>& Positions, TArray<FVector>& InOutSum, TArray<double>& InOutCounts) const;
+
+	protected:
+		TArray<FVector2D> Projected;
+		bool bCanRepair = false; // False when the last build left vertices out or produced degenerate triangles
+
+		bool IsStillValid() const;
+		bool FlipToDelaunay();
+	};
+
+	/**
+	 * 3D counterpart of FIncrementalDelaunay2. Repairs with 2-3 and 3-2 flips; faces that can't be flipped are
+	 * retried as their surroundings change, and if any is left non-Delaunay once flipping settles, it rebuilds.
+	 * Slots freed by 3-2 flips stay in Tets with X == -1 until a later flip reuses them.
+	 */
+	class PCGEXCORE_API FIncrementalDelaunay3
+	{
+	public:
+		TArray<FIntVector4> Tets;      // Positively oriented
+		TArray<FIntVector4> Neighbors; // Tet across the face opposite each vertex, -1 on the hull
+
+		int32 NumRebuilds = 0;
+		int32 NumFlips = 0;
+
+		FIncrementalDelaunay3() = default;
+
+		bool Build(const TArrayView<FVector>& Positions);
+		bool Update(const TArrayView<FVector>& Positions);
+
+		/** Adds each tetrahedron's centroid to its vertices' sum, and 1 to their count. */
+		void AccumulateCentroids(const TArrayView<FVector>& Positions, TArray<FVector>& InOutSum, TArray<double>& InOutCounts) const;
+
+	protected:
+		TArray<int32> FreeTets;
+		bool bCanRepair = false; // False when the last build left vertices out or produced degenerate tetrahedra
+
+		bool IsStillValid(const TArrayView<FVector>& Positions) const;
+		bool FlipToDelaunay(const TArrayView<FVector>& Positions);
+		bool ReplaceTets(TConstArrayView<int32> InOld, TConstArrayView<FIntVector4> InNew, TArray<FIntPoint>& OutFaces);
+	};
+}
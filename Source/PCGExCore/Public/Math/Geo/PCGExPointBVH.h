@@ -0,0 +1,89 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExMath::Geo
+{
+	/**
+	 * Flat BVH over points, each tagged with a user index and a group.
+	 * Same layout as PCGExPaths::FPathEdgeBVH: Morton-ordered entries, tree built by halving that order.
+	 * Nodes know whether everything below them belongs to a single group, so group-exclusive queries
+	 * can skip whole subtrees. Read-only once built, except for RemapGroups.
+	 */
+	class PCGEXCORE_API FPointBVH
+	{
+	public:
+		static constexpr int32 MaxLeafEntries = 8;
+
+		struct FEntry
+		{
+			FVector Position = FVector::ZeroVector;
+			int32 Index = -1;
+			int32 Group = -1;
+		};
+
+		struct FNode
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Left = -1;
+			int32 Right = -1;
+			int32 Start = 0; // Leaf range in Entries, Count is 0 for inner nodes
+			int32 Count = 0;
+			int32 Group = -1; // Group shared by every entry below, -1 if mixed
+		};
+
+		FPointBVH() = default;
+		explicit FPointBVH(TArray<FEntry>&& InEntries);
+
+		FORCEINLINE int32 Num() const { return Entries.Num(); }
+		FORCEINLINE bool IsEmpty() const { return Entries.IsEmpty(); }
+		FORCEINLINE const TArray<FEntry>& GetEntries() const { return Entries; }
+		FORCEINLINE const TArray<FNode>& GetNodes() const { return Nodes; }
+
+		/** Replace every entry group by Remap(Group) and refresh node groups accordingly. */
+		void RemapGroups(TFunctionRef<int32(int32)> Remap);
+
+	protected:
+		TArray<FEntry> Entries;
+		TArray<FNode> Nodes;
+
+		int32 BuildNode(int32 Start, int32 Count);
+	};
+
+	struct FClosestPair
+	{
+		int32 A = -1; // Entry index in the first tree
+		int32 B = -1; // Entry index in the second tree
+		double DistSquared = TNumericLimits<double>::Max();
+
+		FORCEINLINE bool IsValid() const { return A != -1 && B != -1; }
+	};
+
+	/**
+	 * Exact closest pair between the points of two trees (dual-tree traversal, node pairs pruned on box distance).
+	 * Entries of B whose group is ExcludedGroup are ignored. InOutBest acts as an upper bound and is only replaced
+	 * by strictly closer pairs, so it can be chained across several queries.
+	 */
+	PCGEXCORE_API void FindClosestPair(const FPointBVH& A, const FPointBVH& B, FClosestPair& InOutBest, const int32 ExcludedGroup = -1);
+
+	struct FGroupBridge
+	{
+		int32 GroupA = -1;
+		int32 GroupB = -1;
+		int32 IndexA = -1; // FEntry::Index of the closest points
+		int32 IndexB = -1;
+	};
+
+	/**
+	 * Euclidean minimum spanning tree over point groups, where the distance between two groups
+	 * is the distance between their closest points -- one bridge per tree edge, NumGroups - 1 at most.
+	 * Borůvka rounds: every component looks up its closest foreign point through dual-tree queries
+	 * of its groups' trees against All, then components merge along those bridges.
+	 * @param Groups Per-group tree, entries tagged with the group index.
+	 * @param All Every point of every group, entries tagged with their group index. Groups get remapped.
+	 */
+	PCGEXCORE_API void FindGroupMST(const TArray<TSharedPtr<FPointBVH>>& Groups, FPointBVH& All, TArray<FGroupBridge>& OutBridges);
+}
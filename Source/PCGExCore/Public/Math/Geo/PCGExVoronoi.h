@@ -55,7 +55,7 @@ namespace PCGExMath::Geo
 	{
 	public:
 		TSharedPtr<TDelaunay3> Delaunay;
-		TSet<uint64> VoronoiEdges;
+		TArray<uint64> VoronoiEdges; // H64U site pairs, sorted
 		TSet<int32> VoronoiHull;
 		TArray<FSphere> Circumspheres;
 		TArray<FVector> Centroids;
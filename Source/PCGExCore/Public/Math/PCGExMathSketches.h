@@ -0,0 +1,89 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Fixed-memory summaries for very large inputs. Every sketch can be filled independently per scope
+ * and merged afterward; merging is order-independent for FHyperLogLog, and deterministic for a fixed merge order for FTDigest.
+ */
+namespace PCGExMath
+{
+	/**
+	 * HyperLogLog distinct count estimate, 2^14 one-byte registers (16KB), ~0.8% standard error.
+	 * Input hashes are remixed internally, so plain GetTypeHash values are fine.
+	 */
+	class PCGEXCORE_API FHyperLogLog
+	{
+	public:
+		static constexpr int32 Precision = 14;
+		static constexpr int32 NumRegisters = 1 << Precision;
+
+		FHyperLogLog();
+
+		FORCEINLINE void Add(uint64 Hash)
+		{
+			// splitmix64 finalizer
+			Hash ^= Hash >> 30;
+			Hash *= 0xbf58476d1ce4e5b9ULL;
+			Hash ^= Hash >> 27;
+			Hash *= 0x94d049bb133111ebULL;
+			Hash ^= Hash >> 31;
+
+			const uint32 Register = static_cast<uint32>(Hash >> (64 - Precision));
+			const uint8 Rank = static_cast<uint8>(FMath::CountLeadingZeros64((Hash << Precision) | (1ULL << (Precision - 1))) + 1);
+			if (Rank > Registers[Register]) { Registers[Register] = Rank; }
+		}
+
+		void Merge(const FHyperLogLog& Other);
+
+		double Estimate() const;
+
+	protected:
+		TArray<uint8> Registers;
+	};
+
+	/**
+	 * Merging t-digest (Dunning & Ertl): quantile estimates with bounded memory, most accurate toward the tails.
+	 * Roughly Compression centroids are kept; values are buffered and folded in by batches.
+	 */
+	class PCGEXCORE_API FTDigest
+	{
+	public:
+		explicit FTDigest(const double InCompression = 100);
+
+		FORCEINLINE void Add(const double Value, const double Weight = 1)
+		{
+			Buffer.Add(FCentroid{Value, Weight});
+			if (Buffer.Num() >= BufferSize) { Flush(); }
+		}
+
+		void Merge(const FTDigest& Other);
+
+		/** Estimated value at quantile Q in [0, 1]. 0 if nothing was added. */
+		double Quantile(const double Q);
+
+		FORCEINLINE double GetTotalWeight() const { return TotalWeight + BufferedWeight(); }
+
+	protected:
+		struct FCentroid
+		{
+			double Mean = 0;
+			double Weight = 0;
+		};
+
+		double Compression = 100;
+		int32 BufferSize = 0;
+		double TotalWeight = 0; // Weight folded into Centroids
+		double Min = TNumericLimits<double>::Max();
+		double Max = TNumericLimits<double>::Lowest();
+
+		TArray<FCentroid> Centroids;
+		TArray<FCentroid> Buffer;
+
+		double BufferedWeight() const;
+		void Flush();
+	};
+}
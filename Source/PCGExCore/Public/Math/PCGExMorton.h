@@ -0,0 +1,27 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExMath
+{
+	/** Spread the low 21 bits of V so that each lands on every third bit. */
+	FORCEINLINE uint64 SpreadBits3(uint64 V)
+	{
+		V &= 0x1FFFFF;
+		V = (V | V << 32) & 0x1F00000000FFFF;
+		V = (V | V << 16) & 0x1F0000FF0000FF;
+		V = (V | V << 8) & 0x100F00F00F00F00F;
+		V = (V | V << 4) & 0x10C30C30C30C30C3;
+		V = (V | V << 2) & 0x1249249249249249;
+		return V;
+	}
+
+	/** 3D Morton code from coordinates quantized to 21 bits per axis; higher bits are dropped. */
+	FORCEINLINE uint64 Morton3(const uint64 X, const uint64 Y, const uint64 Z)
+	{
+		return SpreadBits3(X) | SpreadBits3(Y) << 1 | SpreadBits3(Z) << 2;
+	}
+}
@@ -33,6 +33,8 @@ struct PCGEXCORE_API FPCGExCoreSettingsCache
 	bool bDefaultScopedAttributeGet = true;
 	bool bBulkInitData = false;
 	bool bUseDelaunator = true;
+	bool bParallelDelaunay = false;
+	int32 ParallelDelaunayThreshold = 200000;
 	bool bAssertOnEmptyThread = true;
 	bool bRuntimeAlwaysOffThread = false;
 
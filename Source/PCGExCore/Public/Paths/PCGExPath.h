@@ -67,6 +67,7 @@ namespace PCGExPaths
 	};
 
 	class FPath;
+	class FPathQueryGrid;
 
 	class PCGEXCORE_API IPathEdgeExtra : public TSharedFromThis<IPathEdgeExtra>
 	{
@@ -161,6 +162,7 @@ namespace PCGExPaths
 		bool bClosedLoop = false;
 		TConstPCGValueRange<FTransform> Positions;
 		TUniquePtr<FPathEdgeOctree> EdgeOctree;
+		TSharedPtr<FPathQueryGrid> QueryGrid;
 		TArray<TSharedPtr<IPathEdgeExtra>> Extras;
 
 		TArray<FVector2D> ProjectedPoints;
@@ -265,6 +267,18 @@ namespace PCGExPaths
 			return EdgeOctree.Get();
 		}
 
+		/**
+		 * Opt-in projected-space grid accelerating IsInsideProjection/Contains and polyline closest-edge queries.
+		 * Must be called once the projection is final (i.e after OffsetProjection); any later projection change discards it.
+		 * @param MinEdges Below this edge count a linear scan is cheaper, and no grid is built.
+		 */
+		void BuildQueryGrid(const int32 MinEdges = 32);
+
+		const FPathQueryGrid* GetQueryGrid() const
+		{
+			return QueryGrid.Get();
+		}
+
 		FORCEINLINE bool IsClosedLoop() const
 		{
 			return bClosedLoop;
@@ -0,0 +1,87 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExPaths
+{
+	class FPath;
+
+	/**
+	 * Single flat BVH over the edges of many paths, each entry tagged with the path it comes from.
+	 * Lets path-vs-path queries run one traversal against everything instead of one octree query per path.
+	 *
+	 * Entries are laid out in Morton order of their centers and the tree is built by halving that order,
+	 * so building is a radix sort plus a linear pass. Layout only depends on the input, not on threading.
+	 * Read-only once built, safe to query from any thread.
+	 */
+	class PCGEXCORE_API FPathEdgeBVH : public TSharedFromThis<FPathEdgeBVH>
+	{
+	public:
+		static constexpr int32 MaxLeafEntries = 8;
+
+		struct FEntry
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Path = -1; // Index in the path array the BVH was built from
+			int32 Edge = -1;
+		};
+
+		/**
+		 * @param InPaths Paths to index. Null entries are skipped but keep their index.
+		 * @param CanIndex Whether a given (path, edge) should be indexed. Zero-length edges are always skipped.
+		 */
+		FPathEdgeBVH(const TArray<TSharedPtr<FPath>>& InPaths, TFunctionRef<bool(int32, int32)> CanIndex);
+
+		FORCEINLINE int32 Num() const { return Entries.Num(); }
+		FORCEINLINE const TSharedPtr<FPath>& GetPath(const int32 Index) const { return Paths[Index]; }
+
+		/** Calls Callback(const FEntry&) for every indexed edge whose bounds intersect InBox. */
+		template <typename Func>
+		void FindOverlaps(const FBox& InBox, Func&& Callback) const
+		{
+			if (Nodes.IsEmpty() || !Nodes[0].Bounds.Intersect(InBox))
+			{
+				return;
+			}
+
+			TArray<int32, TInlineAllocator<64>> Stack;
+			Stack.Add(0);
+
+			while (!Stack.IsEmpty())
+			{
+				const FNode& Node = Nodes[Stack.Pop(EAllowShrinking::No)];
+
+				if (Node.Count)
+				{
+					for (int32 i = Node.Start; i < Node.Start + Node.Count; i++)
+					{
+						if (Entries[i].Bounds.Intersect(InBox)) { Callback(Entries[i]); }
+					}
+					continue;
+				}
+
+				if (Nodes[Node.Right].Bounds.Intersect(InBox)) { Stack.Add(Node.Right); }
+				if (Nodes[Node.Left].Bounds.Intersect(InBox)) { Stack.Add(Node.Left); }
+			}
+		}
+
+	protected:
+		struct FNode
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Left = -1;
+			int32 Right = -1;
+			int32 Start = 0; // Leaf range in Entries, Count is 0 for inner nodes
+			int32 Count = 0;
+		};
+
+		TArray<TSharedPtr<FPath>> Paths;
+		TArray<FEntry> Entries;
+		TArray<FNode> Nodes;
+
+		int32 BuildNode(int32 Start, int32 Count);
+	};
+}
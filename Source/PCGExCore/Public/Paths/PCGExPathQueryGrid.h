@@ -0,0 +1,74 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExPaths
+{
+	class FPath;
+
+	/**
+	 * Uniform grid laid over a path's projected space, used to accelerate per-point queries against long paths.
+	 *
+	 * Each cell keeps two CSR lists: the projected polygon edges overlapping it (containment, matches IsInsideProjection)
+	 * and the path edges overlapping it (closest-edge). Cells no polygon edge touches are pre-classified inside/outside,
+	 * so most containment tests resolve with a single lookup; the rest only test the handful of edges in their cell.
+	 * Closest-edge search walks rings of cells outward and stops as soon as the projected distance to the unvisited cells
+	 * exceeds the best 3D distance found -- the projection is orthonormal so this bound is exact.
+	 *
+	 * Snapshot of the projection at build time; it must be rebuilt if the projection changes.
+	 */
+	class PCGEXCORE_API FPathQueryGrid : public TSharedFromThis<FPathQueryGrid>
+	{
+	protected:
+		FVector2D Origin = FVector2D::ZeroVector;
+		double CellSize = 1;
+		double InvCellSize = 1;
+		int32 NumX = 1;
+		int32 NumY = 1;
+
+		TArray<FVector2D> PolygonPoints;   // Projected polygon, as tested by IsInsideProjection
+		TArray<FVector2D> PathPoints;      // Projected path positions, as used by edges
+		TArray<int8> CellCenterInside;     // Containment state at each cell center
+
+		TArray<int32> PolygonCellStart;
+		TArray<int32> PolygonCellItems;
+
+		TArray<int32> EdgeCellStart;
+		TArray<int32> EdgeCellItems;
+
+	public:
+		/**
+		 * @param InPath Path to index. Its projection & edges must be final.
+		 * @param CellsPerEdge Target cell count relative to the number of edges
+		 */
+		explicit FPathQueryGrid(const FPath& InPath, const double CellsPerEdge = 1);
+
+		bool IsInside(const FVector2D& InProjected) const;
+
+		/**
+		 * Exact equivalent of a linear closest-segment scan over all path edges (ties resolve to the lowest edge index).
+		 * @return Closest edge index, -1 if the path has no edges
+		 */
+		int32 FindClosestEdge(const FPath& InPath, const FVector& WorldPosition, double& OutDistSquared) const;
+
+		FORCEINLINE int32 GetNumCells() const { return NumX * NumY; }
+
+	protected:
+		FORCEINLINE int32 ToCol(const double X) const { return FMath::Clamp(FMath::FloorToInt32((X - Origin.X) * InvCellSize), 0, NumX - 1); }
+		FORCEINLINE int32 ToRow(const double Y) const { return FMath::Clamp(FMath::FloorToInt32((Y - Origin.Y) * InvCellSize), 0, NumY - 1); }
+
+		FORCEINLINE FVector2D GetCellCenter(const int32 Col, const int32 Row) const
+		{
+			return FVector2D(Origin.X + (Col + 0.5) * CellSize, Origin.Y + (Row + 0.5) * CellSize);
+		}
+
+		template <typename Func>
+		void ForEachSegmentCell(const FVector2D& A, const FVector2D& B, Func&& Callback) const;
+
+		void BuildCells(const TArray<FVector2D>& InPoints, const int32 NumSegments, TArray<int32>& OutStart, TArray<int32>& OutItems) const;
+		void ClassifyCells();
+	};
+}
@@ -30,6 +30,8 @@ namespace PCGExData
 
 namespace PCGExPaths
 {
+	class FSplineQuery;
+
 	class PCGEXCORE_API FPolyPath : public FPath
 	{
 		TArray<FTransform> LocalTransforms;
@@ -41,6 +43,9 @@ namespace PCGExPaths
 		// FPCGSplineStruct is synthesized.
 		bool bIsSplineBacked = false;
 
+		// Closest-point accelerator for the backing spline, only valid when bIsSplineBacked
+		TSharedPtr<FSplineQuery> SplineQuery;
+
 	public:
 		FPolyPath(
 			const TSharedPtr<PCGExData::FPointIO>& InPointIO,
@@ -73,6 +78,8 @@ namespace PCGExPaths
 		int32 ClosestEdgeLerp(const FVector& WorldPosition, float& OutLerp) const;
 		FTransform LerpEdgeTransform(const int32 EdgeIndex, const float Lerp, const bool bUseScale) const;
 
+		float FindSplineKeyClosest(const FVector& WorldPosition) const;
+
 	public:
 		virtual FTransform GetClosestTransform(const FVector& WorldPosition, int32& OutEdgeIndex, float& OutLerp, const bool bUseScale = false) const override;
 		virtual FTransform GetClosestTransform(const FVector& WorldPosition, float& OutAlpha, const bool bUseScale = false) const override;
@@ -0,0 +1,74 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPCGSplineStruct;
+
+namespace PCGExPaths
+{
+	/**
+	 * Closest-point accelerator for a spline, built once and queried from any thread.
+	 *
+	 * Each curve segment is flattened to its cubic polynomial and bounded by the box of its Bezier control points,
+	 * which always contains the curve. Segment boxes are organized in a BVH and visited nearest-first; a segment is
+	 * only solved if its box can still beat the best distance found so far. Solving a segment picks the closest entry
+	 * of a per-segment table of uniformly keyed samples, then refines it with a few Newton steps.
+	 *
+	 * Works in the spline's local space, same as FPCGSplineStruct::FindInputKeyClosestToWorldLocation, so it returns
+	 * the same key -- minus the float round-trip, and up to the precision of the refinement.
+	 */
+	class PCGEXCORE_API FSplineQuery : public TSharedFromThis<FSplineQuery>
+	{
+	public:
+		static constexpr int32 SamplesPerSegment = 8;
+		static constexpr int32 MaxLeafSegments = 4;
+
+		explicit FSplineQuery(const FPCGSplineStruct& InSpline);
+
+		FORCEINLINE int32 GetNumSegments() const { return Segments.Num(); }
+
+		/** Drop-in replacement for FPCGSplineStruct::FindInputKeyClosestToWorldLocation. */
+		double FindInputKeyClosest(const FVector& WorldLocation) const;
+
+	protected:
+		struct FSegment
+		{
+			// P(t) = ((A * t + B) * t + C) * t + D, t in [0, 1]
+			FVector A = FVector::ZeroVector;
+			FVector B = FVector::ZeroVector;
+			FVector C = FVector::ZeroVector;
+			FVector D = FVector::ZeroVector;
+
+			double StartKey = 0;
+			double KeyRange = 1;
+
+			FORCEINLINE FVector Eval(const double T) const { return ((A * T + B) * T + C) * T + D; }
+		};
+
+		struct FNode
+		{
+			FBox Bounds = FBox(ForceInit);
+			int32 Left = -1;
+			int32 Right = -1;
+			int32 Start = 0; // Leaf range in SegmentOrder, Count is 0 for inner nodes
+			int32 Count = 0;
+		};
+
+		FTransform Transform = FTransform::Identity;
+
+		TArray<FSegment> Segments;
+		TArray<FBox> SegmentBounds;
+		TArray<FVector> Samples; // (SamplesPerSegment + 1) per segment, endpoints included
+
+		TArray<FNode> Nodes;
+		TArray<int32> SegmentOrder;
+
+		int32 BuildNode(int32 Start, int32 Count);
+
+		/** Closest parameter on a single segment, returns the squared distance at that parameter. */
+		double SolveSegment(int32 SegmentIndex, const FVector& LocalPosition, double& OutT) const;
+	};
+}
@@ -0,0 +1,137 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGEx
+{
+	/**
+	 * Binary min-heap over a fixed set of item indices [0, NumItems), keyed on (Key, TieBreak).
+	 * Unlike FScoredQueue, keys can move in both directions and items can be removed from anywhere in the heap.
+	 * Ordering is strict as long as tie-breaks are unique, so pop order is fully deterministic.
+	 */
+	class FIndexedHeap
+	{
+	protected:
+		TArray<int32> Heap;     // Item indices, heap-ordered
+		TArray<int32> Position; // Item -> position in heap (-1 if not in heap)
+		TArray<double> Keys;
+		TArray<int32> TieBreaks;
+
+		FORCEINLINE bool Less(const int32 A, const int32 B) const
+		{
+			return Keys[A] < Keys[B] || (Keys[A] == Keys[B] && TieBreaks[A] < TieBreaks[B]);
+		}
+
+		FORCEINLINE void Place(const int32 Pos, const int32 Item)
+		{
+			Heap[Pos] = Item;
+			Position[Item] = Pos;
+		}
+
+		void SiftUp(int32 Pos)
+		{
+			const int32 Item = Heap[Pos];
+			while (Pos > 0)
+			{
+				const int32 ParentPos = (Pos - 1) >> 1;
+				const int32 ParentItem = Heap[ParentPos];
+				if (!Less(Item, ParentItem)) { break; }
+				Place(Pos, ParentItem);
+				Pos = ParentPos;
+			}
+			Place(Pos, Item);
+		}
+
+		void SiftDown(int32 Pos)
+		{
+			const int32 Size = Heap.Num();
+			const int32 Item = Heap[Pos];
+			while (true)
+			{
+				int32 Child = (Pos << 1) + 1;
+				if (Child >= Size) { break; }
+				if (Child + 1 < Size && Less(Heap[Child + 1], Heap[Child])) { Child++; }
+				if (!Less(Heap[Child], Item)) { break; }
+				Place(Pos, Heap[Child]);
+				Pos = Child;
+			}
+			Place(Pos, Item);
+		}
+
+	public:
+		explicit FIndexedHeap(const int32 NumItems)
+		{
+			Heap.Reserve(NumItems);
+			Position.Init(-1, NumItems);
+			Keys.Init(0, NumItems);
+			TieBreaks.Init(0, NumItems);
+		}
+
+		FORCEINLINE bool IsEmpty() const { return Heap.IsEmpty(); }
+		FORCEINLINE int32 Num() const { return Heap.Num(); }
+		FORCEINLINE bool Contains(const int32 Item) const { return Position[Item] != -1; }
+		FORCEINLINE double GetKey(const int32 Item) const { return Keys[Item]; }
+
+		/** Items currently in the heap, in heap order. */
+		FORCEINLINE const TArray<int32>& GetItems() const { return Heap; }
+
+		void Push(const int32 Item, const double InKey, const int32 InTieBreak)
+		{
+			check(!Contains(Item))
+			Keys[Item] = InKey;
+			TieBreaks[Item] = InTieBreak;
+			Position[Item] = Heap.Add(Item);
+			SiftUp(Position[Item]);
+		}
+
+		/** Change the key of an item already in the heap, in either direction. */
+		void Update(const int32 Item, const double InKey)
+		{
+			const int32 Pos = Position[Item];
+			check(Pos != -1)
+
+			const double PrevKey = Keys[Item];
+			Keys[Item] = InKey;
+
+			if (InKey < PrevKey) { SiftUp(Pos); }
+			else if (InKey > PrevKey) { SiftDown(Pos); }
+		}
+
+		/** Change a key without restoring heap order. Follow up with Rebuild() once all keys are set. */
+		FORCEINLINE void SetKeyUnordered(const int32 Item, const double InKey) { Keys[Item] = InKey; }
+
+		/** Restore heap order from scratch, O(n). Cheaper than n updates once most keys have changed. */
+		void Rebuild()
+		{
+			for (int32 i = (Heap.Num() >> 1) - 1; i >= 0; i--) { SiftDown(i); }
+		}
+
+		int32 Pop()
+		{
+			check(!Heap.IsEmpty())
+			const int32 Top = Heap[0];
+			Remove(Top);
+			return Top;
+		}
+
+		FORCEINLINE int32 Peek() const { return Heap[0]; }
+
+		void Remove(const int32 Item)
+		{
+			const int32 Pos = Position[Item];
+			if (Pos == -1) { return; }
+
+			Position[Item] = -1;
+
+			const int32 Last = Heap.Pop(EAllowShrinking::No);
+			if (Last == Item) { return; }
+
+			Place(Pos, Last);
+			if (Pos > 0 && Less(Last, Heap[(Pos - 1) >> 1])) { SiftUp(Pos); }
+			else { SiftDown(Pos); }
+		}
+	};
+}
@@ -14,6 +14,45 @@
 
 PCG_DEFINE_TYPE_INFO(FPCGExDataTypeInfoNeighborSampler, UPCGExNeighborSamplerFactoryData)
 
+namespace PCGExNeighborSample
+{
+	FTraversal::FTraversal(const int32 NumNodes)
+	{
+		Current.Reserve(32);
+		Next.Reserve(32);
+		Stamps.Init(0, NumNodes);
+	}
+
+	void FTraversal::Begin()
+	{
+		if (++Epoch == 0)
+		{
+			// Wrapped around, old stamps could alias the new epoch
+			FMemory::Memzero(Stamps.GetData(), Stamps.Num() * sizeof(uint32));
+			Epoch = 1;
+		}
+	}
+
+	TSharedPtr<FTraversal> FTraversalPool::Acquire()
+	{
+		{
+			FScopeLock Lock(&PoolLock);
+			if (!Available.IsEmpty())
+			{
+				return Available.Pop(EAllowShrinking::No);
+			}
+		}
+
+		return MakeShared<FTraversal>(NumNodes);
+	}
+
+	void FTraversalPool::Release(const TSharedPtr<FTraversal>& InTraversal)
+	{
+		FScopeLock Lock(&PoolLock);
+		Available.Add(InTraversal);
+	}
+}
+
 void FPCGExSamplingConfig::Init()
 {
 	WeightLUT = WeightCurveLookup.MakeLookup(bUseLocalCurve, LocalWeightCurve, WeightCurve);
@@ -39,6 +78,18 @@ void FPCGExNeighborSampleOperation::PrepareForCluster(FPCGExContext* InContext,
 		ValueFilters->SetSupportedTypes(&PCGExFactories::ClusterNodeFilters());
 		ValueFilters->Init(InContext, ValueFilterFactories);
 	}
+
+	// The traversal always goes one level past SafeMaxDepth at most
+	SafeMaxDepth = FMath::Min(1, SamplingConfig.MaxDepth);
+
+	DepthWeights.Init(0, SafeMaxDepth + 2);
+	if (SamplingConfig.BlendOver != EPCGExBlendOver::Distance)
+	{
+		for (int32 Depth = 1; Depth < DepthWeights.Num(); Depth++)
+		{
+			DepthWeights[Depth] = WeightLUT->Eval(SamplingConfig.BlendOver == EPCGExBlendOver::Index ? 1 - (Depth / FMath::Max(1, SafeMaxDepth)) : SamplingConfig.FixedBlend);
+		}
+	}
 }
 
 bool FPCGExNeighborSampleOperation::IsOperationValid()
@@ -61,7 +112,7 @@ void FPCGExNeighborSampleOperation::PrepareForLoops(const TArray<PCGExMT::FScope
 	// Do pre-allocation here
 }
 
-void FPCGExNeighborSampleOperation::ProcessNode(const int32 NodeIndex, const PCGExMT::FScope& Scope)
+void FPCGExNeighborSampleOperation::ProcessNode(const int32 NodeIndex, const PCGExMT::FScope& Scope, PCGExNeighborSample::FTraversal& Traversal)
 {
 	const PCGExClusters::FNode& Node = (*Cluster->Nodes)[NodeIndex];
 
@@ -74,20 +125,64 @@ void FPCGExNeighborSampleOperation::ProcessNode(const int32 NodeIndex, const PCG
 	int32 Count = 0;
 	double TotalWeight = 0;
 
-	const TUniquePtr<TArray<PCGExGraphs::FLink>> A = MakeUnique<TArray<PCGExGraphs::FLink>>();
-	const TUniquePtr<TArray<PCGExGraphs::FLink>> B = MakeUnique<TArray<PCGExGraphs::FLink>>();
-
-	TArray<PCGExGraphs::FLink>* CurrentNeighbors = A.Get();
-	TArray<PCGExGraphs::FLink>* NextNeighbors = B.Get();
-	TSet<int32> VisitedNodes;
-
-	VisitedNodes.Add(NodeIndex);
-	CurrentNeighbors->Append(Node.Links);
+	const bool bSampleVtx = SamplingConfig.NeighborSource == EPCGExClusterElement::Vtx;
+	const bool bOverDistance = SamplingConfig.BlendOver == EPCGExBlendOver::Distance;
 
 	PrepareNode(Node, Scope);
 	const FVector Origin = Cluster->GetPos(Node);
 
-	const int32 SafeMaxDepth = FMath::Min(1, SamplingConfig.MaxDepth);
+	auto Sample = [&](const PCGExGraphs::FLink Lk)
+	{
+		double LocalWeight;
+
+		if (bOverDistance)
+		{
+			const double Dist = FVector::Dist(Origin, Cluster->GetPos(Lk)); // Use Neighbor.FromNode to accumulate per-path distance 
+			if (Dist > SamplingConfig.MaxDistance)
+			{
+				return;
+			}
+			LocalWeight = WeightLUT->Eval(1 - (Dist / SamplingConfig.MaxDistance));
+		}
+		else
+		{
+			LocalWeight = DepthWeights[CurrentDepth];
+		}
+
+		if (bSampleVtx)
+		{
+			SampleNeighborNode(Node, Lk, LocalWeight, Scope);
+		}
+		else
+		{
+			SampleNeighborEdge(Node, Lk, LocalWeight, Scope);
+		}
+
+		Count++;
+		TotalWeight += LocalWeight;
+	};
+
+	// Direct neighbors only, nothing to keep track of
+	if (SamplingConfig.MaxDepth <= 1)
+	{
+		CurrentDepth = 1;
+		for (const PCGExGraphs::FLink Lk : Node.Links)
+		{
+			Sample(Lk);
+		}
+
+		FinalizeNode(Node, Count, TotalWeight, Scope);
+		return;
+	}
+
+	Traversal.Begin();
+
+	TArray<PCGExGraphs::FLink>* CurrentNeighbors = &Traversal.Current;
+	TArray<PCGExGraphs::FLink>* NextNeighbors = &Traversal.Next;
+
+	Traversal.MarkVisited(NodeIndex);
+	CurrentNeighbors->Reset();
+	CurrentNeighbors->Append(Node.Links);
 
 	while (CurrentDepth <= SafeMaxDepth)
 	{
@@ -99,36 +194,8 @@ void FPCGExNeighborSampleOperation::ProcessNode(const int32 NodeIndex, const PCG
 
 		for (const PCGExGraphs::FLink Lk : (*CurrentNeighbors))
 		{
-			VisitedNodes.Add(Lk.Node);
-			double LocalWeight;
-
-			if (SamplingConfig.BlendOver == EPCGExBlendOver::Distance)
-			{
-				const double Dist = FVector::Dist(Origin, Cluster->GetPos(Lk)); // Use Neighbor.FromNode to accumulate per-path distance 
-				if (Dist > SamplingConfig.MaxDistance)
-				{
-					continue;
-				}
-				LocalWeight = 1 - (Dist / SamplingConfig.MaxDistance);
-			}
-			else
-			{
-				LocalWeight = SamplingConfig.BlendOver == EPCGExBlendOver::Index ? 1 - (CurrentDepth / SafeMaxDepth) : SamplingConfig.FixedBlend;
-			}
-
-			LocalWeight = WeightLUT->Eval(LocalWeight);
-
-			if (SamplingConfig.NeighborSource == EPCGExClusterElement::Vtx)
-			{
-				SampleNeighborNode(Node, Lk, LocalWeight, Scope);
-			}
-			else
-			{
-				SampleNeighborEdge(Node, Lk, LocalWeight, Scope);
-			}
-
-			Count++;
-			TotalWeight += LocalWeight;
+			Traversal.MarkVisited(Lk.Node);
+			Sample(Lk);
 		}
 
 		if (CurrentDepth >= SamplingConfig.MaxDepth)
@@ -147,13 +214,13 @@ void FPCGExNeighborSampleOperation::ProcessNode(const int32 NodeIndex, const PCG
 				for (const PCGExGraphs::FLink Next : Neighbors)
 				{
 					int32 NextIndex = Next.Node;
-					if (VisitedNodes.Contains(NextIndex))
+					if (Traversal.IsVisited(NextIndex))
 					{
 						continue;
 					}
 					if (!ValueFilters->Results[Cluster->GetNodePointIndex(Next)])
 					{
-						VisitedNodes.Add(NextIndex);
+						Traversal.MarkVisited(NextIndex);
 						continue;
 					}
 					NextNeighbors->Add(Next);
@@ -163,7 +230,7 @@ void FPCGExNeighborSampleOperation::ProcessNode(const int32 NodeIndex, const PCG
 			{
 				for (const PCGExGraphs::FLink Next : Neighbors)
 				{
-					if (VisitedNodes.Contains(Next.Node))
+					if (Traversal.IsVisited(Next.Node))
 					{
 						continue;
 					}
@@ -122,6 +122,8 @@ namespace PCGExSampleNeighbors
 
 		Cluster->ComputeEdgeLengths();
 
+		TraversalPool = MakeShared<PCGExNeighborSample::FTraversalPool>(NumNodes);
+
 		if (!OpsWithValueTest.IsEmpty())
 		{
 			StartParallelLoopForRange(NumNodes);
@@ -161,6 +163,9 @@ namespace PCGExSampleNeighbors
 
 	void FProcessor::ProcessNodes(const PCGExMT::FScope& Scope)
 	{
+		const TSharedPtr<PCGExNeighborSample::FTraversal> Traversal = TraversalPool->Acquire();
+		ON_SCOPE_EXIT { TraversalPool->Release(Traversal); };
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			if (VtxFiltersManager && !VtxFiltersManager->Test(*Cluster->GetNode(Index)))
@@ -169,7 +174,7 @@ namespace PCGExSampleNeighbors
 			}
 			for (const TSharedPtr<FPCGExNeighborSampleOperation>& Op : SamplingOperations)
 			{
-				Op->ProcessNode(Index, Scope);
+				Op->ProcessNode(Index, Scope, *Traversal.Get());
 			}
 		}
 	}
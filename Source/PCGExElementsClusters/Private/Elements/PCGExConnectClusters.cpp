@@ -8,7 +8,9 @@
 #include "Data/PCGExData.h"
 #include "Data/PCGExDataTags.h"
 #include "Data/PCGExPointIO.h"
+#include "Core/PCGExMTCommon.h"
 #include "Math/Geo/PCGExDelaunay.h"
+#include "Math/Geo/PCGExPointBVH.h"
 #include "Utils/PCGExPointIOMerger.h"
 #include "Graphs/PCGExGraphPatcher.h"
 
@@ -118,7 +120,16 @@ namespace PCGExConnectClusters
 			return false;
 		}
 
-		Cluster->GetNodeOctree();
+		const TArray<PCGExClusters::FNode>& Nodes = *Cluster->Nodes;
+
+		TArray<PCGExMath::Geo::FPointBVH::FEntry> Entries;
+		Entries.SetNumUninitialized(Nodes.Num());
+		for (int32 i = 0; i < Nodes.Num(); i++)
+		{
+			Entries[i] = PCGExMath::Geo::FPointBVH::FEntry{Cluster->GetPos(Nodes[i]), Nodes[i].PointIndex, -1};
+		}
+
+		NodeBVH = MakeShared<PCGExMath::Geo::FPointBVH>(MoveTemp(Entries));
 
 		return true;
 	}
@@ -151,6 +162,14 @@ namespace PCGExConnectClusters
 			return;
 		} // Skip work completion entirely
 
+		ValidNodeBVHs.Reset(NumValidClusters);
+		for (int32 i = 0; i < Processors.Num(); i++)
+		{
+			if (!Processors[i]->Cluster) { continue; }
+			const TSharedPtr<PCGExMath::Geo::FPointBVH>& NodeBVH = GetProcessor<FProcessor>(i)->NodeBVH;
+			ValidNodeBVHs.Add(NodeBVH ? NodeBVH : MakeShared<PCGExMath::Geo::FPointBVH>());
+		}
+
 		// Register every valid cluster's edge group with the patcher (group index == ValidClusters index).
 		Patcher = MakeShared<PCGExGraphs::FGraphPatcher>(VtxDataFacade);
 		for (const TSharedPtr<PCGExClusters::FCluster>& Cl : ValidClusters)
@@ -198,7 +217,7 @@ namespace PCGExConnectClusters
 
 			if (Delaunay->Process<false, false>(Positions))
 			{
-				Bridges.Append(Delaunay->DelaunayEdges);
+				Bridges.Append(Delaunay->Edges);
 			}
 			else
 			{
@@ -219,10 +238,10 @@ namespace PCGExConnectClusters
 				Positions[i] = Bounds[i].GetCenter();
 			}
 
-			// Only DelaunayEdges are consumed; skip hull extraction.
+			// Only Edges are consumed; skip hull extraction.
 			if (Delaunay->Process(Positions, Context->ProjectionDetails, true, false))
 			{
-				Bridges.Append(Delaunay->DelaunayEdges);
+				Bridges.Append(Delaunay->Edges);
 			}
 			else
 			{
@@ -231,84 +250,54 @@ namespace PCGExConnectClusters
 
 			Positions.Empty();
 		}
-		else if (SafeMethod == EPCGExBridgeClusterMethod::LeastEdges)
-		{
-			// Minimum spanning tree (Prim's, O(NumBounds^2)) so the clusters are connected with the
-			// globally-shortest set of bridges. Weight = distance between cluster bounds centers.
-			if (NumBounds > 1)
-			{
-				TArray<bool> InTree;
-				InTree.Init(false, NumBounds);
-				TArray<double> BestDist;
-				BestDist.Init(TNumericLimits<double>::Max(), NumBounds);
-				TArray<int32> BestFrom;
-				BestFrom.Init(-1, NumBounds);
-
-				// Seed the tree with cluster 0, then grow it one nearest cluster at a time.
-				InTree[0] = true;
-				for (int j = 1; j < NumBounds; j++)
-				{
-					BestDist[j] = FVector::DistSquared(Bounds[0].GetCenter(), Bounds[j].GetCenter());
-					BestFrom[j] = 0;
-				}
-
-				for (int Added = 1; Added < NumBounds; Added++)
-				{
-					int32 Next = -1;
-					double NextDist = TNumericLimits<double>::Max();
-					for (int j = 0; j < NumBounds; j++)
-					{
-						if (!InTree[j] && BestDist[j] < NextDist)
-						{
-							NextDist = BestDist[j];
-							Next = j;
-						}
-					}
-					if (Next == -1) { break; } // disconnected guard (shouldn't happen with finite distances)
-
-					InTree[Next] = true;
-					Bridges.Add(PCGEx::H64(BestFrom[Next], Next));
-
-					// Relax remaining clusters against the one just added.
-					for (int j = 0; j < NumBounds; j++)
-					{
-						if (InTree[j]) { continue; }
-						if (const double Dist = FVector::DistSquared(Bounds[Next].GetCenter(), Bounds[j].GetCenter());
-							Dist < BestDist[j])
-						{
-							BestDist[j] = Dist;
-							BestFrom[j] = Next;
-						}
-					}
-				}
-			}
-		}
 		else if (SafeMethod == EPCGExBridgeClusterMethod::MostEdges)
 		{
 			for (int i = 0; i < NumBounds; i++)
 			{
-				for (int j = 0; j < NumBounds; j++)
+				for (int j = i + 1; j < NumBounds; j++)
 				{
-					if (i == j)
-					{
-						continue;
-					}
 					Bridges.Add(PCGEx::H64U(i, j));
 				}
 			}
 		}
 
-		// Resolve each connected cluster pair to its closest vtx pair and stage a bridge edge.
-		BridgesList = Bridges.Array();
-		BridgeEdgeHandles.Reset(BridgesList.Num());
-		BridgeEndpoints.Reset(BridgesList.Num());
-		for (const uint64 BridgeHash : BridgesList)
+		TArray<uint64> Endpoints;
+
+		if (SafeMethod == EPCGExBridgeClusterMethod::LeastEdges)
+		{
+			// Endpoints come straight out of the spanning tree
+			FindMinimumBridges(Endpoints);
+		}
+		else
 		{
-			int32 VtxA = -1;
-			int32 VtxB = -1;
-			if (!FindClosestVtxPair(PCGEx::H64A(BridgeHash), PCGEx::H64B(BridgeHash), VtxA, VtxB)) { continue; }
-			BridgeEdgeHandles.Add(Patcher->AddEdge(VtxA, VtxB));
-			BridgeEndpoints.Add(PCGEx::H64(VtxA, VtxB));
+			// Resolve each connected cluster pair to its closest vtx pair
+			BridgesList = Bridges.Array();
+
+			TArray<int8> Resolved;
+			Resolved.Init(0, BridgesList.Num());
+			Endpoints.SetNumUninitialized(BridgesList.Num());
+
+			PCGEX_PARALLEL_FOR(
+				BridgesList.Num(),
+				int32 VtxA = -1;
+				int32 VtxB = -1;
+				if (!FindClosestVtxPair(PCGEx::H64A(BridgesList[i]), PCGEx::H64B(BridgesList[i]), VtxA, VtxB)) { return; }
+				Endpoints[i] = PCGEx::H64(VtxA, VtxB);
+				Resolved[i] = 1;
+				)
+
+			int32 NumResolved = 0;
+			for (int32 i = 0; i < Endpoints.Num(); i++) { if (Resolved[i]) { Endpoints[NumResolved++] = Endpoints[i]; } }
+			Endpoints.SetNum(NumResolved);
+		}
+
+		// Stage a bridge edge for each vtx pair
+		BridgeEdgeHandles.Reset(Endpoints.Num());
+		BridgeEndpoints.Reset(Endpoints.Num());
+		for (const uint64 Endpoint : Endpoints)
+		{
+			BridgeEdgeHandles.Add(Patcher->AddEdge(PCGEx::H64A(Endpoint), PCGEx::H64B(Endpoint)));
+			BridgeEndpoints.Add(Endpoint);
 		}
 
 		// Components -> merged edge IOs (async; ready by Write). ConnectClusters links existing vtx
@@ -335,45 +324,55 @@ namespace PCGExConnectClusters
 
 	bool FBatch::FindClosestVtxPair(const int32 FromClusterIndex, const int32 ToClusterIndex, int32& OutVtxA, int32& OutVtxB) const
 	{
-		const TSharedPtr<PCGExClusters::FCluster> ClusterA = ValidClusters[FromClusterIndex];
-		const TSharedPtr<PCGExClusters::FCluster> ClusterB = ValidClusters[ToClusterIndex];
-
-		OutVtxA = -1;
-		OutVtxB = -1;
-		double Distance = TNumericLimits<double>::Max();
+		const PCGExMath::Geo::FPointBVH& TreeA = *ValidNodeBVHs[FromClusterIndex];
+		const PCGExMath::Geo::FPointBVH& TreeB = *ValidNodeBVHs[ToClusterIndex];
 
-		const TArray<PCGExClusters::FNode>& NodesRefA = *ClusterA->Nodes;
-		const TArray<PCGExClusters::FNode>& NodesRefB = *ClusterB->Nodes;
+		PCGExMath::Geo::FClosestPair Pair;
+		PCGExMath::Geo::FindClosestPair(TreeA, TreeB, Pair);
 
-		auto Consider = [&](const PCGExClusters::FNode& NodeA, const FVector& PosA, const PCGExClusters::FNode& NodeB)
+		if (!Pair.IsValid())
 		{
-			if (const double Dist = FVector::DistSquared(PosA, ClusterB->GetPos(NodeB));
-				Dist < Distance)
-			{
-				OutVtxA = NodeA.PointIndex;
-				OutVtxB = NodeB.PointIndex;
-				Distance = Dist;
-			}
-		};
+			OutVtxA = -1;
+			OutVtxB = -1;
+			return false;
+		}
 
-		for (const PCGExClusters::FNode& NodeA : NodesRefA)
-		{
-			const FVector PosA = ClusterA->GetPos(NodeA);
+		OutVtxA = TreeA.GetEntries()[Pair.A].Index;
+		OutVtxB = TreeB.GetEntries()[Pair.B].Index;
+		return true;
+	}
 
-			// FindClosestNode is a bounded octree query: it returns INDEX_NONE when PosA lies outside B's
-			// populated cells (clusters far apart). On a miss, brute-force B -- never index with INDEX_NONE.
-			const int32 ClosestBIdx = ClusterB->FindClosestNode(PosA);
-			if (NodesRefB.IsValidIndex(ClosestBIdx))
-			{
-				Consider(NodeA, PosA, NodesRefB[ClosestBIdx]);
-			}
-			else
+	void FBatch::FindMinimumBridges(TArray<uint64>& OutEndpoints)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExConnectClusters::FindMinimumBridges);
+
+		// One tree over every node of every cluster, tagged with the cluster index
+		int32 NumNodes = 0;
+		for (const TSharedPtr<PCGExMath::Geo::FPointBVH>& Tree : ValidNodeBVHs) { NumNodes += Tree->Num(); }
+
+		TArray<PCGExMath::Geo::FPointBVH::FEntry> Entries;
+		Entries.Reserve(NumNodes);
+		for (int32 c = 0; c < ValidNodeBVHs.Num(); c++)
+		{
+			for (const PCGExMath::Geo::FPointBVH::FEntry& Entry : ValidNodeBVHs[c]->GetEntries())
 			{
-				for (const PCGExClusters::FNode& NodeB : NodesRefB) { Consider(NodeA, PosA, NodeB); }
+				Entries.Add(PCGExMath::Geo::FPointBVH::FEntry{Entry.Position, Entry.Index, c});
 			}
 		}
 
-		return OutVtxA >= 0 && OutVtxB >= 0;
+		PCGExMath::Geo::FPointBVH All(MoveTemp(Entries));
+
+		TArray<PCGExMath::Geo::FGroupBridge> MinimumBridges;
+		PCGExMath::Geo::FindGroupMST(ValidNodeBVHs, All, MinimumBridges);
+
+		BridgesList.Reset(MinimumBridges.Num());
+		OutEndpoints.Reset(MinimumBridges.Num());
+		for (const PCGExMath::Geo::FGroupBridge& Bridge : MinimumBridges)
+		{
+			Bridges.Add(PCGEx::H64U(Bridge.GroupA, Bridge.GroupB));
+			BridgesList.Add(PCGEx::H64U(Bridge.GroupA, Bridge.GroupB));
+			OutEndpoints.Add(PCGEx::H64(Bridge.IndexA, Bridge.IndexB));
+		}
 	}
 }
 
@@ -13,6 +13,7 @@
 #include "Details/PCGExBlendingDetails.h"
 #include "Factories/PCGExOperation.h"
 
+#include "Clusters/PCGExLink.h"
 #include "Core/PCGExClusterFilter.h"
 #include "Elements/PCGExFilterVtx.h"
 #include "Sampling/PCGExSamplingCommon.h"
@@ -44,6 +45,47 @@ namespace PCGExNeighborSample
 {
 	const FName SourceSamplersLabel = TEXT("Samplers");
 	const FName OutputSamplerLabel = TEXT("Sampler");
+
+	/**
+	 * Reusable breadth-first traversal scratch. Frontiers are kept between traversals, and the visited set is an
+	 * epoch-stamped per-node array: starting a traversal bumps the epoch instead of clearing anything.
+	 * Owned by a single thread at a time, see FTraversalPool.
+	 */
+	class PCGEXELEMENTSCLUSTERS_API FTraversal
+	{
+	public:
+		TArray<PCGExGraphs::FLink> Current;
+		TArray<PCGExGraphs::FLink> Next;
+
+		explicit FTraversal(const int32 NumNodes);
+
+		void Begin();
+
+		FORCEINLINE bool IsVisited(const int32 NodeIndex) const { return Stamps[NodeIndex] == Epoch; }
+		FORCEINLINE void MarkVisited(const int32 NodeIndex) { Stamps[NodeIndex] = Epoch; }
+
+	protected:
+		TArray<uint32> Stamps;
+		uint32 Epoch = 0;
+	};
+
+	/** Hands out traversals to running scopes, so there are only ever as many as concurrent scopes. */
+	class PCGEXELEMENTSCLUSTERS_API FTraversalPool
+	{
+	public:
+		explicit FTraversalPool(const int32 InNumNodes)
+			: NumNodes(InNumNodes)
+		{
+		}
+
+		TSharedPtr<FTraversal> Acquire();
+		void Release(const TSharedPtr<FTraversal>& InTraversal);
+
+	protected:
+		int32 NumNodes = 0;
+		FCriticalSection PoolLock;
+		TArray<TSharedPtr<FTraversal>> Available;
+	};
 }
 
 USTRUCT(BlueprintType)
@@ -130,7 +172,7 @@ public:
 
 	virtual void PrepareForLoops(const TArray<PCGExMT::FScope>& Loops);
 
-	virtual void ProcessNode(const int32 NodeIndex, const PCGExMT::FScope& Scope);
+	virtual void ProcessNode(const int32 NodeIndex, const PCGExMT::FScope& Scope, PCGExNeighborSample::FTraversal& Traversal);
 	virtual void PrepareNode(const PCGExClusters::FNode& TargetNode, const PCGExMT::FScope& Scope) const;
 
 	virtual void SampleNeighborNode(const PCGExClusters::FNode& TargetNode, const PCGExGraphs::FLink Lk, const double Weight, const PCGExMT::FScope& Scope);
@@ -146,6 +188,12 @@ public:
 protected:
 	bool bIsValidOperation = true;
 	TSharedPtr<PCGExClusters::FCluster> Cluster;
+
+	// Deepest level the traversal may reach
+	int32 SafeMaxDepth = 1;
+
+	// Curve-remapped weight per depth, when it doesn't depend on distance
+	TArray<double> DepthWeights;
 };
 
 UCLASS(Abstract, BlueprintType, ClassGroup = (Procedural), Category="PCGEx|Data")
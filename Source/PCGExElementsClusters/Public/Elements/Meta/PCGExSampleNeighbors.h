@@ -14,6 +14,7 @@
 namespace PCGExNeighborSample
 {
 	struct FNeighbor;
+	class FTraversalPool;
 }
 
 class UPCGExNeighborSamplerFactoryData;
@@ -78,6 +79,7 @@ namespace PCGExSampleNeighbors
 	{
 		TArray<TSharedPtr<FPCGExNeighborSampleOperation>> SamplingOperations;
 		TArray<TSharedPtr<FPCGExNeighborSampleOperation>> OpsWithValueTest;
+		TSharedPtr<PCGExNeighborSample::FTraversalPool> TraversalPool;
 
 	public:
 		FProcessor(const TSharedRef<PCGExData::FFacade>& InVtxDataFacade, const TSharedRef<PCGExData::FFacade>& InEdgeDataFacade)
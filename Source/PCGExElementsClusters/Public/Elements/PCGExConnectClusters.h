@@ -17,12 +17,17 @@ namespace PCGExGraphs
 	class FGraphPatcher;
 }
 
+namespace PCGExMath::Geo
+{
+	class FPointBVH;
+}
+
 UENUM()
 enum class EPCGExBridgeClusterMethod : uint8
 {
 	Delaunay3D = 0 UMETA(DisplayName = "Delaunay 3D", ToolTip="Uses Delaunay 3D graph to find connections."),
 	Delaunay2D = 1 UMETA(DisplayName = "Delaunay 2D", ToolTip="Uses Delaunay 2D graph to find connections."),
-	LeastEdges = 2 UMETA(DisplayName = "Least Edges", ToolTip="Ensure all clusters are connected using the least possible number of bridges."),
+	LeastEdges = 2 UMETA(DisplayName = "Least Edges", ToolTip="Ensure all clusters are connected using the least possible number of bridges, along the shortest overall vtx-to-vtx distances."),
 	MostEdges  = 3 UMETA(DisplayName = "Most Edges", ToolTip="Each cluster will have a bridge to every other cluster"),
 	// 4 was the never-implemented "Node Filters" placeholder; "Cluster : Connect Vtx" covers it now.
 };
@@ -121,6 +126,9 @@ namespace PCGExConnectClusters
 		{
 		}
 
+		// Cluster nodes, entries indexed by vtx point index
+		TSharedPtr<PCGExMath::Geo::FPointBVH> NodeBVH;
+
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager) override;
 		virtual void CompleteWork() override;
 	};
@@ -134,6 +142,7 @@ namespace PCGExConnectClusters
 		TArray<uint64> BridgesList;
 		TArray<int32> BridgeEdgeHandles;    // patcher AddEdge handles (parallel to BridgeEndpoints)
 		TArray<uint64> BridgeEndpoints;     // H64(VtxA, VtxB) per staged bridge, for the optional connector flags
+		TArray<TSharedPtr<PCGExMath::Geo::FPointBVH>> ValidNodeBVHs; // Parallel to ValidClusters
 
 		FBatch(FPCGExContext* InContext, const TSharedRef<PCGExData::FPointIO>& InVtx, TArrayView<TSharedRef<PCGExData::FPointIO>> InEdges);
 
@@ -141,7 +150,10 @@ namespace PCGExConnectClusters
 		virtual void Write() override;
 
 	protected:
-		// Brute-force closest vtx pair between two valid clusters. Returns false if none found.
+		// Exact closest vtx pair between two valid clusters, dual-tree search over their node BVHs. Returns false if none found.
 		bool FindClosestVtxPair(int32 FromClusterIndex, int32 ToClusterIndex, int32& OutVtxA, int32& OutVtxB) const;
+
+		// Bridges along the minimum spanning tree of clusters, weighted by closest vtx-to-vtx distance
+		void FindMinimumBridges(TArray<uint64>& OutEndpoints);
 	};
 }
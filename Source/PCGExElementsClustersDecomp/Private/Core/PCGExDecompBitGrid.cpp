@@ -0,0 +1,79 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExDecompBitGrid.h"
+
+#include "Core/PCGExDecompOccupancyGrid.h"
+
+namespace PCGExDecomposition
+{
+	void FBitGrid::Init(const FPCGExDecompOccupancyGrid& InGrid)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExDecomposition::FBitGrid::Init);
+
+		Dimensions = InGrid.GridDimensions;
+		NumWordsX = (Dimensions.X + 63) / 64;
+		NumBricks = FIntVector(
+			NumWordsX,
+			(Dimensions.Y + BrickRows - 1) / BrickRows,
+			(Dimensions.Z + BrickSlices - 1) / BrickSlices);
+		NumSet = 0;
+
+		Bricks.Init(-1, NumBricks.X * NumBricks.Y * NumBricks.Z);
+		Words.Reset();
+
+		// First pass flags the bricks that hold anything, second pass fills them.
+		// Offsets are handed out in brick order so the layout doesn't depend on voxel order.
+		for (TConstSetBitIterator<> It(InGrid.Occupied); It; ++It)
+		{
+			const FIntVector C = InGrid.UnflatIndex(It.GetIndex());
+			Bricks[BrickIndex(C.X >> 6, C.Y, C.Z)] = 0;
+		}
+
+		int32 NumAllocated = 0;
+		for (int32& Brick : Bricks)
+		{
+			if (Brick >= 0) { Brick = BrickWords * NumAllocated++; }
+		}
+
+		Words.SetNumZeroed(BrickWords * NumAllocated);
+
+		for (TConstSetBitIterator<> It(InGrid.Occupied); It; ++It)
+		{
+			const FIntVector C = InGrid.UnflatIndex(It.GetIndex());
+			const int32 Brick = Bricks[BrickIndex(C.X >> 6, C.Y, C.Z)];
+			Words[Brick + (C.Y % BrickRows) + (C.Z % BrickSlices) * BrickRows] |= 1ULL << (C.X & 63);
+			NumSet++;
+		}
+	}
+
+	void FBitGrid::ClearBox(const FIntVector& InMin, const FIntVector& InMax)
+	{
+		const int32 FirstWord = InMin.X >> 6;
+		const int32 LastWord = InMax.X >> 6;
+
+		for (int32 Z = InMin.Z; Z <= InMax.Z; Z++)
+		{
+			for (int32 Y = InMin.Y; Y <= InMax.Y; Y++)
+			{
+				for (int32 WordX = FirstWord; WordX <= LastWord; WordX++)
+				{
+					const int32 Brick = Bricks[BrickIndex(WordX, Y, Z)];
+					if (Brick < 0)
+					{
+						continue;
+					}
+
+					// Bits [Lo, Hi] of this word fall inside the box
+					const int32 Lo = WordX == FirstWord ? (InMin.X & 63) : 0;
+					const int32 Hi = WordX == LastWord ? (InMax.X & 63) : 63;
+					const uint64 Mask = (~0ULL >> (63 - Hi)) & (~0ULL << Lo);
+
+					uint64& Word = Words[Brick + (Y % BrickRows) + (Z % BrickSlices) * BrickRows];
+					NumSet -= static_cast<int32>(FMath::CountBits(Word & Mask));
+					Word &= ~Mask;
+				}
+			}
+		}
+	}
+}
@@ -0,0 +1,462 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExSpectralSolver.h"
+
+#include "Core/PCGExMTCommon.h"
+
+namespace PCGExDecomposition::Spectral
+{
+	namespace
+	{
+		// Reductions are split in fixed-size chunks summed in order, so they don't depend on the worker count
+		constexpr int32 ReduceChunkSize = 4096;
+
+		// Below this size, multilevel stops coarsening and solves directly
+		constexpr int32 CoarsestSize = 128;
+
+		template <typename FChunkSum>
+		double ChunkedSum(const int32 N, FChunkSum&& ChunkSum)
+		{
+			const int32 NumChunks = FMath::DivideAndRoundUp(N, ReduceChunkSize);
+			if (NumChunks <= 1) { return ChunkSum(0, N); }
+
+			TArray<double> Partials;
+			Partials.SetNumUninitialized(NumChunks);
+
+			PCGExMT::ParallelOrSequential(
+				NumChunks,
+				[&](const int32 Chunk)
+				{
+					const int32 Start = Chunk * ReduceChunkSize;
+					Partials[Chunk] = ChunkSum(Start, FMath::Min(Start + ReduceChunkSize, N));
+				}, 2);
+
+			double Sum = 0;
+			for (const double Partial : Partials) { Sum += Partial; }
+			return Sum;
+		}
+
+		double Dot(const TConstArrayView<double> A, const TConstArrayView<double> B)
+		{
+			return ChunkedSum(
+				A.Num(), [&](const int32 Start, const int32 End)
+				{
+					double Sum = 0;
+					for (int32 i = Start; i < End; i++) { Sum += A[i] * B[i]; }
+					return Sum;
+				});
+		}
+
+		/** Remove the component along the constant vector, the Laplacian's trivial eigenvector. */
+		void Deflate(const TArrayView<double> X)
+		{
+			const int32 N = X.Num();
+			const double Mean = ChunkedSum(
+				N, [&](const int32 Start, const int32 End)
+				{
+					double Sum = 0;
+					for (int32 i = Start; i < End; i++) { Sum += X[i]; }
+					return Sum;
+				}) / N;
+
+			PCGEX_PARALLEL_FOR(N, X[i] -= Mean;)
+		}
+
+		bool Normalize(const TArrayView<double> X)
+		{
+			const double Norm = FMath::Sqrt(Dot(X, X));
+			if (Norm < UE_DOUBLE_SMALL_NUMBER) { return false; }
+
+			const double InvNorm = 1 / Norm;
+			PCGEX_PARALLEL_FOR(X.Num(), X[i] *= InvNorm;)
+			return true;
+		}
+
+		void RandomDeflated(const TArrayView<double> X)
+		{
+			FRandomStream RNG(42);
+			for (double& Value : X) { Value = RNG.FRandRange(-1.0, 1.0); }
+			Deflate(X);
+		}
+
+		/**
+		 * Smallest eigenpair of the symmetric tridiagonal matrix (diagonal InAlpha, off-diagonal InBeta), via cyclic Jacobi.
+		 * Sizes are bounded by the Krylov size, so a dense solve is cheap next to a single SpMV.
+		 */
+		void SmallestEigenpair(const TArray<double>& InAlpha, const TArray<double>& InBeta, double& OutValue, TArray<double>& OutVector)
+		{
+			const int32 K = InAlpha.Num();
+
+			TArray<double> A;
+			TArray<double> V;
+			A.SetNumZeroed(K * K);
+			V.SetNumZeroed(K * K);
+
+			double Frobenius = 0;
+			for (int32 i = 0; i < K; i++)
+			{
+				A[i * K + i] = InAlpha[i];
+				V[i * K + i] = 1;
+				Frobenius += InAlpha[i] * InAlpha[i];
+
+				if (i + 1 < K)
+				{
+					A[i * K + i + 1] = A[(i + 1) * K + i] = InBeta[i];
+					Frobenius += 2 * InBeta[i] * InBeta[i];
+				}
+			}
+
+			const double Threshold = Frobenius * 1e-28;
+
+			for (int32 Sweep = 0; Sweep < 64; Sweep++)
+			{
+				double Off = 0;
+				for (int32 p = 0; p < K; p++) { for (int32 q = p + 1; q < K; q++) { Off += A[p * K + q] * A[p * K + q]; } }
+				if (Off <= Threshold) { break; }
+
+				for (int32 p = 0; p < K; p++)
+				{
+					for (int32 q = p + 1; q < K; q++)
+					{
+						const double Apq = A[p * K + q];
+						if (FMath::Abs(Apq) < UE_DOUBLE_SMALL_NUMBER) { continue; }
+
+						const double Theta = (A[q * K + q] - A[p * K + p]) / (2 * Apq);
+						const double T = (Theta >= 0 ? 1 : -1) / (FMath::Abs(Theta) + FMath::Sqrt(Theta * Theta + 1));
+						const double C = 1 / FMath::Sqrt(T * T + 1);
+						const double S = T * C;
+
+						for (int32 r = 0; r < K; r++)
+						{
+							const double Arp = A[r * K + p];
+							const double Arq = A[r * K + q];
+							A[r * K + p] = C * Arp - S * Arq;
+							A[r * K + q] = S * Arp + C * Arq;
+						}
+
+						for (int32 r = 0; r < K; r++)
+						{
+							const double Apr = A[p * K + r];
+							const double Aqr = A[q * K + r];
+							A[p * K + r] = C * Apr - S * Aqr;
+							A[q * K + r] = S * Apr + C * Aqr;
+						}
+
+						for (int32 r = 0; r < K; r++)
+						{
+							const double Vrp = V[r * K + p];
+							const double Vrq = V[r * K + q];
+							V[r * K + p] = C * Vrp - S * Vrq;
+							V[r * K + q] = S * Vrp + C * Vrq;
+						}
+					}
+				}
+			}
+
+			int32 Smallest = 0;
+			for (int32 i = 1; i < K; i++) { if (A[i * K + i] < A[Smallest * K + Smallest]) { Smallest = i; } }
+
+			OutValue = A[Smallest * K + Smallest];
+			OutVector.SetNumUninitialized(K);
+			for (int32 r = 0; r < K; r++) { OutVector[r] = V[r * K + Smallest]; }
+		}
+	}
+
+#pragma region FCSRGraph
+
+	void FCSRGraph::MultiplyLaplacian(const TConstArrayView<double> X, const TArrayView<double> Y) const
+	{
+		PCGEX_PARALLEL_FOR(
+			Num(),
+			double LX = Degree[i] * X[i];
+			for (int32 e = RowStart[i]; e < RowStart[i + 1]; e++) { LX -= Weights[e] * X[Columns[e]]; }
+			Y[i] = LX;
+			)
+	}
+
+	void FCSRGraph::ExtractSubgraph(const TConstArrayView<int32> InNodes, FCSRGraph& OutGraph) const
+	{
+		const int32 N = InNodes.Num();
+
+		TArray<int32> Local;
+		Local.Init(-1, Num());
+		for (int32 i = 0; i < N; i++) { Local[InNodes[i]] = i; }
+
+		OutGraph.RowStart.SetNumUninitialized(N + 1);
+		OutGraph.Degree.SetNumZeroed(N);
+		OutGraph.Columns.Reset();
+		OutGraph.Weights.Reset();
+		OutGraph.MaxDegree = 0;
+
+		for (int32 i = 0; i < N; i++)
+		{
+			const int32 Row = InNodes[i];
+			OutGraph.RowStart[i] = OutGraph.Columns.Num();
+
+			for (int32 e = RowStart[Row]; e < RowStart[Row + 1]; e++)
+			{
+				const int32 Neighbor = Local[Columns[e]];
+				if (Neighbor < 0) { continue; }
+
+				OutGraph.Columns.Add(Neighbor);
+				OutGraph.Weights.Add(Weights[e]);
+				OutGraph.Degree[i] += Weights[e];
+			}
+
+			OutGraph.MaxDegree = FMath::Max(OutGraph.MaxDegree, OutGraph.Degree[i]);
+		}
+
+		OutGraph.RowStart[N] = OutGraph.Columns.Num();
+	}
+
+	bool FCSRGraph::Coarsen(FCSRGraph& OutCoarse, TArray<int32>& OutFineToCoarse) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExDecomposition::Spectral::Coarsen);
+
+		const int32 N = Num();
+		if (N < 2) { return false; }
+
+		// Heavy-edge matching: each unmatched node pairs with its heaviest unmatched neighbor (lowest index on ties)
+		OutFineToCoarse.Init(-1, N);
+
+		TArray<FIntPoint> Members;
+		Members.Reserve(N);
+
+		for (int32 u = 0; u < N; u++)
+		{
+			if (OutFineToCoarse[u] != -1) { continue; }
+
+			int32 Best = -1;
+			double BestWeight = -1;
+
+			for (int32 e = RowStart[u]; e < RowStart[u + 1]; e++)
+			{
+				const int32 v = Columns[e];
+				if (v == u || OutFineToCoarse[v] != -1) { continue; }
+				if (Weights[e] > BestWeight || (Weights[e] == BestWeight && v < Best))
+				{
+					Best = v;
+					BestWeight = Weights[e];
+				}
+			}
+
+			OutFineToCoarse[u] = Members.Num();
+			if (Best != -1) { OutFineToCoarse[Best] = Members.Num(); }
+			Members.Emplace(u, Best);
+		}
+
+		const int32 NumCoarse = Members.Num();
+		if (NumCoarse > N * 0.9)
+		{
+			// Matching stalls on star-like graphs; further levels wouldn't pay for themselves
+			return false;
+		}
+
+		OutCoarse.RowStart.SetNumUninitialized(NumCoarse + 1);
+		OutCoarse.Degree.SetNumZeroed(NumCoarse);
+		OutCoarse.Columns.Reset(Columns.Num() / 2);
+		OutCoarse.Weights.Reset(Columns.Num() / 2);
+		OutCoarse.MaxDegree = 0;
+
+		// Where each coarse neighbor sits in the row being built; stale (< row start) means not yet seen in this row
+		TArray<int32> Slot;
+		Slot.Init(-1, NumCoarse);
+
+		for (int32 c = 0; c < NumCoarse; c++)
+		{
+			const int32 Start = OutCoarse.Columns.Num();
+			OutCoarse.RowStart[c] = Start;
+
+			for (const int32 Fine : {Members[c].X, Members[c].Y})
+			{
+				if (Fine == -1) { continue; }
+
+				for (int32 e = RowStart[Fine]; e < RowStart[Fine + 1]; e++)
+				{
+					const int32 Neighbor = OutFineToCoarse[Columns[e]];
+					if (Neighbor == c) { continue; } // Collapsed edge
+
+					if (Slot[Neighbor] < Start)
+					{
+						Slot[Neighbor] = OutCoarse.Columns.Num();
+						OutCoarse.Columns.Add(Neighbor);
+						OutCoarse.Weights.Add(Weights[e]);
+					}
+					else
+					{
+						OutCoarse.Weights[Slot[Neighbor]] += Weights[e];
+					}
+
+					OutCoarse.Degree[c] += Weights[e];
+				}
+			}
+
+			OutCoarse.MaxDegree = FMath::Max(OutCoarse.MaxDegree, OutCoarse.Degree[c]);
+		}
+
+		OutCoarse.RowStart[NumCoarse] = OutCoarse.Columns.Num();
+
+		return true;
+	}
+
+#pragma endregion
+
+	bool LanczosFiedler(const FCSRGraph& Graph, const FLanczosSettings& Settings, TArray<double>& InOutVector)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExDecomposition::Spectral::LanczosFiedler);
+
+		const int32 N = Graph.Num();
+		if (N < 2)
+		{
+			return false;
+		}
+
+		// Gershgorin: lambda_max(L) <= 2 * max degree. Scales the convergence and breakdown thresholds.
+		const double SpectralBound = FMath::Max(Graph.MaxDegree * 2, UE_DOUBLE_SMALL_NUMBER);
+		const int32 M = FMath::Clamp(Settings.KrylovSize, 1, N - 1);
+
+		TArray<double>& V = InOutVector;
+		if (V.Num() != N)
+		{
+			V.SetNumUninitialized(N);
+			RandomDeflated(V);
+		}
+		else
+		{
+			Deflate(V);
+		}
+
+		if (!Normalize(V))
+		{
+			// Starting guess had no component orthogonal to the constant vector
+			RandomDeflated(V);
+			if (!Normalize(V)) { return false; }
+		}
+
+		TArray<TArray<double>> Basis;
+		Basis.SetNum(M);
+		for (TArray<double>& Q : Basis) { Q.SetNumUninitialized(N); }
+
+		TArray<double> W;
+		W.SetNumUninitialized(N);
+
+		TArray<double> Alpha;
+		TArray<double> Beta;
+		TArray<double> Ritz;
+		double Theta = 0;
+
+		for (int32 Restart = 0; Restart < FMath::Max(1, Settings.MaxRestarts); Restart++)
+		{
+			FMemory::Memcpy(Basis[0].GetData(), V.GetData(), N * sizeof(double));
+
+			Alpha.Reset();
+			Beta.Reset();
+			double LastBeta = 0;
+
+			for (int32 j = 0; j < M; j++)
+			{
+				Graph.MultiplyLaplacian(Basis[j], W);
+				Deflate(W);
+
+				Alpha.Add(Dot(W, Basis[j]));
+
+				// Full reorthogonalization, repeated once if it cancelled most of the vector ("twice is enough")
+				for (int32 Pass = 0; Pass < 2; Pass++)
+				{
+					const double NormBefore = FMath::Sqrt(Dot(W, W));
+					for (int32 b = 0; b <= j; b++)
+					{
+						const double Projection = Dot(W, Basis[b]);
+						const TArray<double>& Q = Basis[b];
+						PCGEX_PARALLEL_FOR(N, W[i] -= Projection * Q[i];)
+					}
+
+					LastBeta = FMath::Sqrt(Dot(W, W));
+					if (LastBeta > NormBefore * UE_INV_SQRT_2) { break; }
+				}
+
+				// Krylov space exhausted (invariant subspace found) or cycle complete
+				if (LastBeta <= SpectralBound * 1e-12 || j + 1 == M) { break; }
+
+				Beta.Add(LastBeta);
+
+				const double InvBeta = 1 / LastBeta;
+				TArray<double>& Next = Basis[j + 1];
+				PCGEX_PARALLEL_FOR(N, Next[i] = W[i] * InvBeta;)
+			}
+
+			SmallestEigenpair(Alpha, Beta, Theta, Ritz);
+
+			// Ritz vector y = Q.s becomes the next start vector
+			const int32 K = Alpha.Num();
+			PCGEX_PARALLEL_FOR(
+				N,
+				double Value = 0;
+				for (int32 k = 0; k < K; k++) { Value += Ritz[k] * Basis[k][i]; }
+				V[i] = Value;
+				)
+
+			Deflate(V);
+			if (!Normalize(V)) { return false; }
+
+			// ||L.y - theta.y|| = |beta_K * s_K|
+			if (FMath::Abs(LastBeta * Ritz[K - 1]) <= Settings.Tolerance * SpectralBound) { break; }
+		}
+
+		return true;
+	}
+
+	bool MultilevelFiedler(const FCSRGraph& Graph, const FLanczosSettings& Settings, TArray<double>& OutVector)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExDecomposition::Spectral::MultilevelFiedler);
+
+		OutVector.Reset();
+
+		TArray<FCSRGraph> Levels;
+		TArray<TArray<int32>> FineToCoarse;
+
+		while (true)
+		{
+			const FCSRGraph& Current = Levels.IsEmpty() ? Graph : Levels.Last();
+			if (Current.Num() <= CoarsestSize) { break; }
+
+			FCSRGraph Coarse;
+			TArray<int32> Map;
+			if (!Current.Coarsen(Coarse, Map) || Coarse.Num() < 2) { break; }
+
+			Levels.Add(MoveTemp(Coarse));
+			FineToCoarse.Add(MoveTemp(Map));
+		}
+
+		if (Levels.IsEmpty() || !LanczosFiedler(Levels.Last(), Settings, OutVector))
+		{
+			OutVector.Reset();
+			return LanczosFiedler(Graph, Settings, OutVector);
+		}
+
+		// Intermediate levels only need to get close; the finest one runs to full tolerance
+		FLanczosSettings Refine = Settings;
+		Refine.MaxRestarts = FMath::Min(Settings.MaxRestarts, 8);
+		Refine.Tolerance = Settings.Tolerance * 10;
+
+		for (int32 Level = Levels.Num() - 1; Level >= 0; Level--)
+		{
+			const TArray<int32>& Map = FineToCoarse[Level];
+
+			TArray<double> Fine;
+			Fine.SetNumUninitialized(Map.Num());
+			PCGEX_PARALLEL_FOR(Map.Num(), Fine[i] = OutVector[Map[i]];)
+
+			const bool bFinest = Level == 0;
+			if (!LanczosFiedler(bFinest ? Graph : Levels[Level - 1], bFinest ? Settings : Refine, Fine))
+			{
+				return false;
+			}
+
+			OutVector = MoveTemp(Fine);
+		}
+
+		return true;
+	}
+}
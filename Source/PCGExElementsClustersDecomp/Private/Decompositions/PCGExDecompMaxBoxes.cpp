@@ -3,6 +3,8 @@
 
 #include "Decompositions/PCGExDecompMaxBoxes.h"
 
+#include "Core/PCGExMTCommon.h"
+
 #pragma region FPCGExDecompMaxBoxes
 
 bool FPCGExDecompMaxBoxes::Decompose(FPCGExDecompositionResult& OutResult)
@@ -31,16 +33,8 @@ bool FPCGExDecompMaxBoxes::Decompose(FPCGExDecompositionResult& OutResult)
 		MaxCellSize.Z > KINDA_SMALL_NUMBER ? FMath::Max(FMath::FloorToInt(MaxCellSize.Z / ResolvedVoxelSize.Z), 1) : MAX_int32);
 
 	// Available = occupied and not yet claimed
-	TBitArray<> Available = Grid.Occupied;
-
-	int32 RemainingCount = 0;
-	for (int32 i = 0; i < Grid.TotalVoxels; i++)
-	{
-		if (Available[i])
-		{
-			RemainingCount++;
-		}
-	}
+	PCGExDecomposition::FBitGrid Available;
+	Available.Init(Grid);
 
 	// Per-voxel CellID
 	TArray<int32> VoxelCellIDs;
@@ -53,18 +47,79 @@ bool FPCGExDecompMaxBoxes::Decompose(FPCGExDecompositionResult& OutResult)
 	int32 NextCellID = 0;
 	TArray<int32> CellVoxelCounts; // Track occupied voxel count per CellID
 
+	// Best box per starting Z slab, kept across extractions
+	const int32 NumSlabs = Grid.GridDimensions.Z;
+	TArray<FSlabBest> SlabBests;
+	SlabBests.SetNum(NumSlabs);
+
+	TArray<int32> DirtySlabs;
+	DirtySlabs.SetNumUninitialized(NumSlabs);
+	for (int32 i = 0; i < NumSlabs; i++)
+	{
+		DirtySlabs[i] = i;
+	}
+
+	const bool bUseBalance = Balance > KINDA_SMALL_NUMBER;
+
 	// Iteratively extract the best box (compactness-scored when Balance > 0, pure volume otherwise)
-	while (RemainingCount > 0)
+	while (Available.GetNumSet() > 0)
 	{
-		FIntVector BoxMin, BoxMax;
-		int32 BoxVolume = 0;
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExDecompMaxBoxes::FindLargestBox);
+
+			// Slabs are independent and each one is a full sweep, worth dispatching from very few
+			PCGExMT::ParallelOrSequential(
+				DirtySlabs.Num(), [&](const int32 i)
+				{
+					FindLargestBoxInSlab(Available, DirtySlabs[i], SlabBests[DirtySlabs[i]]);
+				}, 2);
+		}
+
+		// Lowest slab wins ties, same as a single sweep over all of them
+		int32 BestSlab = -1;
+		double BestScore = -1.0;
+		for (int32 Z1 = 0; Z1 < NumSlabs; Z1++)
+		{
+			if (SlabBests[Z1].Score > BestScore)
+			{
+				BestScore = SlabBests[Z1].Score;
+				BestSlab = Z1;
+			}
+		}
 
-		if (!FindLargestBox(Grid, Available, BoxMin, BoxMax, BoxVolume) || BoxVolume == 0)
+		if (BestSlab < 0 || SlabBests[BestSlab].Volume == 0)
 		{
 			break;
 		}
 
-		SubdivideAndClaim(Grid, BoxMin, BoxMax, MaxExtent, Available, VoxelCellIDs, NextCellID, RemainingCount, CellVoxelCounts);
+		const FIntVector BoxMin = SlabBests[BestSlab].Min;
+		const FIntVector BoxMax = SlabBests[BestSlab].Max;
+
+		SubdivideAndClaim(Grid, BoxMin, BoxMax, MaxExtent, Available, VoxelCellIDs, NextCellID, CellVoxelCounts);
+
+		// Pure volume: only slabs whose best box lost voxels need another sweep.
+		// Balanced scores depend on which rectangles are maximal, which claimed voxels elsewhere can change,
+		// so every slab whose sweep reaches the claimed box -- i.e. starting at or below its top -- is re-run.
+		DirtySlabs.Reset();
+		for (int32 Z1 = 0; Z1 < NumSlabs; Z1++)
+		{
+			const FSlabBest& Slab = SlabBests[Z1];
+			if (Slab.Volume <= 0)
+			{
+				continue;
+			}
+
+			if (bUseBalance)
+			{
+				if (Z1 <= BoxMax.Z) { DirtySlabs.Add(Z1); }
+			}
+			else if (Slab.Min.X <= BoxMax.X && Slab.Max.X >= BoxMin.X &&
+				Slab.Min.Y <= BoxMax.Y && Slab.Max.Y >= BoxMin.Y &&
+				Slab.Min.Z <= BoxMax.Z && Slab.Max.Z >= BoxMin.Z)
+			{
+				DirtySlabs.Add(Z1);
+			}
+		}
 	}
 
 	// Merge adjacent cells that together form a perfect box
@@ -133,24 +188,30 @@ bool FPCGExDecompMaxBoxes::Decompose(FPCGExDecompositionResult& OutResult)
 	return OutResult.NumCells > 0;
 }
 
-bool FPCGExDecompMaxBoxes::FindLargestBox(
-	const FPCGExDecompOccupancyGrid& Grid,
-	const TBitArray<>& Available,
-	FIntVector& OutMin,
-	FIntVector& OutMax,
-	int32& OutVolume) const
+void FPCGExDecompMaxBoxes::FindLargestBoxInSlab(
+	const PCGExDecomposition::FBitGrid& Available,
+	const int32 Z1,
+	FSlabBest& OutBest) const
 {
-	const int32 GX = Grid.GridDimensions.X;
-	const int32 GY = Grid.GridDimensions.Y;
-	const int32 GZ = Grid.GridDimensions.Z;
+	const FIntVector& Dims = Available.GetDimensions();
+	const int32 GX = Dims.X;
+	const int32 GY = Dims.Y;
+	const int32 GZ = Dims.Z;
+	const int32 NumWordsX = Available.GetNumWordsX();
 
-	OutVolume = 0;
-	double BestScore = -1.0;
+	OutBest = FSlabBest();
 	const bool bUseBalance = Balance > KINDA_SMALL_NUMBER;
 
-	// ColAvail[x + y * GX] = true iff ALL z-layers from Z1 to current Z2 at (x,y) are available
-	TArray<bool> ColAvail;
-	ColAvail.SetNum(GX * GY);
+	// ColAvail bit (x, y) is set iff ALL z-layers from Z1 to current Z2 at (x,y) are available
+	TArray<uint64> ColAvail;
+	ColAvail.SetNumUninitialized(GY * NumWordsX);
+	for (int32 Y = 0; Y < GY; Y++)
+	{
+		for (int32 WordX = 0; WordX < NumWordsX; WordX++)
+		{
+			ColAvail[WordX + Y * NumWordsX] = Available.GetWord(WordX, Y, Z1);
+		}
+	}
 
 	// Y-direction histogram: Hist[x] = consecutive Y rows where ColAvail is true
 	TArray<int32> Hist;
@@ -159,107 +220,119 @@ bool FPCGExDecompMaxBoxes::FindLargestBox(
 	// Stack for the largest-rectangle-in-histogram algorithm
 	TArray<TPair<int32, int32>> Stack; // (start_index, height)
 
-	for (int32 Z1 = 0; Z1 < GZ; Z1++)
+	for (int32 Z2 = Z1; Z2 < GZ; Z2++)
 	{
-		// Reset ColAvail for new Z1
-		for (int32 i = 0; i < GX * GY; i++)
+		const int32 ZDepth = Z2 - Z1 + 1;
+
+		// AND in the Z2 layer: ColAvail stays set only if Z2 layer is also available
+		int64 NumColumns = 0;
+		for (int32 Y = 0; Y < GY; Y++)
+		{
+			for (int32 WordX = 0; WordX < NumWordsX; WordX++)
+			{
+				uint64& Word = ColAvail[WordX + Y * NumWordsX];
+				if (Z2 != Z1 && Word) { Word &= Available.GetWord(WordX, Y, Z2); }
+				NumColumns += static_cast<int64>(FMath::CountBits(Word));
+			}
+		}
+
+		// No box from here on can beat what we have: it covers at most NumColumns columns
+		// and can't go deeper than the grid. Score never exceeds volume, and ties keep the earlier box.
+		if (static_cast<double>(NumColumns * (GZ - Z1)) <= OutBest.Score)
 		{
-			ColAvail[i] = true;
+			break;
 		}
 
-		for (int32 Z2 = Z1; Z2 < GZ; Z2++)
+		// Find largest rectangle in the 2D ColAvail mask using histogram method
+		// Reset Y-histogram
+		for (int32 X = 0; X < GX; X++)
 		{
-			const int32 ZDepth = Z2 - Z1 + 1;
+			Hist[X] = 0;
+		}
 
-			// AND in the Z2 layer: ColAvail stays true only if Z2 layer is also available
-			for (int32 Y = 0; Y < GY; Y++)
+		for (int32 Y = 0; Y < GY; Y++)
+		{
+			const uint64* Row = ColAvail.GetData() + Y * NumWordsX;
+
+			// Update histogram: increment for available columns, reset for unavailable
+			bool bEmptyRow = true;
+			for (int32 X = 0; X < GX; X++)
 			{
-				for (int32 X = 0; X < GX; X++)
+				if ((Row[X >> 6] >> (X & 63)) & 1)
 				{
-					const int32 Idx2D = X + Y * GX;
-					if (ColAvail[Idx2D])
-					{
-						ColAvail[Idx2D] = Available[Grid.FlatIndex(X, Y, Z2)];
-					}
+					Hist[X]++;
+					bEmptyRow = false;
+				}
+				else
+				{
+					Hist[X] = 0;
 				}
 			}
 
-			// Find largest rectangle in the 2D ColAvail mask using histogram method
-			// Reset Y-histogram
-			for (int32 X = 0; X < GX; X++)
+			// An all-zero histogram only yields empty rectangles
+			if (bEmptyRow && OutBest.Score >= 0)
 			{
-				Hist[X] = 0;
+				continue;
 			}
 
-			for (int32 Y = 0; Y < GY; Y++)
-			{
-				// Update histogram: increment for available columns, reset for unavailable
-				for (int32 X = 0; X < GX; X++)
-				{
-					Hist[X] = ColAvail[X + Y * GX] ? (Hist[X] + 1) : 0;
-				}
+			// Largest rectangle in histogram (stack-based, O(GX))
+			Stack.Reset();
 
-				// Largest rectangle in histogram (stack-based, O(GX))
-				Stack.Reset();
+			for (int32 X = 0; X <= GX; X++)
+			{
+				const int32 H = (X < GX) ? Hist[X] : 0;
+				int32 Start = X;
 
-				for (int32 X = 0; X <= GX; X++)
+				while (Stack.Num() > 0 && Stack.Last().Value >= H)
 				{
-					const int32 H = (X < GX) ? Hist[X] : 0;
-					int32 Start = X;
-
-					while (Stack.Num() > 0 && Stack.Last().Value >= H)
-					{
-						const int32 StackIdx = Stack.Last().Key;
-						const int32 StackHeight = Stack.Last().Value;
-						Stack.Pop(EAllowShrinking::No);
+					const int32 StackIdx = Stack.Last().Key;
+					const int32 StackHeight = Stack.Last().Value;
+					Stack.Pop(EAllowShrinking::No);
 
-						const int32 Width = X - StackIdx;
-						const int32 Volume = Width * StackHeight * ZDepth;
+					const int32 Width = X - StackIdx;
+					const int32 Volume = Width * StackHeight * ZDepth;
 
-						// Score: pure volume when Balance=0, cube-like preference when Balance>0
-						double Score;
-						if (bUseBalance)
+					// Score: pure volume when Balance=0, cube-like preference when Balance>0
+					double Score;
+					if (bUseBalance)
+					{
+						// Compactness = second-largest / largest dimension (1.0 = perfect cube/square)
+						int32 d1 = Width, d2 = StackHeight, d3 = ZDepth;
+						if (d1 < d2)
 						{
-							// Compactness = second-largest / largest dimension (1.0 = perfect cube/square)
-							int32 d1 = Width, d2 = StackHeight, d3 = ZDepth;
-							if (d1 < d2)
-							{
-								Swap(d1, d2);
-							}
-							if (d1 < d3)
-							{
-								Swap(d1, d3);
-							}
-							if (d2 < d3)
-							{
-								Swap(d2, d3);
-							}
-							const double Compactness = static_cast<double>(d2) / d1;
-							Score = Volume * FMath::Pow(Compactness, Balance * 2.0);
+							Swap(d1, d2);
 						}
-						else
+						if (d1 < d3)
 						{
-							Score = static_cast<double>(Volume);
+							Swap(d1, d3);
 						}
-
-						if (Score > BestScore)
+						if (d2 < d3)
 						{
-							BestScore = Score;
-							OutVolume = Volume;
-							OutMin = FIntVector(StackIdx, Y - StackHeight + 1, Z1);
-							OutMax = FIntVector(X - 1, Y, Z2);
+							Swap(d2, d3);
 						}
+						const double Compactness = static_cast<double>(d2) / d1;
+						Score = Volume * FMath::Pow(Compactness, Balance * 2.0);
+					}
+					else
+					{
+						Score = static_cast<double>(Volume);
+					}
 
-						Start = StackIdx;
+					if (Score > OutBest.Score)
+					{
+						OutBest.Score = Score;
+						OutBest.Volume = Volume;
+						OutBest.Min = FIntVector(StackIdx, Y - StackHeight + 1, Z1);
+						OutBest.Max = FIntVector(X - 1, Y, Z2);
 					}
 
-					Stack.Add(TPair<int32, int32>(Start, H));
+					Start = StackIdx;
 				}
+
+				Stack.Add(TPair<int32, int32>(Start, H));
 			}
 		}
 	}
-
-	return OutVolume > 0;
 }
 
 void FPCGExDecompMaxBoxes::MergeAdjacentCells(
@@ -441,10 +514,9 @@ void FPCGExDecompMaxBoxes::SubdivideAndClaim(
 	const FIntVector& BoxMin,
 	const FIntVector& BoxMax,
 	const FIntVector& MaxExtent,
-	TBitArray<>& Available,
+	PCGExDecomposition::FBitGrid& Available,
 	TArray<int32>& VoxelCellIDs,
 	int32& NextCellID,
-	int32& RemainingCount,
 	TArray<int32>& CellVoxelCounts) const
 {
 	const FIntVector BoxSize = BoxMax - BoxMin + FIntVector(1, 1, 1);
@@ -488,13 +560,13 @@ void FPCGExDecompMaxBoxes::SubdivideAndClaim(
 						{
 							const int32 Flat = Grid.FlatIndex(X, Y, Z);
 							VoxelCellIDs[Flat] = CellID;
-							Available[Flat] = false;
-							RemainingCount--;
 							VoxelCount++;
 						}
 					}
 				}
 
+				Available.ClearBox(ChunkMin, ChunkMax);
+
 				CellVoxelCounts.Add(VoxelCount);
 			}
 		}
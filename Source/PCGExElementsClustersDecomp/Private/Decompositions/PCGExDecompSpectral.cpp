@@ -3,6 +3,8 @@
 
 #include "Decompositions/PCGExDecompSpectral.h"
 
+#include "Core/PCGExMTCommon.h"
+
 #pragma region FPCGExDecompSpectral
 
 bool FPCGExDecompSpectral::Decompose(FPCGExDecompositionResult& OutResult)
@@ -30,6 +32,56 @@ bool FPCGExDecompSpectral::Decompose(FPCGExDecompositionResult& OutResult)
 		return false;
 	}
 
+	// Score every edge once; subsets extract their Laplacian from this one
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExDecompSpectral::BuildGraph);
+
+		Graph.RowStart.SetNumUninitialized(NumNodes + 1);
+		Graph.Degree.SetNumZeroed(NumNodes);
+		Graph.Columns.Reset();
+		Graph.Weights.Reset();
+		Graph.MaxDegree = 0;
+
+		for (int32 i = 0; i < NumNodes; i++)
+		{
+			Graph.RowStart[i] = Graph.Columns.Num();
+
+			const PCGExClusters::FNode* Node = Cluster->GetNode(i);
+			if (!Node->bValid)
+			{
+				continue;
+			}
+
+			for (const PCGExGraphs::FLink Lk : Node->Links)
+			{
+				const PCGExClusters::FNode* Neighbor = Cluster->GetNode(Lk.Node);
+				if (!Neighbor->bValid)
+				{
+					continue;
+				}
+
+				// Edge weight from heuristics if available, else uniform
+				double Weight = 1.0;
+				if (Heuristics)
+				{
+					const PCGExGraphs::FEdge& Edge = *Cluster->GetEdge(Lk.Edge);
+					// Average both directions for symmetric weight
+					const double ScoreAB = Heuristics->GetEdgeScore(*Node, *Neighbor, Edge, *Node, *Neighbor);
+					const double ScoreBA = Heuristics->GetEdgeScore(*Neighbor, *Node, Edge, *Neighbor, *Node);
+					Weight = FMath::Max((ScoreAB + ScoreBA) * 0.5, KINDA_SMALL_NUMBER);
+				}
+
+				Graph.Columns.Add(Lk.Node);
+				Graph.Weights.Add(Weight);
+				Graph.Degree[i] += Weight;
+			}
+
+			Graph.MaxDegree = FMath::Max(Graph.MaxDegree, Graph.Degree[i]);
+		}
+
+		Graph.RowStart[NumNodes] = Graph.Columns.Num();
+	}
+
 	const int32 SafePartitions = FMath::Max(NumPartitions, 2);
 
 	// Recursive spectral bisection
@@ -105,55 +157,25 @@ bool FPCGExDecompSpectral::ComputeFiedlerVector(
 		return false;
 	}
 
-	// Build local index mapping: NodeIndex -> local index within subset
-	TMap<int32, int32> NodeToLocal;
-	NodeToLocal.Reserve(N);
-	for (int32 i = 0; i < N; i++)
+	// Laplacian L = D - A of the subset, in CSR form
+	PCGExDecomposition::Spectral::FCSRGraph Subgraph;
+	Graph.ExtractSubgraph(SubsetNodeIndices, Subgraph);
+
+	if (Solver == EPCGExDecompSpectralSolver::Lanczos)
 	{
-		NodeToLocal.Add(SubsetNodeIndices[i], i);
+		PCGExDecomposition::Spectral::FLanczosSettings Settings;
+		Settings.MaxRestarts = MaxIterations;
+		Settings.Tolerance = ConvergenceTolerance;
+
+		OutFiedler.Reset();
+		return bMultilevel ?
+			       PCGExDecomposition::Spectral::MultilevelFiedler(Subgraph, Settings, OutFiedler) :
+			       PCGExDecomposition::Spectral::LanczosFiedler(Subgraph, Settings, OutFiedler);
 	}
 
-	// Build graph Laplacian L = D - A in sparse form
 	// For shifted power iteration, we need (sigma*I - L) where sigma > lambda_max(L)
 	// lambda_max(L) <= 2 * max_degree for unweighted, but we use edge weights from heuristics
-
-	// Compute adjacency weights and degree
-	TArray<double> Degree;
-	Degree.SetNumZeroed(N);
-
-	// Sparse adjacency: for each local node, list of (local neighbor, weight)
-	TArray<TArray<TPair<int32, double>>> Adjacency;
-	Adjacency.SetNum(N);
-
-	for (int32 i = 0; i < N; i++)
-	{
-		const int32 NodeIndex = SubsetNodeIndices[i];
-		const PCGExClusters::FNode* Node = Cluster->GetNode(NodeIndex);
-
-		for (const PCGExGraphs::FLink Lk : Node->Links)
-		{
-			const int32* LocalNeighbor = NodeToLocal.Find(Lk.Node);
-			if (!LocalNeighbor)
-			{
-				continue;
-			} // Neighbor not in subset
-
-			// Edge weight from heuristics if available, else use inverse distance
-			double Weight = 1.0;
-			if (Heuristics)
-			{
-				const PCGExClusters::FNode* Neighbor = Cluster->GetNode(Lk.Node);
-				const PCGExGraphs::FEdge& Edge = *Cluster->GetEdge(Lk.Edge);
-				// Average both directions for symmetric weight
-				const double ScoreAB = Heuristics->GetEdgeScore(*Node, *Neighbor, Edge, *Node, *Neighbor);
-				const double ScoreBA = Heuristics->GetEdgeScore(*Neighbor, *Node, Edge, *Neighbor, *Node);
-				Weight = FMath::Max((ScoreAB + ScoreBA) * 0.5, KINDA_SMALL_NUMBER);
-			}
-
-			Adjacency[i].Add(TPair<int32, double>(*LocalNeighbor, Weight));
-			Degree[i] += Weight;
-		}
-	}
+	const TArray<double>& Degree = Subgraph.Degree;
 
 	// Find sigma = max(Degree) * 2 + 1 (upper bound on lambda_max)
 	double MaxDegree = 0;
@@ -216,16 +238,8 @@ bool FPCGExDecompSpectral::ComputeFiedlerVector(
 	for (int32 Iter = 0; Iter < MaxIterations; Iter++)
 	{
 		// Compute NewV = M * V = (sigma*I - L) * V = sigma*V - L*V
-		// L*V[i] = Degree[i]*V[i] - sum_j(A[i][j]*V[j])
-		for (int32 i = 0; i < N; i++)
-		{
-			double LV_i = Degree[i] * V[i];
-			for (const auto& Adj : Adjacency[i])
-			{
-				LV_i -= Adj.Value * V[Adj.Key];
-			}
-			NewV[i] = Sigma * V[i] - LV_i;
-		}
+		Subgraph.MultiplyLaplacian(V, NewV);
+		PCGEX_PARALLEL_FOR(N, NewV[i] = Sigma * V[i] - NewV[i];)
 
 		// Project out constant component
 		Sum = 0;
@@ -375,6 +389,8 @@ void UPCGExDecompSpectral::CopySettingsFrom(const UPCGExInstancedFactory* Other)
 		MaxIterations = TypedOther->MaxIterations;
 		ConvergenceTolerance = TypedOther->ConvergenceTolerance;
 		PartitionMode = TypedOther->PartitionMode;
+		Solver = TypedOther->Solver;
+		bMultilevel = TypedOther->bMultilevel;
 	}
 }
 
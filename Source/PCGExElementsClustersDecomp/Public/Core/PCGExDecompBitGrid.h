@@ -0,0 +1,62 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+struct FPCGExDecompOccupancyGrid;
+
+namespace PCGExDecomposition
+{
+	/**
+	 * Bit-packed 3D occupancy, 64 voxels per word along X.
+	 * Words are grouped into bricks of 8 rows (Y) x 8 slices (Z); bricks holding no set voxel are never
+	 * allocated and read as zero, so mostly-empty volumes only pay for the brick table.
+	 * Bits are only ever cleared after Init, which keeps the brick layout fixed.
+	 */
+	class FBitGrid
+	{
+	public:
+		static constexpr int32 BrickRows = 8;
+		static constexpr int32 BrickSlices = 8;
+		static constexpr int32 BrickWords = BrickRows * BrickSlices;
+
+		/** Mirror the occupied voxels of an occupancy grid. */
+		void Init(const FPCGExDecompOccupancyGrid& InGrid);
+
+		FORCEINLINE const FIntVector& GetDimensions() const { return Dimensions; }
+		FORCEINLINE int32 GetNumWordsX() const { return NumWordsX; }
+		FORCEINLINE int32 GetNumSet() const { return NumSet; }
+		FORCEINLINE int32 GetNumBricks() const { return Words.Num() / BrickWords; }
+
+		/** 64 voxels of row (Y, Z) starting at X = WordX * 64. Bits past GridDimensions.X are always zero. */
+		FORCEINLINE uint64 GetWord(const int32 WordX, const int32 Y, const int32 Z) const
+		{
+			const int32 Brick = Bricks[BrickIndex(WordX, Y, Z)];
+			return Brick < 0 ? 0 : Words[Brick + (Y % BrickRows) + (Z % BrickSlices) * BrickRows];
+		}
+
+		FORCEINLINE bool IsSet(const int32 X, const int32 Y, const int32 Z) const
+		{
+			return (GetWord(X >> 6, Y, Z) >> (X & 63)) & 1;
+		}
+
+		/** Clear every voxel within the inclusive box. */
+		void ClearBox(const FIntVector& InMin, const FIntVector& InMax);
+
+	protected:
+		FIntVector Dimensions = FIntVector::ZeroValue;
+		FIntVector NumBricks = FIntVector::ZeroValue;
+		int32 NumWordsX = 0;
+		int32 NumSet = 0;
+
+		TArray<int32> Bricks; // Brick -> offset of its first word in Words, -1 if empty
+		TArray<uint64> Words;
+
+		FORCEINLINE int32 BrickIndex(const int32 WordX, const int32 Y, const int32 Z) const
+		{
+			return WordX + (Y / BrickRows) * NumBricks.X + (Z / BrickSlices) * NumBricks.X * NumBricks.Y;
+		}
+	};
+}
@@ -0,0 +1,59 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExDecomposition::Spectral
+{
+	/**
+	 * Symmetric weighted graph in compressed sparse row form, standing for its Laplacian L = D - A.
+	 * Neighbors of row i are Columns[RowStart[i] .. RowStart[i+1]), in insertion order; the diagonal is Degree.
+	 */
+	struct FCSRGraph
+	{
+		TArray<int32> RowStart;
+		TArray<int32> Columns;
+		TArray<double> Weights;
+		TArray<double> Degree;
+		double MaxDegree = 0;
+
+		FORCEINLINE int32 Num() const { return Degree.Num(); }
+
+		/** Y = L * X. Rows are computed in parallel; each row sums in column order, so results don't depend on scheduling. */
+		void MultiplyLaplacian(TConstArrayView<double> X, TArrayView<double> Y) const;
+
+		/** Extract the subgraph induced by InNodes (row indices into this graph), in that order. */
+		void ExtractSubgraph(TConstArrayView<int32> InNodes, FCSRGraph& OutGraph) const;
+
+		/**
+		 * Collapse heavy-edge matched pairs into single nodes, summing the weights of merged edges.
+		 * Returns false if the graph wouldn't shrink meaningfully.
+		 */
+		bool Coarsen(FCSRGraph& OutCoarse, TArray<int32>& OutFineToCoarse) const;
+	};
+
+	struct FLanczosSettings
+	{
+		/** Maximum number of restart cycles. */
+		int32 MaxRestarts = 200;
+		/** Converged once the Ritz residual ||L.y - theta.y|| drops below Tolerance * lambda_max bound. */
+		double Tolerance = 1e-6;
+		/** Krylov subspace size per cycle. */
+		int32 KrylovSize = 32;
+	};
+
+	/**
+	 * Fiedler vector (eigenvector of the 2nd smallest Laplacian eigenvalue) via explicitly restarted Lanczos with full
+	 * reorthogonalization, working orthogonally to the constant vector. InOutVector is used as the starting guess when
+	 * sized to the graph, and receives the unit-norm result. Returns false on a degenerate graph.
+	 */
+	bool LanczosFiedler(const FCSRGraph& Graph, const FLanczosSettings& Settings, TArray<double>& InOutVector);
+
+	/**
+	 * Same as LanczosFiedler, warm-started from a multilevel hierarchy: the graph is coarsened by heavy-edge matching,
+	 * solved at the coarsest level, then the vector is interpolated back up and refined at each level.
+	 */
+	bool MultilevelFiedler(const FCSRGraph& Graph, const FLanczosSettings& Settings, TArray<double>& OutVector);
+}
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "CoreMinimal.h"
+#include "Core/PCGExDecompBitGrid.h"
 #include "Core/PCGExDecompOccupancyGrid.h"
 #include "Core/PCGExDecompositionOperation.h"
 
@@ -29,16 +30,26 @@ public:
 	virtual bool Decompose(FPCGExDecompositionResult& OutResult) override;
 
 protected:
+	/** Best-scoring box among those whose Z range starts at a given slab */
+	struct FSlabBest
+	{
+		double Score = -1.0;
+		int32 Volume = 0;
+		FIntVector Min = FIntVector::ZeroValue;
+		FIntVector Max = FIntVector::ZeroValue;
+	};
+
 	/**
-	 * Find the largest axis-aligned box where ALL voxels are available.
-	 * Uses the 2D histogram largest-rectangle method extended to 3D via Z-range iteration.
+	 * Find the best axis-aligned box starting at slab Z1 where ALL voxels are available.
+	 * Uses the 2D histogram largest-rectangle method over Z-ranges [Z1, Z2].
+	 * Claiming voxels can only shrink the candidate set, so with pure volume scoring a slab's result
+	 * stays valid until a claimed box overlaps it -- the caller only re-runs slabs that were hit.
+	 * Balanced scoring isn't local to the box, so there every slab reaching the claimed box is re-run.
 	 */
-	bool FindLargestBox(
-		const FPCGExDecompOccupancyGrid& Grid,
-		const TBitArray<>& Available,
-		FIntVector& OutMin,
-		FIntVector& OutMax,
-		int32& OutVolume) const;
+	void FindLargestBoxInSlab(
+		const PCGExDecomposition::FBitGrid& Available,
+		int32 Z1,
+		FSlabBest& OutBest) const;
 
 	/** Post-process: iteratively merge adjacent cells that together form a perfect box. */
 	void MergeAdjacentCells(
@@ -53,10 +64,9 @@ protected:
 		const FIntVector& BoxMin,
 		const FIntVector& BoxMax,
 		const FIntVector& MaxExtent,
-		TBitArray<>& Available,
+		PCGExDecomposition::FBitGrid& Available,
 		TArray<int32>& VoxelCellIDs,
 		int32& NextCellID,
-		int32& RemainingCount,
 		TArray<int32>& CellVoxelCounts) const;
 };
 
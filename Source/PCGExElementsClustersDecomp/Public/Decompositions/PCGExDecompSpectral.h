@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 #include "Core/PCGExDecompositionOperation.h"
+#include "Core/PCGExSpectralSolver.h"
 
 #include "PCGExDecompSpectral.generated.h"
 
@@ -16,10 +17,17 @@ enum class EPCGExDecompSpectralPartitionMode : uint8
 	Exact    = 2 UMETA(DisplayName = "Exact", ToolTip="Reach exactly NumPartitions whenever the cluster has at least that many valid nodes: after balanced bisection, keep splitting the largest partition until the count is met. Extra cuts may be arbitrary when the graph has no further natural boundary."),
 };
 
+UENUM()
+enum class EPCGExDecompSpectralSolver : uint8
+{
+	PowerIteration = 0 UMETA(DisplayName = "Power Iteration", ToolTip="Shifted power iteration. Simple, but converges slowly on large or elongated clusters."),
+	Lanczos        = 1 UMETA(DisplayName = "Lanczos", ToolTip="Restarted Lanczos, iterated until the eigenvector residual meets the convergence tolerance. Much faster on large clusters."),
+};
+
 /**
  * Spectral decomposition operation.
  * Computes the graph Laplacian L=D-A, finds the Fiedler vector (2nd smallest eigenvector)
- * via shifted power iteration, and bisects by sign. Recursive for k-way partitioning.
+ * via shifted power iteration or Lanczos, and bisects by sign. Recursive for k-way partitioning.
  */
 class FPCGExDecompSpectral : public FPCGExDecompositionOperation
 {
@@ -28,13 +36,18 @@ public:
 	int32 MaxIterations = 200;
 	double ConvergenceTolerance = 1e-6;
 	EPCGExDecompSpectralPartitionMode PartitionMode = EPCGExDecompSpectralPartitionMode::Natural;
+	EPCGExDecompSpectralSolver Solver = EPCGExDecompSpectralSolver::PowerIteration;
+	bool bMultilevel = true;
 
 	virtual bool Decompose(FPCGExDecompositionResult& OutResult) override;
 
 protected:
-	/** Compute the Fiedler vector (2nd-smallest Laplacian eigenvector) for a subset via shifted
-	 *  power iteration. Returns false only when the subset is too small or the spectrum is
-	 *  degenerate; if the iteration reaches MaxIterations without fully converging, the best
+	/** Weighted Laplacian of the whole cluster, indexed by NodeIndex. Subsets extract from it rather than re-scoring edges. */
+	PCGExDecomposition::Spectral::FCSRGraph Graph;
+
+	/** Compute the Fiedler vector (2nd-smallest Laplacian eigenvector) for a subset with the
+	 *  selected solver. Returns false only when the subset is too small or the spectrum is
+	 *  degenerate; if the solver hits its iteration cap without fully converging, the best
 	 *  current estimate is still returned. */
 	bool ComputeFiedlerVector(
 		const TArray<int32>& SubsetNodeIndices,
@@ -81,11 +94,19 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ClampMin="2"))
 	int32 NumPartitions = 2;
 
-	/** Maximum iterations for power iteration convergence. */
+	/** Eigensolver used to find the Fiedler vector. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
+	EPCGExDecompSpectralSolver Solver = EPCGExDecompSpectralSolver::PowerIteration;
+
+	/** Seed Lanczos from a coarsened version of the cluster (heavy-edge matching), solved first and interpolated back. Speeds up convergence on large clusters. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, EditCondition="Solver == EPCGExDecompSpectralSolver::Lanczos", EditConditionHides))
+	bool bMultilevel = true;
+
+	/** Maximum iterations for power iteration convergence. With Lanczos, maximum number of restart cycles. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable, ClampMin="10"))
 	int32 MaxIterations = 200;
 
-	/** Convergence tolerance for eigenvector computation. */
+	/** Convergence tolerance for eigenvector computation. With Lanczos, applies to the eigenvector residual relative to the spectrum's bound. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta=(PCG_Overridable))
 	double ConvergenceTolerance = 1e-6;
 
@@ -96,5 +117,7 @@ public:
 	                                     Operation->MaxIterations = MaxIterations;
 	                                     Operation->ConvergenceTolerance = ConvergenceTolerance;
 	                                     Operation->PartitionMode = PartitionMode;
+	                                     Operation->Solver = Solver;
+	                                     Operation->bMultilevel = bMultilevel;
 	                                     })
 };
@@ -308,7 +308,7 @@ namespace PCGExBuildDelaunayGraph
 		}
 
 		GraphBuilder = MakeShared<PCGExGraphs::FGraphBuilder>(PointDataFacade, &Settings->GraphBuilderDetails);
-		GraphBuilder->Graph->InsertEdges(Delaunay->DelaunayEdges, -1);
+		GraphBuilder->Graph->InsertEdges(Delaunay->Edges, -1);
 		GraphBuilder->CompileAsync(TaskManager, false);
 
 		if (!Settings->bMarkHull && !Settings->bOutputSites)
@@ -325,7 +325,7 @@ namespace PCGExBuildDelaunayGraph
 
 		PCGEX_SCOPE_LOOP(Index)
 		{
-			HullMarkPointWriter->SetValue(Index, Delaunay->DelaunayHull.Contains(Index));
+			HullMarkPointWriter->SetValue(Index, Delaunay->IsOnHull(Index));
 		}
 	}
 
@@ -397,7 +397,7 @@ namespace PCGExBuildDelaunayGraph2D
 			//	GraphBuilder->OutputPointIndices = OutputIndices;
 		}
 
-		GraphBuilder->Graph->InsertEdges(Delaunay->DelaunayEdges, -1);
+		GraphBuilder->Graph->InsertEdges(Delaunay->Edges, -1);
 		GraphBuilder->CompileAsync(TaskManager, false);
 
 		if (!Settings->bMarkHull && !Settings->bOutputSites)
@@ -414,7 +414,7 @@ namespace PCGExBuildDelaunayGraph2D
 		const TArray<int32>& OutputIndicesRef = *OutputIndices.Get();
 		PCGEX_SCOPE_LOOP(Index)
 		{
-			HullMarkPointWriter->SetValue(Index, Delaunay->DelaunayHull.Contains(Index));
+			HullMarkPointWriter->SetValue(Index, Delaunay->IsOnHull(Index));
 		}
 	}
 
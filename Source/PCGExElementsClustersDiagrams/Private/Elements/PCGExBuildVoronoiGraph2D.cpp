@@ -315,7 +315,7 @@ namespace PCGExBuildVoronoiGraph2D
 			TRACE_CPUPROFILER_EVENT_SCOPE(PCGExBuildVoronoiGraph2D::SitesSetup);
 
 			IsVtxValid.Init(true, NumInputPoints);
-			for (const int32 HullVtx : Voronoi->Delaunay->DelaunayHull)
+			for (const int32 HullVtx : Voronoi->Delaunay->Hull)
 			{
 				IsVtxValid[HullVtx] = false;
 			}
@@ -17,6 +17,7 @@ MACRO(MaxValue, _TYPE, _TYPE{})\
 MACRO(SetMinValue, _TYPE, _TYPE{})\
 MACRO(SetMaxValue, _TYPE, _TYPE{})\
 MACRO(AverageValue, _TYPE, _TYPE{})\
+MACRO(MedianValue, _TYPE, _TYPE{})\
 MACRO(UniqueValuesNum, int32, 0)\
 MACRO(UniqueSetValuesNum, int32, 0)\
 MACRO(DifferentValuesNum, int32, 0)\
@@ -19,6 +19,10 @@
 #include "Types/PCGExAttributeIdentity.h"
 #include "Types/PCGExTypeOps.h"
 #include "Types/PCGExTypeTraits.h"
+#include "Core/PCGExMTCommon.h"
+#include "Math/PCGExMathSketches.h"
+
+#include <algorithm>
 
 #include "PCGExAttributeStats.generated.h"
 
@@ -134,6 +138,14 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, DisplayName = "Average", EditCondition="bOutputAverageValue"))
 	FName AverageValueAttributeName = FName(TEXT("Average"));
 
+	/** Write the median value (lower median for even counts). Only computed for numeric scalar types, others write a default value. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, InlineEditConditionToggle))
+	bool bOutputMedianValue = false;
+
+	/** Attribute name for the median value. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, DisplayName = "Median", EditCondition="bOutputMedianValue"))
+	FName MedianValueAttributeName = FName(TEXT("Median"));
+
 	/** Write the count of values that appear exactly once. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs", meta = (PCG_Overridable, InlineEditConditionToggle))
 	bool bOutputUniqueValuesNum = true;
@@ -227,6 +239,18 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Outputs (Unique Values)", meta = (PCG_Overridable, DisplayName = "Value Count", EditCondition="bOutputPerUniqueValuesStats"))
 	FName ValueCountAttributeName = FName(TEXT("Count"));
 
+	/**
+	 * On large inputs, estimate Different Values Num, Different Set Values Num and Median with mergeable sketches
+	 * (HyperLogLog, t-digest) instead of exact tables. Only kicks in when no output needs exact per-value counts
+	 * (unique counts, per-value stats, or the most frequent value used as average for non-numeric types).
+	 */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Performance", meta = (PCG_Overridable))
+	bool bApproximateLargeInputs = false;
+
+	/** Number of points from which approximation is used. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = "Settings|Performance", meta = (PCG_Overridable, EditCondition="bApproximateLargeInputs", ClampMin=1))
+	int32 ApproximateThreshold = 1000000;
+
 	/** Suppress warnings when attribute type doesn't support stats computation. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	bool bQuietTypeMismatchWarning = false;
@@ -285,11 +309,39 @@ namespace PCGExAttributeStats
 		}
 	};
 
+	// Fixed-size scopes, so partial results and their merge order don't depend on the worker count
+	constexpr int32 ScopeSize = 32768;
+	constexpr int32 ShardBits = 4;
+	constexpr int32 NumShards = 1 << ShardBits;
+
+	/** Per-scope reduction, folded in scope order once every scope is done. */
+	template <typename T>
+	struct TStatsPartial
+	{
+		T Min = T{};
+		T Max = T{};
+		T SetMin = T{};
+		T SetMax = T{};
+		T Sum = T{};
+		int32 Count = 0;
+		int32 DefaultCount = 0;
+	};
+
+	/** Occurrences of a distinct value, and where it first showed up so merged tables keep input order. */
+	struct FValueCount
+	{
+		int32 Count = 0;
+		int32 First = MAX_int32;
+	};
+
 	template <typename T>
 	class TAttributeStats : public IAttributeStats
 	{
 		using Traits = PCGExTypes::TTraits<T>;
 
+		static constexpr bool bNoAverage = std::is_same_v<T, FString> || std::is_same_v<T, FName> || std::is_same_v<T, FSoftObjectPath> || std::is_same_v<T, FSoftClassPath>;
+		static constexpr bool bHasMedian = std::is_arithmetic_v<T> && !std::is_same_v<T, bool>;
+
 	public:
 		T DefaultValue = T{};
 		T MinValue = T{};
@@ -298,6 +350,7 @@ namespace PCGExAttributeStats
 		T SetMaxValue = T{};
 		T AverageValue = T{};
 		T AverageSetValue = T{};
+		T MedianValue = T{};
 		T MaxUniqueValue = T{};
 		T MinUniqueValue = T{};
 		int32 UniqueValuesNum = 0;
@@ -334,10 +387,6 @@ namespace PCGExAttributeStats
 		PointsMetadata->FindOrCreateAttribute<_TYPE>(PrintName, _VALUE);} }
 
 			TSharedPtr<PCGExData::TBuffer<T>> Buffer = InDataFacade->GetReadable<T>(Identity.GetIdentifier());
-			SetMinValue = MinValue = Traits::Max();
-			SetMaxValue = MaxValue = Traits::Min();
-
-#define PCGEX_NO_AVERAGE if constexpr (std::is_same_v<T, FString> || std::is_same_v<T, FName> || std::is_same_v<T, FSoftObjectPath> || std::is_same_v<T, FSoftClassPath>)
 
 			if (!Buffer)
 			{
@@ -369,121 +418,267 @@ namespace PCGExAttributeStats
 				}
 
 				const int32 NumPoints = InDataFacade->GetNum();
-				TMap<T, int32> ValuesCount;
-				TMap<T, int32> SetValuesCount;
-				ValuesCount.Reserve(NumPoints);
-				SetValuesCount.Reserve(NumPoints);
-
 				DefaultValue = Buffer->InAttribute->template GetValueFromItemKey<T>(PCGDefaultValueKey);
+
+				// Distinct-value tables are only built for the outputs that need them.
+				// Sketches can only stand in for distinct counts and the median: per-value counts always need exact tables.
+				const bool bNeedsValueCounts =
+					UniqueValuesParamData || Settings->bOutputUniqueValuesNum || Settings->bOutputUniqueSetValuesNum ||
+					Settings->bOutputHasOnlyUniqueValues || (bNoAverage && Settings->bOutputAverageValue);
+				const bool bNeedsDistinct = bNeedsValueCounts || Settings->bOutputDifferentValuesNum || Settings->bOutputDifferentSetValuesNum;
+				const bool bNeedsMedian = bHasMedian && Settings->bOutputMedianValue;
+
+				const bool bApproximate = Settings->bApproximateLargeInputs && NumPoints >= Settings->ApproximateThreshold && !bNeedsValueCounts;
+				const bool bExactDistinct = bNeedsDistinct && !bApproximate;
+
+				const int32 NumScopes = FMath::DivideAndRoundUp(NumPoints, ScopeSize);
+
+				TArray<TStatsPartial<T>> Partials;
+				Partials.SetNum(NumScopes);
+
+				TArray<TMap<T, FValueCount>> ScopeCounts; // NumShards per scope
+				TArray<TArray<T>> ScopeValues;
+				TArray<PCGExMath::FHyperLogLog> ScopeDistinct;
+				TArray<PCGExMath::FHyperLogLog> ScopeSetDistinct;
+				TArray<PCGExMath::FTDigest> ScopeDigests;
+
+				if (bExactDistinct) { ScopeCounts.SetNum(NumScopes * NumShards); }
+				else if (bNeedsDistinct)
+				{
+					ScopeDistinct.SetNum(NumScopes);
+					ScopeSetDistinct.SetNum(NumScopes);
+				}
+
+				if (bNeedsMedian)
+				{
+					if (bApproximate) { ScopeDigests.SetNum(NumScopes); }
+					else { ScopeValues.SetNum(NumScopes); }
+				}
+
+				PCGExMT::ParallelOrSequential(
+					NumScopes,
+					[&](const int32 s)
+					{
+						TStatsPartial<T>& Partial = Partials[s];
+						Partial.SetMin = Partial.Min = Traits::Max();
+						Partial.SetMax = Partial.Max = Traits::Min();
+
+						const int32 End = FMath::Min((s + 1) * ScopeSize, NumPoints);
+						for (int32 i = s * ScopeSize; i < End; i++)
+						{
+							if (!Filter[i])
+							{
+								continue;
+							}
+
+							Partial.Count++;
+
+							const T& Value = Buffer->Read(i);
+
+							TypeOps->BlendMin(&Value, &Partial.Min, &Partial.Min);
+							TypeOps->BlendMax(&Value, &Partial.Max, &Partial.Max);
+
+							if constexpr (!bNoAverage)
+							{
+								TypeOps->BlendAdd(&Value, &Partial.Sum, &Partial.Sum);
+							}
+
+							const bool bIsDefault = PCGExCompare::StrictlyEqual(Value, DefaultValue);
+							if (bIsDefault)
+							{
+								Partial.DefaultCount++;
+							}
+							else
+							{
+								TypeOps->BlendMin(&Value, &Partial.SetMin, &Partial.SetMin);
+								TypeOps->BlendMax(&Value, &Partial.SetMax, &Partial.SetMax);
+							}
+
+							if (bExactDistinct)
+							{
+								// Top hash bits pick the shard, TMap buckets use the low ones
+								const uint32 Hash = GetTypeHash(Value);
+								FValueCount& Counter = ScopeCounts[s * NumShards + (Hash >> (32 - ShardBits))].FindOrAddByHash(Hash, Value);
+								if (!Counter.Count++) { Counter.First = i; }
+							}
+							else if (!ScopeDistinct.IsEmpty())
+							{
+								const uint32 Hash = GetTypeHash(Value);
+								ScopeDistinct[s].Add(Hash);
+								if (!bIsDefault) { ScopeSetDistinct[s].Add(Hash); }
+							}
+
+							if constexpr (bHasMedian)
+							{
+								if (!ScopeValues.IsEmpty()) { ScopeValues[s].Add(Value); }
+								else if (!ScopeDigests.IsEmpty()) { ScopeDigests[s].Add(static_cast<double>(Value)); }
+							}
+						}
+					}, 2);
+
+				// Fold partials in scope order, so results don't depend on scheduling
 				int32 NumValues = 0;
+				SetMinValue = MinValue = Traits::Max();
+				SetMaxValue = MaxValue = Traits::Min();
 
-				for (int i = 0; i < NumPoints; i++)
+				for (const TStatsPartial<T>& Partial : Partials)
 				{
-					if (!Filter[i])
+					if (!Partial.Count)
 					{
 						continue;
 					}
-					NumValues++;
 
-					const T& Value = Buffer->Read(i);
+					NumValues += Partial.Count;
+					DefaultValuesNum += Partial.DefaultCount;
 
-					TypeOps->BlendMin(&Value, &MinValue, &MinValue);
-					TypeOps->BlendMax(&Value, &MaxValue, &MaxValue);
+					TypeOps->BlendMin(&Partial.Min, &MinValue, &MinValue);
+					TypeOps->BlendMax(&Partial.Max, &MaxValue, &MaxValue);
+					TypeOps->BlendMin(&Partial.SetMin, &SetMinValue, &SetMinValue);
+					TypeOps->BlendMax(&Partial.SetMax, &SetMaxValue, &SetMaxValue);
 
-					PCGEX_NO_AVERAGE
-					{
-					}
-					else
+					if constexpr (!bNoAverage)
 					{
-						TypeOps->BlendAdd(&Value, &AverageValue, &AverageValue);
+						TypeOps->BlendAdd(&Partial.Sum, &AverageValue, &AverageValue);
 					}
+				}
+
+				Partials.Empty();
 
-					int32& Count = ValuesCount.FindOrAdd(Value, 0);
-					++Count;
+				// Distinct values, in order of first occurrence
+				TArray<TPair<T, FValueCount>> Distinct;
 
-					if (PCGExCompare::StrictlyEqual(Value, DefaultValue))
+				if (bExactDistinct)
+				{
+					// Shards hold disjoint values and are merged independently
+					TArray<TMap<T, FValueCount>> Merged;
+					Merged.SetNum(NumShards);
+
+					PCGExMT::ParallelOrSequential(
+						NumShards,
+						[&](const int32 h)
+						{
+							TMap<T, FValueCount>& Shard = Merged[h];
+							for (int32 s = 0; s < NumScopes; s++)
+							{
+								TMap<T, FValueCount>& Local = ScopeCounts[s * NumShards + h];
+								if (Shard.IsEmpty())
+								{
+									Shard = MoveTemp(Local);
+									continue;
+								}
+
+								for (const TPair<T, FValueCount>& Pair : Local)
+								{
+									FValueCount& Counter = Shard.FindOrAdd(Pair.Key);
+									Counter.Count += Pair.Value.Count;
+									Counter.First = FMath::Min(Counter.First, Pair.Value.First);
+								}
+
+								Local.Empty();
+							}
+						}, 2);
+
+					ScopeCounts.Empty();
+
+					int32 NumDistinct = 0;
+					for (const TMap<T, FValueCount>& Shard : Merged) { NumDistinct += Shard.Num(); }
+
+					Distinct.Reserve(NumDistinct);
+					for (TMap<T, FValueCount>& Shard : Merged)
 					{
-						DefaultValuesNum++;
+						for (const TPair<T, FValueCount>& Pair : Shard) { Distinct.Add(Pair); }
+						Shard.Empty();
 					}
-					else
-					{
-						int32& SetCount = SetValuesCount.FindOrAdd(Value, 0);
-						++SetCount;
 
-						TypeOps->BlendMin(&Value, &SetMinValue, &SetMinValue);
-						TypeOps->BlendMax(&Value, &SetMaxValue, &SetMaxValue);
-					}
-				}
+					Distinct.Sort([](const TPair<T, FValueCount>& A, const TPair<T, FValueCount>& B) { return A.Value.First < B.Value.First; });
 
-				PCGEX_NO_AVERAGE
-				{
-					// Pick the most present value.
-					int32 Max = -1;
-					for (const TPair<T, int32>& Pair : ValuesCount)
+					DifferentValuesNum = Distinct.Num();
+					for (const TPair<T, FValueCount>& Pair : Distinct)
 					{
-						if (Pair.Value > Max)
+						const bool bIsSet = !PCGExCompare::StrictlyEqual(Pair.Key, DefaultValue);
+						if (bIsSet) { DifferentSetValuesNum++; }
+						if (Pair.Value.Count == 1)
 						{
-							Max = Pair.Value;
-							AverageValue = Pair.Key;
+							UniqueValuesNum++;
+							if (bIsSet) { UniqueSetValuesNum++; }
 						}
 					}
 				}
-
-				if (UniqueValuesParamData)
+				else if (!ScopeDistinct.IsEmpty())
 				{
-					UPCGMetadata* UVM = UniqueValuesParamData->Metadata;
-					FPCGMetadataAttributeBase* UValues = UVM->FindOrCreateAttribute<T>(Settings->UniqueValueAttributeName, MinValue);
-					FPCGMetadataAttribute<int32>* UCount = UVM->FindOrCreateAttribute<int32>(Settings->ValueCountAttributeName, 0);
+					for (int32 s = 1; s < NumScopes; s++)
+					{
+						ScopeDistinct[0].Merge(ScopeDistinct[s]);
+						ScopeSetDistinct[0].Merge(ScopeSetDistinct[s]);
+					}
 
-					if (Settings->bOmitDefaultValue)
+					DifferentValuesNum = FMath::RoundToInt32(ScopeDistinct[0].Estimate());
+					DifferentSetValuesNum = FMath::RoundToInt32(ScopeSetDistinct[0].Estimate());
+				}
+
+				if constexpr (bHasMedian)
+				{
+					if (!ScopeValues.IsEmpty())
 					{
-						for (const TPair<T, int32>& Pair : SetValuesCount)
+						// Lower median, always one of the actual values
+						TArray<T> Values;
+						Values.Reserve(NumValues);
+						for (TArray<T>& Local : ScopeValues) { Values.Append(MoveTemp(Local)); }
+
+						if (!Values.IsEmpty())
 						{
-							int64 UVKey = UVM->AddEntry();
-							UValues->SetValue(UVKey, Pair.Key);
-							UCount->SetValue(UVKey, Pair.Value);
+							T* Mid = Values.GetData() + (Values.Num() - 1) / 2;
+							std::nth_element(Values.GetData(), Mid, Values.GetData() + Values.Num());
+							MedianValue = *Mid;
 						}
 					}
-					else
+					else if (!ScopeDigests.IsEmpty())
 					{
-						for (const TPair<T, int32>& Pair : ValuesCount)
+						for (int32 s = 1; s < NumScopes; s++) { ScopeDigests[0].Merge(ScopeDigests[s]); }
+
+						if (ScopeDigests[0].GetTotalWeight() > 0)
 						{
-							int64 UVKey = UVM->AddEntry();
-							UValues->SetValue(UVKey, Pair.Key);
-							UCount->SetValue(UVKey, Pair.Value);
+							const double Median = ScopeDigests[0].Quantile(0.5);
+							if constexpr (std::is_integral_v<T>) { MedianValue = static_cast<T>(FMath::RoundToDouble(Median)); }
+							else { MedianValue = static_cast<T>(Median); }
 						}
 					}
 				}
 
-				if (Settings->bOutputUniqueValuesNum)
+				if constexpr (bNoAverage)
 				{
-					UniqueValuesNum = 0;
-					for (const TPair<T, int32>& Pair : ValuesCount)
+					// Pick the most present value.
+					int32 Max = -1;
+					for (const TPair<T, FValueCount>& Pair : Distinct)
 					{
-						if (Pair.Value == 1)
+						if (Pair.Value.Count > Max)
 						{
-							UniqueValuesNum++;
+							Max = Pair.Value.Count;
+							AverageValue = Pair.Key;
 						}
 					}
 				}
 
-				if (Settings->bOutputUniqueSetValuesNum)
+				if (UniqueValuesParamData)
 				{
-					UniqueSetValuesNum = 0;
-					for (const TPair<T, int32>& Pair : SetValuesCount)
+					UPCGMetadata* UVM = UniqueValuesParamData->Metadata;
+					FPCGMetadataAttributeBase* UValues = UVM->FindOrCreateAttribute<T>(Settings->UniqueValueAttributeName, MinValue);
+					FPCGMetadataAttribute<int32>* UCount = UVM->FindOrCreateAttribute<int32>(Settings->ValueCountAttributeName, 0);
+
+					for (const TPair<T, FValueCount>& Pair : Distinct)
 					{
-						if (Pair.Value == 1)
+						if (Settings->bOmitDefaultValue && PCGExCompare::StrictlyEqual(Pair.Key, DefaultValue))
 						{
-							UniqueSetValuesNum++;
+							continue;
 						}
+
+						int64 UVKey = UVM->AddEntry();
+						UValues->SetValue(UVKey, Pair.Key);
+						UCount->SetValue(UVKey, Pair.Value.Count);
 					}
 				}
 
-				DifferentValuesNum = ValuesCount.Num();
-				DifferentSetValuesNum = SetValuesCount.Num();
-
-				ValuesCount.Empty();
-				SetValuesCount.Empty();
+				Distinct.Empty();
 
 				////// OUTPUT		
 
@@ -495,6 +690,7 @@ namespace PCGExAttributeStats
 				PCGEX_OUTPUT_STAT(SetMinValue, T, SetMinValue)
 				PCGEX_OUTPUT_STAT(SetMaxValue, T, SetMaxValue)
 				PCGEX_OUTPUT_STAT(AverageValue, T, AverageValue)
+				PCGEX_OUTPUT_STAT(MedianValue, T, MedianValue)
 				PCGEX_OUTPUT_STAT(UniqueValuesNum, int32, UniqueValuesNum)
 				PCGEX_OUTPUT_STAT(UniqueSetValuesNum, int32, UniqueSetValuesNum)
 				PCGEX_OUTPUT_STAT(DifferentValuesNum, int32, DifferentValuesNum)
@@ -507,7 +703,6 @@ namespace PCGExAttributeStats
 				PCGEX_OUTPUT_STAT(IsValid, bool, true)
 
 #undef PCGEX_OUTPUT_STAT
-#undef PCGEX_NO_AVERAGE
 			}
 		}
 	};
@@ -5,6 +5,7 @@
 
 #include "PCGExHeuristicsHandler.h"
 #include "Clusters/PCGExCluster.h"
+#include "Core/PCGExSearchAllocations.h"
 #include "Data/PCGExData.h"
 #include "Search/PCGExSearchOperation.h"
 
@@ -95,8 +96,11 @@ namespace PCGExPathfinding
 		}
 	}
 
-	void FPathQuery::FindPath(const TSharedPtr<FPCGExSearchOperation>& SearchOperation, const TSharedPtr<FSearchAllocations>& Allocations, const TSharedPtr<PCGExHeuristics::FHandler>& HeuristicsHandler, const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback)
+	void FPathQuery::FindPath(const TSharedPtr<FPCGExSearchOperation>& SearchOperation, const TSharedPtr<FSearchAllocations>& Allocations, const TSharedPtr<PCGExHeuristics::FHandler>& HeuristicsHandler, const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback, const bool bDeferGlobalFeedback)
 	{
+		ExploredNodes.Reset();
+		bExploredAll = false;
+
 		if (PickResolution != EQueryPickResolution::Success)
 		{
 			SetResolution(EPathfindingResolution::Fail);
@@ -114,6 +118,12 @@ namespace PCGExPathfinding
 			SetResolution(EPathfindingResolution::Fail);
 		}
 
+		if (bDeferGlobalFeedback)
+		{
+			// Without allocations of our own the search state is already gone
+			bExploredAll = !Allocations || !Allocations->GetExplored(ExploredNodes);
+		}
+
 		if (Resolution == EPathfindingResolution::Fail)
 		{
 			return;
@@ -129,7 +139,18 @@ namespace PCGExPathfinding
 			return;
 		}
 
-		if (HeuristicsHandler->HasGlobalFeedback() && LocalFeedback)
+		if (bDeferGlobalFeedback)
+		{
+			if (LocalFeedback)
+			{
+				for (int i = 0; i < PathEdges.Num(); i++)
+				{
+					LocalFeedback->FeedbackScore(NodesRef[PathNodes[i]], EdgesRef[PathEdges[i]]);
+				}
+				LocalFeedback->FeedbackPointScore(NodesRef[PathNodes.Last()]);
+			}
+		}
+		else if (HeuristicsHandler->HasGlobalFeedback() && LocalFeedback)
 		{
 			for (int i = 0; i < PathEdges.Num(); i++)
 			{
@@ -160,6 +181,41 @@ namespace PCGExPathfinding
 		}
 	}
 
+	void FPathQuery::CommitGlobalFeedback(const TSharedPtr<PCGExHeuristics::FHandler>& HeuristicsHandler) const
+	{
+		if (Resolution != EPathfindingResolution::Success || !HeuristicsHandler->HasGlobalFeedback())
+		{
+			return;
+		}
+
+		const TArray<PCGExClusters::FNode>& NodesRef = *Cluster->Nodes;
+		const TArray<PCGExGraphs::FEdge>& EdgesRef = *Cluster->Edges;
+
+		for (int i = 0; i < PathEdges.Num(); i++)
+		{
+			HeuristicsHandler->FeedbackScore(NodesRef[PathNodes[i]], EdgesRef[PathEdges[i]]);
+		}
+		HeuristicsHandler->FeedbackPointScore(NodesRef[PathNodes.Last()]);
+	}
+
+	bool FPathQuery::HasExploredAny(const TBitArray<>& InNodes) const
+	{
+		if (bExploredAll)
+		{
+			return InNodes.Find(true) != INDEX_NONE;
+		}
+
+		for (const int32 Index : ExploredNodes)
+		{
+			if (InNodes[Index])
+			{
+				return true;
+			}
+		}
+
+		return false;
+	}
+
 	void FPathQuery::AppendNodePoints(TArray<int32>& OutPoints, const int32 TruncateStart, const int32 TruncateEnd) const
 	{
 		const int32 Count = PathNodes.Num() - TruncateEnd;
@@ -179,5 +235,43 @@ namespace PCGExPathfinding
 	{
 		PathNodes.Empty();
 		PathEdges.Empty();
+		ExploredNodes.Empty();
+	}
+
+	void FCommittedNodes::Init(const int32 NumNodes)
+	{
+		Flags.Init(false, NumNodes);
+		Nodes.Reset();
+	}
+
+	void FCommittedNodes::Add(const FPathQuery& InQuery)
+	{
+		if (!InQuery.IsQuerySuccessful())
+		{
+			return;
+		}
+
+		for (const int32 Index : InQuery.PathNodes)
+		{
+			if (!Flags[Index])
+			{
+				Flags[Index] = true;
+				Nodes.Add(Index);
+			}
+		}
+	}
+
+	bool FCommittedNodes::Invalidates(const FPathQuery& InQuery) const
+	{
+		return !Nodes.IsEmpty() && InQuery.HasExploredAny(Flags);
+	}
+
+	void FCommittedNodes::Reset()
+	{
+		for (const int32 Index : Nodes)
+		{
+			Flags[Index] = false;
+		}
+		Nodes.Reset();
 	}
 }
@@ -30,6 +30,13 @@ namespace PCGExPathfinding
 		ResetSearchState(ScoredQueue, Visited, GScore, GScoreInit, TravelStack);
 	}
 
+	bool FSearchAllocations::GetExplored(TArray<int32>& OutNodes) const
+	{
+		// Searches score a node before enqueuing it, and read edges between enqueued nodes only
+		OutNodes.Append(ScoredQueue->GetTouched());
+		return true;
+	}
+
 	void FSearchAllocations::ResetSearchState(const TSharedPtr<PCGEx::FScoredQueue>& InQueue, TBitArray<>& InVisited, TArray<double>& InGScore, const double InGScoreInit, const TSharedPtr<PCGEx::FHashLookup>& InTravelStack) const
 	{
 		const TArray<int32>& Touched = InQueue->GetTouched();
@@ -10,6 +10,7 @@
 #include "Clusters/PCGExCluster.h"
 #include "Clusters/PCGExClustersHelpers.h"
 #include "Core/PCGExHeuristicsFactoryProvider.h"
+#include "Core/PCGExMTCommon.h"
 #include "Core/PCGExPathQuery.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointIO.h"
@@ -351,6 +352,13 @@ namespace PCGExPathfindingEdges
 			SearchAllocations = SearchOperation->NewAllocations();
 		}
 
+		// Scopes still run one after another, but each one is solved as a parallel wave
+		bOptimisticWaves = HeuristicsHandler->HasGlobalFeedback() && Settings->bGreedyQueries && Settings->bOptimisticFeedback;
+		if (bOptimisticWaves)
+		{
+			CommittedNodes.Init(Cluster->Nodes->Num());
+		}
+
 		const int32 NumQueries = Context->SeedGoalPairs.Num();
 
 		// A single early-exit query may explore only a fraction of the cluster; anything more
@@ -411,13 +419,17 @@ namespace PCGExPathfindingEdges
 			}
 		}
 
-		StartParallelLoopForRange(Queries.Num(), bForceSingleThreadedProcessRange ? 12 : 1);
+		StartParallelLoopForRange(Queries.Num(), bOptimisticWaves ? Settings->OptimisticWaveSize : bForceSingleThreadedProcessRange ? 12 : 1);
 		return true;
 	}
 
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
-		const bool bVisited = Settings->OutputMode == EPCGExPathfindingOutputMode::Visited;
+		if (bOptimisticWaves)
+		{
+			ProcessWave(Scope);
+			return;
+		}
 
 		// Single-threaded mode shares one allocation set across all scopes; otherwise lease
 		// pooled allocations for this scope instead of allocating fresh ones per query.
@@ -453,21 +465,78 @@ namespace PCGExPathfindingEdges
 			}
 
 			Query->FindPath(SearchOperation, ScopedAllocations, HeuristicsHandler, nullptr);
+			OnQueryComplete(Query);
+		}
+	}
+
+	void FProcessor::ProcessWave(const PCGExMT::FScope& Scope)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPathfindingEdges::ProcessWave);
+
+		// Solve the whole wave against the feedback as it stands now; nothing writes to it until the commit pass
+		PCGExMT::ParallelOrSequential(Scope.Count, [&](const int32 i)
+		{
+			const TSharedPtr<PCGExPathfinding::FPathQuery>& Query = Queries[Scope.Start + i];
+			Query->ResolvePicks(Settings->SeedPicking, Settings->GoalPicking);
+
+			if (!Query->HasValidEndpoints())
+			{
+				return;
+			}
+
+			TSharedPtr<PCGExPathfinding::FSearchAllocations> LocalAllocations = SearchOperation->AcquireAllocations();
+			Query->FindPath(SearchOperation, LocalAllocations, HeuristicsHandler, nullptr, true);
+			SearchOperation->ReleaseAllocations(LocalAllocations);
+		}, 2);
+
+		// Commit in query order. A query that explored a path committed earlier in this wave saw stale feedback,
+		// solve it again against the current one -- which is exactly what sequential execution would have seen.
+		CommittedNodes.Reset();
+
+		PCGEX_SCOPE_LOOP(Index)
+		{
+			TSharedPtr<PCGExPathfinding::FPathQuery> Query = Queries[Index];
 
-			if (!Query->IsQuerySuccessful())
+			ON_SCOPE_EXIT
+			{
+				Query->Cleanup();
+			};
+
+			if (!Query->HasValidEndpoints())
 			{
 				continue;
 			}
 
-			if (bVisited)
+			if (CommittedNodes.Invalidates(*Query))
 			{
-				PCGExPathfinding::MarkQueryVisited(*Cluster, *Query, VisitedVtxData, VisitedEdgeData);
+				Query->Cleanup();
+				Query->FindPath(SearchOperation, SearchAllocations, HeuristicsHandler, nullptr);
 			}
 			else
 			{
-				Context->BuildPath(Query, QueriesIO[Query->QueryIndex]);
-				QueriesIO[Query->QueryIndex]->IOIndex = EdgeDataFacade->Source->IOIndex * 100000 + Query->QueryIndex;
+				Query->CommitGlobalFeedback(HeuristicsHandler);
 			}
+
+			CommittedNodes.Add(*Query);
+			OnQueryComplete(Query);
+		}
+	}
+
+	void FProcessor::OnQueryComplete(const TSharedPtr<PCGExPathfinding::FPathQuery>& Query)
+	{
+		if (!Query->IsQuerySuccessful())
+		{
+			return;
+		}
+
+		if (Settings->OutputMode == EPCGExPathfindingOutputMode::Visited)
+		{
+			PCGExPathfinding::MarkQueryVisited(*Cluster, *Query, VisitedVtxData, VisitedEdgeData);
+		}
+		else
+		{
+			Context->BuildPath(Query, QueriesIO[Query->QueryIndex]);
+			QueriesIO[Query->QueryIndex]->IOIndex = EdgeDataFacade->Source->IOIndex * 100000 + Query->QueryIndex;
 		}
 	}
 
@@ -274,6 +274,8 @@ namespace PCGExFindContours
 		AllCellsIncludingFailed = AllCells;
 		AllCellsIncludingFailed.Append(FailedCells);
 
+		CellLocator = MakeShared<PCGExClusters::FCellLocator>(AllCellsIncludingFailed);
+
 		if (AllCells.IsEmpty() && WrapperCell)
 		{
 			// No valid internal cells - check if any seed can claim wrapper
@@ -284,7 +286,10 @@ namespace PCGExFindContours
 		// Store valid cells for parallel processing
 		EnumeratedCells = MoveTemp(AllCells);
 
-		// Process cells in parallel to find which seeds they contain
+		// Locate every seed once through the cell index, rather than testing each seed against each cell
+		CellLocator->GroupPoints(Seeds->Num(), [&](const int32 SeedIdx) { return Seeds->GetProjected(SeedIdx); }, CellSeedsStart, CellSeeds);
+
+		// Process cells in parallel to pick a winner among the seeds they contain
 		StartParallelLoopForRange(EnumeratedCells.Num(), 64);
 
 		return true;
@@ -297,7 +302,6 @@ namespace PCGExFindContours
 
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
-		const int32 NumSeeds = Seeds->Num();
 		const TSharedPtr<PCGExCells::FSeedOwnershipHandler>& SeedOwnership = Context->SeedOwnership;
 		const bool bNeedsAllCandidates = SeedOwnership->NeedsAllCandidates();
 
@@ -317,27 +321,15 @@ namespace PCGExFindContours
 
 			CandidateSeeds.Reset();
 
-			// Find all seeds inside this cell
-			for (int32 SeedIdx = 0; SeedIdx < NumSeeds; ++SeedIdx)
+			// Seeds inside this cell, already in seed order
+			for (int32 i = CellSeedsStart[CellIndex]; i < CellSeedsStart[CellIndex + 1]; i++)
 			{
-				const FVector2D& SeedPoint = Seeds->GetProjected(SeedIdx);
+				CandidateSeeds.Add(CellSeeds[i]);
 
-				// AABB early-out
-				if (!Cell->Bounds2D.IsInside(SeedPoint))
+				// For SeedOrder mode, first match wins - break early
+				if (!bNeedsAllCandidates)
 				{
-					continue;
-				}
-
-				// Fine polygon check
-				if (PCGExMath::Geo::IsPointInPolygon(SeedPoint, Cell->Polygon))
-				{
-					CandidateSeeds.Add(SeedIdx);
-
-					// For SeedOrder mode, first match wins - break early
-					if (!bNeedsAllCandidates)
-					{
-						break;
-					}
+					break;
 				}
 			}
 
@@ -369,21 +361,7 @@ namespace PCGExFindContours
 		for (int32 SeedIdx = 0; SeedIdx < NumSeeds; ++SeedIdx)
 		{
 			// Check if seed is inside any internal cell (consumed)
-			bool bConsumed = false;
-			const FVector2D& SeedPoint = Seeds->GetProjected(SeedIdx);
-
-			for (const TSharedPtr<PCGExClusters::FCell>& Cell : AllCellsIncludingFailed)
-			{
-				if (Cell && !Cell->Polygon.IsEmpty() &&
-					Cell->Bounds2D.IsInside(SeedPoint) &&
-					PCGExMath::Geo::IsPointInPolygon(SeedPoint, Cell->Polygon))
-				{
-					bConsumed = true;
-					break;
-				}
-			}
-
-			if (bConsumed)
+			if (CellLocator->IsInsideAny(Seeds->GetProjected(SeedIdx)))
 			{
 				continue;
 			}
@@ -583,15 +561,9 @@ namespace PCGExFindContours
 
 				const FVector2D& SeedPoint = Seeds->GetProjected(SeedIdx);
 
-				for (const TSharedPtr<PCGExClusters::FCell>& Cell : AllCellsIncludingFailed)
+				if (CellLocator->IsInsideAny(SeedPoint))
 				{
-					if (Cell && !Cell->Polygon.IsEmpty() &&
-						Cell->Bounds2D.IsInside(SeedPoint) &&
-						PCGExMath::Geo::IsPointInPolygon(SeedPoint, Cell->Polygon))
-					{
-						ConsumedSeeds.Add(SeedIdx);
-						break;
-					}
+					ConsumedSeeds.Add(SeedIdx);
 				}
 			}
 
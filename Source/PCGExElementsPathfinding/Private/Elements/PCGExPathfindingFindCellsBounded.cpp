@@ -426,6 +426,8 @@ namespace PCGExFindContoursBounded
 		AllCellsIncludingFailed = AllCells;
 		AllCellsIncludingFailed.Append(FailedCells);
 
+		CellLocator = MakeShared<PCGExClusters::FCellLocator>(AllCellsIncludingFailed);
+
 		// Build adjacency map if growth is enabled
 		if (Context->SeedGrowth.HasPotentialGrowth())
 		{
@@ -449,6 +451,10 @@ namespace PCGExFindContoursBounded
 		}
 
 		EnumeratedCells = MoveTemp(AllCells);
+
+		// Locate every seed once through the cell index, rather than testing each seed against each cell
+		CellLocator->GroupPoints(Seeds->Num(), [&](const int32 SeedIdx) { return Seeds->GetProjected(SeedIdx); }, CellSeedsStart, CellSeeds);
+
 		StartParallelLoopForRange(EnumeratedCells.Num(), 64);
 
 		return true;
@@ -461,7 +467,6 @@ namespace PCGExFindContoursBounded
 
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
-		const int32 NumSeeds = Seeds->Num();
 		const TSharedPtr<PCGExCells::FSeedOwnershipHandler>& SeedOwnership = Context->SeedOwnership;
 		const bool bNeedsAllCandidates = SeedOwnership->NeedsAllCandidates();
 
@@ -481,25 +486,15 @@ namespace PCGExFindContoursBounded
 
 			CandidateSeeds.Reset();
 
-			// Find all seeds inside this cell
-			for (int32 SeedIdx = 0; SeedIdx < NumSeeds; ++SeedIdx)
+			// Seeds inside this cell, already in seed order
+			for (int32 i = CellSeedsStart[CellIndex]; i < CellSeedsStart[CellIndex + 1]; i++)
 			{
-				const FVector2D& SeedPoint = Seeds->GetProjected(SeedIdx);
-
-				if (!Cell->Bounds2D.IsInside(SeedPoint))
-				{
-					continue;
-				}
+				CandidateSeeds.Add(CellSeeds[i]);
 
-				if (PCGExMath::Geo::IsPointInPolygon(SeedPoint, Cell->Polygon))
+				// For SeedOrder mode, first match wins - break early
+				if (!bNeedsAllCandidates)
 				{
-					CandidateSeeds.Add(SeedIdx);
-
-					// For SeedOrder mode, first match wins - break early
-					if (!bNeedsAllCandidates)
-					{
-						break;
-					}
+					break;
 				}
 			}
 
@@ -551,21 +546,7 @@ namespace PCGExFindContoursBounded
 
 		for (int32 SeedIdx = 0; SeedIdx < NumSeeds; ++SeedIdx)
 		{
-			bool bConsumed = false;
-			const FVector2D& SeedPoint = Seeds->GetProjected(SeedIdx);
-
-			for (const TSharedPtr<PCGExClusters::FCell>& Cell : AllCellsIncludingFailed)
-			{
-				if (Cell && !Cell->Polygon.IsEmpty() &&
-					Cell->Bounds2D.IsInside(SeedPoint) &&
-					PCGExMath::Geo::IsPointInPolygon(SeedPoint, Cell->Polygon))
-				{
-					bConsumed = true;
-					break;
-				}
-			}
-
-			if (bConsumed)
+			if (CellLocator->IsInsideAny(Seeds->GetProjected(SeedIdx)))
 			{
 				continue;
 			}
@@ -842,15 +823,9 @@ namespace PCGExFindContoursBounded
 
 				const FVector2D& SeedPoint = Seeds->GetProjected(SeedIdx);
 
-				for (const TSharedPtr<PCGExClusters::FCell>& Cell : AllCellsIncludingFailed)
+				if (CellLocator->IsInsideAny(SeedPoint))
 				{
-					if (Cell && !Cell->Polygon.IsEmpty() &&
-						Cell->Bounds2D.IsInside(SeedPoint) &&
-						PCGExMath::Geo::IsPointInPolygon(SeedPoint, Cell->Polygon))
-					{
-						ConsumedSeeds.Add(SeedIdx);
-						break;
-					}
+					ConsumedSeeds.Add(SeedIdx);
 				}
 			}
 
@@ -24,6 +24,12 @@ namespace PCGExPathfinding
 			Value = GScoreInit;
 		}
 	}
+
+	bool FBellmanFordSearchAllocations::GetExplored(TArray<int32>& OutNodes) const
+	{
+		// Relaxes every edge of the cluster
+		return false;
+	}
 }
 
 bool FPCGExSearchOperationBellmanFord::ResolveQuery(
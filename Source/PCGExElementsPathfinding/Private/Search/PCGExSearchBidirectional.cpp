@@ -29,6 +29,13 @@ namespace PCGExPathfinding
 		FSearchAllocations::Reset();
 		ResetSearchState(ScoredQueueBackward, VisitedBackward, GScoreBackward, -1, TravelStackBackward);
 	}
+
+	bool FBidirectionalSearchAllocations::GetExplored(TArray<int32>& OutNodes) const
+	{
+		FSearchAllocations::GetExplored(OutNodes);
+		OutNodes.Append(ScoredQueueBackward->GetTouched());
+		return true;
+	}
 }
 
 bool FPCGExSearchOperationBidirectional::ResolveQuery(
@@ -56,6 +56,10 @@ namespace PCGExPathfinding
 
 		const int32 QueryIndex = -1;
 
+		// Recorded by deferred FindPath only
+		TArray<int32> ExploredNodes;
+		bool bExploredAll = false;
+
 		bool HasValidEndpoints() const
 		{
 			return Seed.IsValid() && Goal.IsValid() && PickResolution == EQueryPickResolution::Success;
@@ -77,11 +81,22 @@ namespace PCGExPathfinding
 		void AddPathNode(const int32 InNodeIndex, const int32 InEdgeIndex = -1);
 		void SetResolution(const EPathfindingResolution InResolution);
 
+		/**
+		 * @param bDeferGlobalFeedback Leave global feedback untouched and record the explored nodes instead,
+		 * so the result can be validated against other commits before calling CommitGlobalFeedback.
+		 */
 		void FindPath(
 			const TSharedPtr<FPCGExSearchOperation>& SearchOperation,
 			const TSharedPtr<FSearchAllocations>& Allocations,
 			const TSharedPtr<PCGExHeuristics::FHandler>& HeuristicsHandler,
-			const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback);
+			const TSharedPtr<PCGExHeuristics::FLocalFeedbackHandler>& LocalFeedback,
+			const bool bDeferGlobalFeedback = false);
+
+		/** Apply the global feedback a deferred FindPath skipped. */
+		void CommitGlobalFeedback(const TSharedPtr<PCGExHeuristics::FHandler>& HeuristicsHandler) const;
+
+		/** Whether the last deferred FindPath read scores from any of the given nodes. */
+		bool HasExploredAny(const TBitArray<>& InNodes) const;
 
 		void AppendNodePoints(TArray<int32>& OutPoints, const int32 TruncateStart = 0, const int32 TruncateEnd = 0) const;
 
@@ -89,4 +104,23 @@ namespace PCGExPathfinding
 
 		void Cleanup();
 	};
+
+	/**
+	 * Nodes crossed by paths committed since the last Reset.
+	 * Feedback only ever changes the scores of path nodes and of edges touching them, so a deferred query whose
+	 * explored nodes avoid this set would have found the exact same path had it run after those commits.
+	 */
+	class PCGEXELEMENTSPATHFINDING_API FCommittedNodes
+	{
+	public:
+		void Init(const int32 NumNodes);
+
+		void Add(const FPathQuery& InQuery);
+		bool Invalidates(const FPathQuery& InQuery) const;
+		void Reset();
+
+	protected:
+		TBitArray<> Flags;
+		TArray<int32> Nodes;
+	};
 }
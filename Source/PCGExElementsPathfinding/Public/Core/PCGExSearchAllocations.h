@@ -43,6 +43,10 @@ namespace PCGExPathfinding
 
 		virtual void Reset();
 
+		/** Nodes the last search scored, directly or through one of their edges. Valid until the next Reset.
+		 * Returns false when the search may have read any node of the cluster. */
+		virtual bool GetExplored(TArray<int32>& OutNodes) const;
+
 	protected:
 		/** Sparse-resets one set of search state, driven by the queue's touched list.
 		 * Valid as long as the search only dirties per-node state alongside queue enqueues. */
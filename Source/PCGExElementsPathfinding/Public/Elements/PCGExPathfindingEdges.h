@@ -7,6 +7,7 @@
 
 #include "Core/PCGExClustersProcessor.h"
 #include "Core/PCGExPathfinding.h"
+#include "Core/PCGExPathQuery.h"
 #include "Data/Utils/PCGExDataForwardDetails.h"
 #include "Paths/PCGExPathOutputDetails.h"
 #include "PCGExPathfindingEdges.generated.h"
@@ -124,6 +125,15 @@ public:
 	/** If disabled, will share memory allocations between queries, forcing them to execute one after another. Much slower, but very conservative for memory.  Using global feedback forces this behavior under the hood.*/
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay))
 	bool bGreedyQueries = true;
+
+	/** With global feedback, solve queries in parallel waves against the feedback as it was when the wave started, then commit them in order.
+	 * Only queries that explored a path committed earlier in the same wave are solved again, so output is identical to running them one after another. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay, EditCondition="bGreedyQueries"))
+	bool bOptimisticFeedback = true;
+
+	/** Number of queries solved together in an optimistic wave. Larger waves expose more parallelism, but are more likely to be solved again on dense networks. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Performance, meta=(PCG_NotOverridable, AdvancedDisplay, EditCondition="bGreedyQueries && bOptimisticFeedback", ClampMin=2))
+	int32 OptimisticWaveSize = 64;
 };
 
 struct FPCGExPathfindingEdgesContext final : FPCGExClustersProcessorContext
@@ -173,6 +183,10 @@ namespace PCGExPathfindingEdges
 		TArray<TSharedPtr<PCGExData::FPointIO>> QueriesIO;
 		TSharedPtr<PCGExPathfinding::FSearchAllocations> SearchAllocations;
 
+		// Optimistic global feedback: each range scope is a wave, see ProcessWave
+		bool bOptimisticWaves = false;
+		PCGExPathfinding::FCommittedNodes CommittedNodes;
+
 		// Visited mode: per-element counts written via atomic increments. The vtx buffer is owned
 		// by the batch (shared across the batch's clusters); the edge buffer is per-processor.
 		int32* VisitedVtxData = nullptr;
@@ -193,6 +207,10 @@ namespace PCGExPathfindingEdges
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager) override;
 		virtual void ProcessRange(const PCGExMT::FScope& Scope) override;
 		virtual void Write() override;
+
+	protected:
+		void ProcessWave(const PCGExMT::FScope& Scope);
+		void OnQueryComplete(const TSharedPtr<PCGExPathfinding::FPathQuery>& Query);
 	};
 
 	class FBatch final : public PCGExClusterMT::TBatch<FProcessor>
@@ -184,6 +184,9 @@ namespace PCGExFindContours
 		TSharedPtr<PCGExClusters::FCellPathBuilder> CellProcessor;
 		TArray<TSharedPtr<PCGExClusters::FCell>> EnumeratedCells;
 		TArray<TSharedPtr<PCGExClusters::FCell>> AllCellsIncludingFailed; // For checking seed consumption
+		TSharedPtr<PCGExClusters::FCellLocator> CellLocator; // Over AllCellsIncludingFailed
+		TArray<int32> CellSeedsStart;                        // Cell index -> first entry in CellSeeds
+		TArray<int32> CellSeeds;
 		TSharedPtr<PCGExClusters::FCell> WrapperCell;
 
 		TSharedPtr<PCGExMT::TScopedArray<TSharedPtr<PCGExClusters::FCell>>> ScopedValidCells;
@@ -228,6 +228,9 @@ namespace PCGExFindContoursBounded
 		TSharedPtr<PCGExClusters::FCellPathBuilder> CellProcessor;
 		TArray<TSharedPtr<PCGExClusters::FCell>> EnumeratedCells;
 		TArray<TSharedPtr<PCGExClusters::FCell>> AllCellsIncludingFailed;
+		TSharedPtr<PCGExClusters::FCellLocator> CellLocator; // Over AllCellsIncludingFailed
+		TArray<int32> CellSeedsStart;                        // Cell index -> first entry in CellSeeds
+		TArray<int32> CellSeeds;
 		TSharedPtr<PCGExClusters::FCell> WrapperCell;
 
 		TSharedPtr<PCGExMT::TScopedArray<TSharedPtr<PCGExClusters::FCell>>> ScopedValidCells;
@@ -23,6 +23,7 @@ namespace PCGExPathfinding
 	{
 	public:
 		virtual void Reset() override;
+		virtual bool GetExplored(TArray<int32>& OutNodes) const override;
 	};
 }
 
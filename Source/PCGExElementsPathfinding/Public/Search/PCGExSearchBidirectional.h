@@ -37,6 +37,7 @@ namespace PCGExPathfinding
 
 		virtual void Init(const PCGExClusters::FCluster* InCluster) override;
 		virtual void Reset() override;
+		virtual bool GetExplored(TArray<int32>& OutNodes) const override;
 	};
 }
 
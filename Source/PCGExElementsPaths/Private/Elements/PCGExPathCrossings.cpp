@@ -12,6 +12,7 @@
 #include "Data/PCGExDataTags.h"
 #include "Data/PCGExPointIO.h"
 #include "Math/PCGExMathDistances.h"
+#include "Paths/PCGExPathEdgeBVH.h"
 #include "Paths/PCGExPathsCommon.h"
 #include "Paths/PCGExPathsHelpers.h"
 
@@ -93,6 +94,45 @@ bool FPCGExPathCrossingsElement::Boot(FPCGExContext* InContext) const
 	return true;
 }
 
+const PCGExPaths::FPathEdgeBVH* FPCGExPathCrossingsContext::GetCutterBVH(const PCGExPointsMT::IBatch* InBatch)
+{
+	{
+		FReadScopeLock ReadScopeLock(CutterBVHLock);
+		if (CutterBVH) { return CutterBVH.Get(); }
+	}
+
+	FWriteScopeLock WriteScopeLock(CutterBVHLock);
+	if (CutterBVH) { return CutterBVH.Get(); }
+
+	// Path index in the BVH is the processor's batch index
+	const int32 NumProcessors = InBatch->GetNumProcessors();
+
+	TArray<TSharedPtr<PCGExPaths::FPath>> Cutters;
+	Cutters.Init(nullptr, NumProcessors);
+
+	TArray<const TBitArray<>*> CanCutEdges;
+	CanCutEdges.Init(nullptr, NumProcessors);
+
+	for (int32 i = 0; i < NumProcessors; i++)
+	{
+		const PCGExPathCrossings::FProcessor& P = static_cast<const PCGExPathCrossings::FProcessor&>(InBatch->Processors[i].Get());
+		if (!P.bIsProcessorValid || !P.bCanCut || !P.Path)
+		{
+			continue;
+		}
+
+		Cutters[i] = P.Path;
+		CanCutEdges[i] = &P.CanCut;
+	}
+
+	CutterBVH = MakeShared<PCGExPaths::FPathEdgeBVH>(Cutters, [&](const int32 PathIndex, const int32 EdgeIndex)
+	{
+		return (*CanCutEdges[PathIndex])[EdgeIndex];
+	});
+
+	return CutterBVH.Get();
+}
+
 bool FPCGExPathCrossingsElement::AdvanceWork(FPCGExContext* InContext, const UPCGExSettings* InSettings) const
 {
 	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExPathCrossingsElement::Execute);
@@ -235,12 +275,17 @@ namespace PCGExPathCrossings
 		CanCutFilterManager.Reset();
 		CanBeCutFilterManager.Reset();
 
-		if (bCanCut)
+		// Self-intersection only needs this path's own octree.
+		// Otherwise CanCut is kept around until the batch-wide cutter BVH is built.
+		if (bSelfIntersectionOnly)
 		{
-			Path->BuildPartialEdgeOctree(CanCut);
-		}
+			if (bCanCut)
+			{
+				Path->BuildPartialEdgeOctree(CanCut);
+			}
 
-		CanCut.Empty();
+			CanCut.Empty();
+		}
 
 		return true;
 	}
@@ -256,55 +301,63 @@ namespace PCGExPathCrossings
 			return;
 		}
 
+		if (!bSelfIntersectionOnly)
+		{
+			CutterBVH = Context->GetCutterBVH(ParentBatch.Pin().Get());
+		}
+
 		StartParallelLoopForRange(Path->NumEdges);
 	}
 
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
-		const TSharedPtr<PCGExPointsMT::IBatch> Parent = ParentBatch.Pin();
-		if (!Parent)
+		if (!bSelfIntersectionOnly)
 		{
+			ProcessRangeAgainstCutters(Scope);
 			return;
 		}
 
-		const TSharedPtr<PCGExPointsMT::TBatch<FProcessor>> TypedParent = StaticCastSharedPtr<PCGExPointsMT::TBatch<FProcessor>>(Parent);
-
-		TArray<TSharedPtr<PCGExPaths::FPath>> Cutters;
-
-		if (bSelfIntersectionOnly)
+		if (!bCanCut || !Path->GetEdgeOctree())
 		{
-			if (bCanCut && Path->GetEdgeOctree())
-			{
-				Cutters.Add(Path);
-			}
+			return;
 		}
-		else
+
+		PCGEX_SCOPE_LOOP(Index)
 		{
-			Cutters.Reserve(Parent->ProcessorFacades.Num());
+			EdgeCrossings[Index] = nullptr;
 
+			if (!CanBeCut[Index])
+			{
+				continue;
+			}
 
-			for (int Pi = 0; Pi < TypedParent->GetNumProcessors(); Pi++)
+			const PCGExPaths::FPathEdge& Edge = Path->Edges[Index];
+			if (!Path->IsEdgeValid(Edge))
 			{
-				const TSharedPtr<FProcessor> P = TypedParent->GetProcessor<FProcessor>(Pi);
+				continue;
+			}
 
-				if (!Details.bEnableSelfIntersection && P.Get() == this)
-				{
-					continue;
-				}
-				if (!P->bCanCut || !P->Path->GetEdgeOctree())
-				{
-					continue;
-				}
+			const TSharedPtr<PCGExPaths::FPathEdgeCrossings> NewCrossing = MakeShared<PCGExPaths::FPathEdgeCrossings>(Index);
 
-				Cutters.Add(P->Path);
-			}
+			Path->GetEdgeOctree()->FindElementsWithBoundsTest(Edge.Bounds.GetBox(), [&](const PCGExPaths::FPathEdge* OtherEdge)
+			{
+				NewCrossing->FindSplit(Path, Edge, PathLength, Path, *OtherEdge, Details);
+			});
+
+			RegisterCrossings(Index, NewCrossing);
 		}
+	}
 
-		if (Cutters.IsEmpty())
+	void FProcessor::ProcessRangeAgainstCutters(const PCGExMT::FScope& Scope)
+	{
+		if (!CutterBVH || !CutterBVH->Num())
 		{
 			return;
 		}
 
+		// Candidate (path, edge) pairs, packed so sorting yields the same order a per-path scan would
+		TArray<uint64> Candidates;
+
 		PCGEX_SCOPE_LOOP(Index)
 		{
 			EdgeCrossings[Index] = nullptr;
@@ -320,25 +373,48 @@ namespace PCGExPathCrossings
 				continue;
 			}
 
-			const TSharedPtr<PCGExPaths::FPathEdgeCrossings> NewCrossing = MakeShared<PCGExPaths::FPathEdgeCrossings>(Index);
-
-			for (const TSharedPtr<PCGExPaths::FPath>& OtherPath : Cutters)
+			Candidates.Reset();
+			CutterBVH->FindOverlaps(Edge.Bounds.GetBox(), [&](const PCGExPaths::FPathEdgeBVH::FEntry& Entry)
 			{
-				OtherPath->GetEdgeOctree()->FindElementsWithBoundsTest(Edge.Bounds.GetBox(), [&](const PCGExPaths::FPathEdge* OtherEdge)
+				if (!Details.bEnableSelfIntersection && Entry.Path == BatchIndex)
 				{
-					NewCrossing->FindSplit(Path, Edge, PathLength, OtherPath, *OtherEdge, Details);
-				});
+					return;
+				}
+
+				Candidates.Add(PCGEx::H64(Entry.Path, Entry.Edge));
+			});
+
+			if (Candidates.IsEmpty())
+			{
+				continue;
 			}
 
-			if (!NewCrossing->IsEmpty())
+			Candidates.Sort();
+
+			const TSharedPtr<PCGExPaths::FPathEdgeCrossings> NewCrossing = MakeShared<PCGExPaths::FPathEdgeCrossings>(Index);
+
+			for (const uint64 Candidate : Candidates)
 			{
-				FPlatformAtomics::InterlockedIncrement(&FoundCrossingsNum);
-				NewCrossing->SortByAlpha();
-				EdgeCrossings[Index] = NewCrossing;
+				const TSharedPtr<PCGExPaths::FPath>& OtherPath = CutterBVH->GetPath(PCGEx::H64A(Candidate));
+				NewCrossing->FindSplit(Path, Edge, PathLength, OtherPath, OtherPath->Edges[PCGEx::H64B(Candidate)], Details);
 			}
+
+			RegisterCrossings(Index, NewCrossing);
 		}
 	}
 
+	void FProcessor::RegisterCrossings(const int32 EdgeIndex, const TSharedPtr<PCGExPaths::FPathEdgeCrossings>& InCrossings)
+	{
+		if (InCrossings->IsEmpty())
+		{
+			return;
+		}
+
+		FPlatformAtomics::InterlockedIncrement(&FoundCrossingsNum);
+		InCrossings->SortByAlpha();
+		EdgeCrossings[EdgeIndex] = InCrossings;
+	}
+
 	void FProcessor::OnRangeProcessingComplete()
 	{
 		if (!Settings->bCreatePointAtCrossings)
@@ -12,6 +12,7 @@
 
 
 #include "Elements/Smoothing/PCGExMovingAverageSmoothing.h"
+#include "Elements/Smoothing/PCGExSmoothingKernels.h"
 #include "Paths/PCGExPathsHelpers.h"
 
 #define LOCTEXT_NAMESPACE "PCGExSmoothElement"
@@ -204,6 +205,18 @@ namespace PCGExSmooth
 		SmoothingOperation->Blender = DataBlender;
 		SmoothingOperation->bClosedLoop = bClosedLoop;
 
+		if (MetadataBlender && SmoothingOperation->SupportsKernels())
+		{
+			MetadataBlender->ExtractBlenders([](const PCGExBlending::FProxyDataBlender& InBlender) { return PCGExSmoothing::SupportsKernel(InBlender); }, KernelBlenders);
+
+			if (!KernelBlenders.IsEmpty())
+			{
+				PointSmoothing.Init(0, NumPoints);
+				PointInfluence.Init(0, NumPoints);
+				bKernelsOnly = MetadataBlender->GetNumBlenders() == 0;
+			}
+		}
+
 		StartParallelLoopForPoints();
 
 		return true;
@@ -227,15 +240,33 @@ namespace PCGExSmooth
 			}
 
 			const double LocalSmoothing = FMath::Clamp(Smoothing->Read(Index), 0, TNumericLimits<double>::Max()) * Settings->ScaleSmoothingAmountAttribute;
+			const double LocalInfluence = (Settings->bPreserveEnd && Index == NumPoints - 1) || (Settings->bPreserveStart && Index == 0) ? 0 : Influence->Read(Index);
 
-			if ((Settings->bPreserveEnd && Index == NumPoints - 1) || (Settings->bPreserveStart && Index == 0))
+			if (!KernelBlenders.IsEmpty())
 			{
-				SmoothingOperation->SmoothSingle(Index, LocalSmoothing, 0, Trackers);
-				continue;
+				PointSmoothing[Index] = LocalSmoothing;
+				PointInfluence[Index] = LocalInfluence;
+
+				if (bKernelsOnly)
+				{
+					continue;
+				}
 			}
 
-			SmoothingOperation->SmoothSingle(Index, LocalSmoothing, Influence->Read(Index), Trackers);
+			SmoothingOperation->SmoothSingle(Index, LocalSmoothing, LocalInfluence, Trackers);
+		}
+	}
+
+	void FProcessor::OnPointsProcessingComplete()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::Smooth::SmoothKernels);
+
+		for (const TSharedPtr<PCGExBlending::FProxyDataBlender>& Blender : KernelBlenders)
+		{
+			SmoothingOperation->SmoothKernel(*Blender.Get(), PointSmoothing, PointInfluence);
 		}
+
+		KernelBlenders.Empty();
 	}
 
 	void FProcessor::CompleteWork()
@@ -0,0 +1,332 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Elements/Smoothing/PCGExSmoothingKernels.h"
+
+#include "PCGExBlendingCommon.h"
+#include "Core/PCGExBlendOperations.h"
+#include "Core/PCGExProxyDataBlending.h"
+#include "Data/PCGExData.h"
+#include "Data/PCGExProxyData.h"
+#include "Math/PCGExMath.h"
+
+namespace PCGExSmoothing
+{
+	namespace Kernels
+	{
+		// Compensated running sum. Prefix sums over long paths get much larger than the window sums
+		// read back from them; the low word keeps those differences accurate.
+		struct FSum
+		{
+			double Hi = 0;
+			double Lo = 0;
+
+			FORCEINLINE void Add(const double V)
+			{
+				const double S = Hi + V;
+				const double B = S - Hi;
+				Lo += (Hi - (S - B)) + (V - B);
+				Hi = S;
+			}
+
+			FORCEINLINE void Add(const FSum& V)
+			{
+				Add(V.Hi);
+				Lo += V.Lo;
+			}
+
+			FORCEINLINE double operator-(const FSum& Other) const
+			{
+				return (Hi - Other.Hi) + (Lo - Other.Lo);
+			}
+		};
+
+		template <typename T>
+		constexpr int32 GetNumComponents()
+		{
+			if constexpr (std::is_same_v<T, FVector2D>) { return 2; }
+			else if constexpr (std::is_same_v<T, FVector>) { return 3; }
+			else if constexpr (std::is_same_v<T, FVector4>) { return 4; }
+			else { return 1; }
+		}
+
+		template <typename T>
+		FORCEINLINE double GetComponent(const T& Value, const int32 C)
+		{
+			if constexpr (GetNumComponents<T>() == 1) { return Value; }
+			else { return Value[C]; }
+		}
+
+		template <typename T>
+		FORCEINLINE T FromComponents(const double* C)
+		{
+			if constexpr (std::is_same_v<T, FVector2D>) { return FVector2D(C[0], C[1]); }
+			else if constexpr (std::is_same_v<T, FVector>) { return FVector(C[0], C[1], C[2]); }
+			else if constexpr (std::is_same_v<T, FVector4>) { return FVector4(C[0], C[1], C[2], C[3]); }
+			else { return static_cast<T>(C[0]); }
+		}
+
+		template <typename T>
+		void MovingAverage(const PCGExBlending::FProxyDataBlender& InBlender, TConstArrayView<double> Smoothing, TConstArrayView<double> Influence, const bool bWrap)
+		{
+			constexpr int32 NumComponents = GetNumComponents<T>();
+
+			const EPCGExABBlendingType Mode = InBlender.Operation->GetBlendMode();
+			const bool bTriangle = Mode == EPCGExABBlendingType::Weight;
+
+			const PCGExData::IBufferProxy& Source = *InBlender.A;
+			const PCGExData::IBufferProxy& Target = *InBlender.C;
+
+			const int32 NumPoints = Smoothing.Num();
+			const int32 MaxIndex = NumPoints - 1;
+
+			int32 MaxWindow = 0;
+			for (int32 i = 0; i < NumPoints; i++)
+			{
+				if (Influence[i] != 0) { MaxWindow = FMath::Max(MaxWindow, static_cast<int32>(Smoothing[i])); }
+			}
+
+			if (!MaxWindow)
+			{
+				return;
+			}
+
+			// Wrapping windows read from a padded copy of the sequence; padding never exceeds one full loop,
+			// the rare window wider than that is summed directly.
+			const int32 Pad = bWrap ? FMath::Min(MaxWindow, NumPoints) : 0;
+			const int32 NumExt = NumPoints + 2 * Pad;
+
+			// SoA, centered on the mean so prefix sums stay as small as possible
+			TArray<double> Values;
+			Values.SetNumUninitialized(NumPoints * NumComponents);
+
+			double Mean[NumComponents] = {};
+			for (int32 i = 0; i < NumPoints; i++)
+			{
+				const T Value = Source.Get<T>(i);
+				for (int32 c = 0; c < NumComponents; c++)
+				{
+					const double V = GetComponent(Value, c);
+					Values[c * NumPoints + i] = V;
+					Mean[c] += V;
+				}
+			}
+
+			for (int32 c = 0; c < NumComponents; c++)
+			{
+				Mean[c] /= NumPoints;
+				double* V = Values.GetData() + c * NumPoints;
+				for (int32 i = 0; i < NumPoints; i++) { V[i] -= Mean[c]; }
+			}
+
+			// P[k] = sum of the first k samples; SS[k] = sum of the first k prefix sums (triangle only)
+			TArray<FSum> P;
+			TArray<FSum> SS;
+			P.SetNumUninitialized((NumExt + 1) * NumComponents);
+			if (bTriangle) { SS.SetNumUninitialized((NumExt + 2) * NumComponents); }
+
+			for (int32 c = 0; c < NumComponents; c++)
+			{
+				const double* V = Values.GetData() + c * NumPoints;
+				FSum* CP = P.GetData() + c * (NumExt + 1);
+
+				FSum Run;
+				CP[0] = Run;
+
+				int32 j = bWrap ? PCGExMath::Tile(-Pad, 0, MaxIndex) : 0;
+				for (int32 k = 0; k < NumExt; k++)
+				{
+					Run.Add(V[j]);
+					CP[k + 1] = Run;
+					j = j == MaxIndex ? 0 : j + 1;
+				}
+
+				if (!bTriangle)
+				{
+					continue;
+				}
+
+				FSum* CS = SS.GetData() + c * (NumExt + 2);
+
+				FSum RunP;
+				CS[0] = RunP;
+				for (int32 k = 0; k <= NumExt; k++)
+				{
+					RunP.Add(CP[k]);
+					CS[k + 1] = RunP;
+				}
+			}
+
+			// Typed output when the proxy maps 1:1 onto a buffer of the same type
+			TSharedPtr<PCGExData::TBuffer<T>> TypedOut;
+			if (!Target.HasSubSelection() &&
+				Target.RealType == PCGExTypes::TTraits<T>::Type &&
+				Target.WorkingType == PCGExTypes::TTraits<T>::Type)
+			{
+				if (const TSharedPtr<PCGExData::IBuffer> Buffer = Target.GetBuffer(); Buffer && Buffer->IsA<T>())
+				{
+					TypedOut = StaticCastSharedPtr<PCGExData::TBuffer<T>>(Buffer);
+				}
+			}
+
+			double Result[NumComponents];
+
+			for (int32 i = 0; i < NumPoints; i++)
+			{
+				const int32 Window = static_cast<int32>(Smoothing[i]);
+				const double PointInfluence = Influence[i];
+
+				if (!Window || PointInfluence == 0)
+				{
+					continue;
+				}
+
+				// Samples the window covers, and the sum of their (Window - |offset|) weights
+				int64 Count = 0;
+				int64 TriWeight = 0;
+
+				if (bWrap)
+				{
+					Count = 2 * static_cast<int64>(Window) + 1;
+					TriWeight = static_cast<int64>(Window) * Window;
+				}
+				else
+				{
+					const int64 Before = FMath::Min(Window, i);
+					const int64 After = FMath::Min(Window, MaxIndex - i);
+					Count = Before + After + 1;
+					TriWeight = Window + (Before + After) * Window - (Before * (Before + 1) + After * (After + 1)) / 2;
+				}
+
+				const int32 E = i + Pad;
+				const bool bDirect = bWrap && Window > Pad;
+
+				for (int32 c = 0; c < NumComponents; c++)
+				{
+					double Sum = 0;
+
+					if (bDirect)
+					{
+						const double* V = Values.GetData() + c * NumPoints;
+						for (int32 o = -Window; o <= Window; o++)
+						{
+							Sum += (bTriangle ? Window - FMath::Abs(o) : 1) * V[PCGExMath::Tile(i + o, 0, MaxIndex)];
+						}
+					}
+					else
+					{
+						// Out-of-range reads only happen on open paths, where they stand for zero-padding
+						const FSum* CP = P.GetData() + c * (NumExt + 1);
+						auto PAt = [&](const int32 k) -> const FSum& { return CP[FMath::Clamp(k, 0, NumExt)]; };
+
+						if (bTriangle)
+						{
+							const FSum* CS = SS.GetData() + c * (NumExt + 2);
+							auto SSAt = [&](const int32 k) -> FSum
+							{
+								if (k <= NumExt + 1) { return CS[FMath::Max(k, 0)]; }
+								FSum Tail = CS[NumExt + 1];
+								Tail.Add(static_cast<double>(k - NumExt - 1) * (CP[NumExt].Hi + CP[NumExt].Lo));
+								return Tail;
+							};
+
+							const FSum Mid = SSAt(E + 1);
+							Sum = (SSAt(E + Window + 1) - Mid) - (Mid - SSAt(E - Window + 1));
+						}
+						else
+						{
+							Sum = PAt(E + Window + 1) - PAt(E - Window);
+						}
+					}
+
+					switch (Mode)
+					{
+					case EPCGExABBlendingType::Average:
+						Result[c] = Mean[c] + Sum / Count;
+						break;
+					case EPCGExABBlendingType::Add:
+						Result[c] = Sum + Mean[c] * Count;
+						break;
+					default:
+						{
+							// Per-sample weight is (1 - |offset| / Window) * Influence
+							const double Scale = PointInfluence / Window;
+							const double TotalWeight = Scale * TriWeight;
+							const double Acc = Scale * (Sum + Mean[c] * TriWeight);
+
+							Result[c] = TotalWeight > 1 ? Acc / TotalWeight : Acc;
+						}
+						break;
+					}
+				}
+
+				if (TypedOut) { TypedOut->SetValue(i, FromComponents<T>(Result)); }
+				else { Target.Set<T>(i, FromComponents<T>(Result)); }
+			}
+		}
+	}
+
+	bool SupportsKernel(const PCGExBlending::FProxyDataBlender& InBlender)
+	{
+		if (!InBlender.Operation || !InBlender.A || !InBlender.C || !InBlender.Operation->RequiresReset())
+		{
+			return false;
+		}
+
+		// Only modes BeginMulti actually resets; WeightNormalize keeps the target's current value in the mix
+		switch (InBlender.Operation->GetBlendMode())
+		{
+		case EPCGExABBlendingType::Average:
+		case EPCGExABBlendingType::Add:
+		case EPCGExABBlendingType::Weight:
+			break;
+		default:
+			return false;
+		}
+
+		switch (InBlender.UnderlyingType)
+		{
+		case EPCGMetadataTypes::Float:
+		case EPCGMetadataTypes::Double:
+		case EPCGMetadataTypes::Vector2:
+		case EPCGMetadataTypes::Vector:
+		case EPCGMetadataTypes::Vector4:
+			return true;
+		default:
+			return false;
+		}
+	}
+
+	void MovingAverage(const PCGExBlending::FProxyDataBlender& InBlender, TConstArrayView<double> Smoothing, TConstArrayView<double> Influence, const bool bWrap)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSmoothing::MovingAverage);
+
+		check(Smoothing.Num() == Influence.Num())
+
+		if (Smoothing.IsEmpty())
+		{
+			return;
+		}
+
+		switch (InBlender.UnderlyingType)
+		{
+		case EPCGMetadataTypes::Float:
+			Kernels::MovingAverage<float>(InBlender, Smoothing, Influence, bWrap);
+			break;
+		case EPCGMetadataTypes::Double:
+			Kernels::MovingAverage<double>(InBlender, Smoothing, Influence, bWrap);
+			break;
+		case EPCGMetadataTypes::Vector2:
+			Kernels::MovingAverage<FVector2D>(InBlender, Smoothing, Influence, bWrap);
+			break;
+		case EPCGMetadataTypes::Vector:
+			Kernels::MovingAverage<FVector>(InBlender, Smoothing, Influence, bWrap);
+			break;
+		case EPCGMetadataTypes::Vector4:
+			Kernels::MovingAverage<FVector4>(InBlender, Smoothing, Influence, bWrap);
+			break;
+		default:
+			break;
+		}
+	}
+}
@@ -25,6 +25,12 @@ namespace PCGExPaths
 	struct FPathEdgeCrossings;
 	class FPathEdgeLength;
 	class FPath;
+	class FPathEdgeBVH;
+}
+
+namespace PCGExPathCrossings
+{
+	class FProcessor;
 }
 
 /**
@@ -162,7 +168,13 @@ struct FPCGExPathCrossingsContext final : FPCGExPathProcessorContext
 
 	FPCGExBlendingDetails CrossingBlending;
 
+	/** Cutter edges of every path in the batch, built once on first request. */
+	const PCGExPaths::FPathEdgeBVH* GetCutterBVH(const PCGExPointsMT::IBatch* InBatch);
+
 protected:
+	mutable FRWLock CutterBVHLock;
+	TSharedPtr<PCGExPaths::FPathEdgeBVH> CutterBVH;
+
 	PCGEX_ELEMENT_BATCH_POINT_DECL
 };
 
@@ -179,6 +191,8 @@ namespace PCGExPathCrossings
 {
 	class FProcessor final : public PCGExPointsMT::TProcessor<FPCGExPathCrossingsContext, UPCGExPathCrossingsSettings>
 	{
+		friend struct FPCGExPathCrossingsContext;
+
 		bool bClosedLoop = false;
 		bool bSelfIntersectionOnly = false;
 		bool bCanCut = true;
@@ -195,6 +209,8 @@ namespace PCGExPathCrossings
 		TBitArray<> CanCut;
 		TBitArray<> CanBeCut;
 
+		const PCGExPaths::FPathEdgeBVH* CutterBVH = nullptr;
+
 		TSet<FName> ProtectedAttributes;
 		TSharedPtr<FPCGExSubPointsBlendOperation> SubBlending;
 
@@ -228,6 +244,12 @@ namespace PCGExPathCrossings
 		virtual void ProcessRange(const PCGExMT::FScope& Scope) override;
 		virtual void OnRangeProcessingComplete() override;
 
+	protected:
+		void ProcessRangeAgainstCutters(const PCGExMT::FScope& Scope);
+		void RegisterCrossings(const int32 EdgeIndex, const TSharedPtr<PCGExPaths::FPathEdgeCrossings>& InCrossings);
+
+	public:
+
 		void CollapseCrossings(const PCGExMT::FScope& Scope);
 		void CrossBlend(const PCGExMT::FScope& Scope);
 
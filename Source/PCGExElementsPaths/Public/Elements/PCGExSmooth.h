@@ -24,6 +24,7 @@ namespace PCGExBlending
 	class IBlender;
 	class FBlendOpsManager;
 	class FMetadataBlender;
+	class FProxyDataBlender;
 }
 
 /**
@@ -152,6 +153,12 @@ namespace PCGExSmooth
 
 		TSharedPtr<FPCGExSmoothingOperation> SmoothingOperation;
 
+		// Blenders smoothed through SmoothKernel once all points have resolved their smoothing & influence
+		TArray<TSharedPtr<PCGExBlending::FProxyDataBlender>> KernelBlenders;
+		TArray<double> PointSmoothing;
+		TArray<double> PointInfluence;
+		bool bKernelsOnly = false;
+
 		bool bClosedLoop = false;
 
 	public:
@@ -164,6 +171,7 @@ namespace PCGExSmooth
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager) override;
 		virtual void ProcessPoints(const PCGExMT::FScope& Scope) override;
+		virtual void OnPointsProcessingComplete() override;
 
 		virtual void CompleteWork() override;
 	};
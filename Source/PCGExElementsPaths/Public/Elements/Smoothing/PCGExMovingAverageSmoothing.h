@@ -5,6 +5,7 @@
 
 #include "CoreMinimal.h"
 #include "PCGExSmoothingInstancedFactory.h"
+#include "PCGExSmoothingKernels.h"
 #include "Core/PCGExProxyDataBlending.h"
 #include "Data/PCGExPointIO.h"
 #include "Math/PCGExMath.h"
@@ -58,6 +59,17 @@ public:
 
 		Blender->EndMultiBlend(TargetIndex, Trackers);
 	}
+
+	// Yoyo & Clamp revisit samples in ways prefix sums don't model, those stay on SmoothSingle
+	virtual bool SupportsKernels() const override
+	{
+		return bClosedLoop || IndexSafety == EPCGExIndexSafety::Ignore || IndexSafety == EPCGExIndexSafety::Tile;
+	}
+
+	virtual void SmoothKernel(const PCGExBlending::FProxyDataBlender& InBlender, TConstArrayView<double> Smoothing, TConstArrayView<double> Influence) const override
+	{
+		PCGExSmoothing::MovingAverage(InBlender, Smoothing, Influence, bClosedLoop || IndexSafety == EPCGExIndexSafety::Tile);
+	}
 };
 
 /**
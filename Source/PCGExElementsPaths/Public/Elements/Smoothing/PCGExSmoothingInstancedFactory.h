@@ -18,6 +18,7 @@ namespace PCGExSmooth
 namespace PCGExBlending
 {
 	class IBlender;
+	class FProxyDataBlender;
 }
 
 class PCGEXELEMENTSPATHS_API FPCGExSmoothingOperation : public FPCGExOperation
@@ -29,6 +30,17 @@ public:
 	{
 	}
 
+	/** Whether linear blenders (see PCGExSmoothing::SupportsKernel) can go through SmoothKernel instead of per-point SmoothSingle. */
+	virtual bool SupportsKernels() const
+	{
+		return false;
+	}
+
+	/** Smooth a whole attribute at once, given the per-point smoothing & influence SmoothSingle would have been called with. */
+	virtual void SmoothKernel(const PCGExBlending::FProxyDataBlender& InBlender, TConstArrayView<double> Smoothing, TConstArrayView<double> Influence) const
+	{
+	}
+
 protected:
 	TSharedPtr<PCGExData::FPointIO> Path;
 	TSharedPtr<PCGExBlending::IBlender> Blender;
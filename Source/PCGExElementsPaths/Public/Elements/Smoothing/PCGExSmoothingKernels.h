@@ -0,0 +1,35 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExBlending
+{
+	class FProxyDataBlender;
+}
+
+namespace PCGExSmoothing
+{
+	/**
+	 * Whether a blender's multi-blend result is a linear function of the blended samples alone (reset Average, Add
+	 * or Weight over float or vector types), so windowed smoothing can be evaluated from prefix sums
+	 * instead of per-sample MultiBlend calls. WeightNormalize also mixes in the target's current value, and is left out.
+	 */
+	PCGEXELEMENTSPATHS_API bool SupportsKernel(const PCGExBlending::FProxyDataBlender& InBlender);
+
+	/**
+	 * Moving-average smoothing of a single attribute, through running prefix sums (box) and prefix sums of
+	 * prefix sums (triangle). Produces what the Begin/Multi/EndMultiBlend sequence of FPCGExMovingAverageSmoothing
+	 * would, in O(points) whatever the window sizes.
+	 *
+	 * Smoothing & Influence are per point; points with a window or an influence of 0 are left untouched.
+	 * When bWrap is set, windows wrap around the path ends, otherwise samples past the ends are ignored.
+	 */
+	PCGEXELEMENTSPATHS_API void MovingAverage(
+		const PCGExBlending::FProxyDataBlender& InBlender,
+		TConstArrayView<double> Smoothing,
+		TConstArrayView<double> Influence,
+		const bool bWrap);
+}
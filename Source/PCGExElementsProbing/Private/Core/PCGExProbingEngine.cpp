@@ -11,9 +11,11 @@
 #include "Core/PCGExProbeFactoryProvider.h"
 #include "Core/PCGExProbeOperation.h"
 #include "Core/PCGExProbingCandidates.h"
+#include "Core/PCGExProbingGrid.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointIO.h"
 #include "Details/PCGExSettingsDetails.h"
+#include "Graphs/PCGExGraph.h"
 #include "Helpers/PCGExArrayHelpers.h"
 
 namespace PCGExProbing
@@ -114,11 +116,6 @@ namespace PCGExProbing
 		NumSharedOps = SharedOperations.Num();
 		NumDirectOps = DirectOperations.Num();
 
-		if (!RadiusSources.IsEmpty())
-		{
-			bWantsOctree = true;
-		}
-
 		bOnlyGlobalOps = RadiusSources.IsEmpty() && DirectOperations.IsEmpty();
 
 		if (bOnlyGlobalOps && GlobalOperations.IsEmpty())
@@ -248,7 +245,10 @@ namespace PCGExProbing
 				}
 			});
 
-		if (bWantsOctree)
+		PrepareCandidateGrid();
+
+		// Radius sources only need the octree when the grid wasn't deemed worth it
+		if (bWantsOctree || (!RadiusSources.IsEmpty() && !CandidateGrid))
 		{
 			const FBox B = PointData->GetBounds();
 			Octree = MakeUnique<PCGExOctree::FItemOctree>(bUseProjection ? ProjectionDetails.ProjectFlat(B.GetCenter()) : B.GetCenter(), B.GetExtent().Length());
@@ -272,9 +272,60 @@ namespace PCGExProbing
 		}
 	}
 
+	void FProbingEngine::PrepareCandidateGrid()
+	{
+		if (RadiusSources.IsEmpty())
+		{
+			return;
+		}
+
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExProbing::FProbingEngine::PrepareCandidateGrid);
+
+		// Largest query extent any generator will issue; mirrors the per-point MaxRadius computed in ProcessScope.
+		double MaxQueryRadius = 0;
+		if (!bUseVariableRadius)
+		{
+			MaxQueryRadius = SharedSearchRadius;
+		}
+		else
+		{
+			for (int Index = 0; Index < NumPoints; Index++)
+			{
+				if (!CanGenerate[Index])
+				{
+					continue;
+				}
+				for (int i = 0; i < NumRadiusSources; i++)
+				{
+					MaxQueryRadius = FMath::Max(MaxQueryRadius, RadiusSources[i]->GetSearchRadius(Index));
+				}
+			}
+		}
+
+		FBox AcceptedBounds = FBox(ForceInit);
+		int32 NumAccepted = 0;
+		for (int i = 0; i < NumPoints; i++)
+		{
+			if (!AcceptConnections[i])
+			{
+				continue;
+			}
+			AcceptedBounds += WorkingPositions[i];
+			NumAccepted++;
+		}
+
+		if (!FCandidateGrid::IsWorthIt(AcceptedBounds, MaxQueryRadius, NumAccepted))
+		{
+			return;
+		}
+
+		CandidateGrid = MakeUnique<FCandidateGrid>(WorkingPositions, AcceptConnections, AcceptedBounds, MaxQueryRadius);
+	}
+
 	void FProbingEngine::PrepareScopes(const TArray<PCGExMT::FScope>& Loops)
 	{
 		ScopedEdges = MakeShared<PCGExMT::TScopedSet<uint64>>(Loops, 10);
+		if (bOutputEdgeBatches) { EdgeBatches = MakeShared<PCGExGraphs::FEdgeBatches>(Loops); }
 	}
 
 	void FProbingEngine::ProcessScope(const PCGExMT::FScope& Scope)
@@ -309,9 +360,8 @@ namespace PCGExProbing
 		int32 CurrentIndex = 0;
 		int32 CurrentGroupId = -1;
 
-		auto ProcessPoint = [&](const PCGExOctree::FItem& InPositionRef)
+		auto ProcessPoint = [&](const int32 OtherPointIndex)
 		{
-			const int32 OtherPointIndex = InPositionRef.Index;
 			if (OtherPointIndex == CurrentIndex)
 			{
 				return;
@@ -388,7 +438,14 @@ namespace PCGExProbing
 				Origin = WorkingPositions[Index];
 
 				// Find candidates within radius
-				Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Origin, FVector(MaxRadius)), ProcessPoint);
+				if (CandidateGrid)
+				{
+					CandidateGrid->FindInBox(Origin, MaxRadius, ProcessPoint);
+				}
+				else
+				{
+					Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Origin, FVector(MaxRadius)), [&](const PCGExOctree::FItem& Item) { ProcessPoint(Item.Index); });
+				}
 				Candidates.Sort([&](const FCandidate& A, const FCandidate& B)
 				{
 					return A.Distance < B.Distance;
@@ -410,10 +467,32 @@ namespace PCGExProbing
 				DirectOperations[i]->ProcessNode(Index, LocalCoincidence.Get(), CWCoincidenceTolerance, LocalUniqueEdges, DirectOpsContainers[i].Get());
 			}
 		}
+
+		// The scope's set only served local dedup, stage it right away while we're still in parallel
+		if (EdgeBatches)
+		{
+			AppendBatch(EdgeBatches->Get_Ref(Scope), *LocalUniqueEdges);
+			LocalUniqueEdges->Empty();
+		}
 	}
 
 	void FProbingEngine::CollapseScopedEdges()
 	{
+		if (bOutputEdgeBatches)
+		{
+			// Scopes already staged their batches; global-probe outputs are handed over as extra ones
+			if (!EdgeBatches) { EdgeBatches = MakeShared<PCGExGraphs::FEdgeBatches>(0); }
+
+			{
+				FWriteScopeLock WriteScopeLock(UniqueEdgesLock);
+				for (TArray<uint64>& Batch : GlobalBatches) { EdgeBatches->Batches.Add(MoveTemp(Batch)); }
+				GlobalBatches.Empty();
+			}
+
+			ScopedEdges.Reset();
+			return;
+		}
+
 		// Global-only runs never prepare scopes; there is nothing to collapse.
 		if (!ScopedEdges)
 		{
@@ -439,6 +518,12 @@ namespace PCGExProbing
 	{
 		FWriteScopeLock WriteScopeLock(UniqueEdgesLock);
 
+		if (bOutputEdgeBatches)
+		{
+			AppendBatch(GlobalBatches.Emplace_GetRef(), InUniqueEdges);
+			return;
+		}
+
 		if (RequiresEdgePostFilter())
 		{
 			AppendEdgesFiltered_Unsafe(InUniqueEdges);
@@ -449,23 +534,32 @@ namespace PCGExProbing
 		UniqueEdges.Append(InUniqueEdges);
 	}
 
+	bool FProbingEngine::MatchesEdgeRelation(const uint64 Edge) const
+	{
+		uint32 A;
+		uint32 B;
+		PCGEx::H64(Edge, A, B);
+		return ((*PointGroupIds)[A] == (*PointGroupIds)[B]) == (EdgeRelation == EEdgeRelation::SameGroup);
+	}
+
 	void FProbingEngine::AppendEdgesFiltered_Unsafe(const TSet<uint64>& InEdges)
 	{
 		// Direct & global probes bypass candidate gathering; enforce the relation on their raw output.
-		const TArray<int32>& Groups = *PointGroupIds;
-		const bool bWantsSameGroup = EdgeRelation == EEdgeRelation::SameGroup;
-
 		UniqueEdges.Reserve(UniqueEdges.Num() + InEdges.Num());
 		for (const uint64 E : InEdges)
 		{
-			uint32 A;
-			uint32 B;
-			PCGEx::H64(E, A, B);
-			if ((Groups[A] == Groups[B]) != bWantsSameGroup)
-			{
-				continue;
-			}
-			UniqueEdges.Add(E);
+			if (MatchesEdgeRelation(E)) { UniqueEdges.Add(E); }
+		}
+	}
+
+	void FProbingEngine::AppendBatch(TArray<uint64>& OutBatch, const TSet<uint64>& InEdges) const
+	{
+		const bool bFilter = RequiresEdgePostFilter();
+
+		OutBatch.Reserve(OutBatch.Num() + InEdges.Num());
+		for (const uint64 E : InEdges)
+		{
+			if (!bFilter || MatchesEdgeRelation(E)) { OutBatch.Add(E); }
 		}
 	}
 }
@@ -0,0 +1,102 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExProbingGrid.h"
+
+#include "PCGExH.h"
+#include "Math/PCGExMorton.h"
+#include "Sorting/PCGExSortingHelpers.h"
+
+namespace PCGExProbing
+{
+	namespace Grid
+	{
+		// Upper bound on cell count, whatever the point count
+		constexpr int64 MaxCells = 1 << 24;
+
+		FORCEINLINE int64 NumCellsFor(const FVector& Size, const double CellSize, FIntVector& OutDims)
+		{
+			OutDims = FIntVector(
+				FMath::Max(1, FMath::CeilToInt32(Size.X / CellSize)),
+				FMath::Max(1, FMath::CeilToInt32(Size.Y / CellSize)),
+				FMath::Max(1, FMath::CeilToInt32(Size.Z / CellSize)));
+			return static_cast<int64>(OutDims.X) * OutDims.Y * OutDims.Z;
+		}
+	}
+
+	bool FCandidateGrid::IsWorthIt(const FBox& InBounds, const double InMaxRadius, const int32 InNumPoints)
+	{
+		if (!InBounds.IsValid || InMaxRadius <= 0 || InNumPoints <= 0)
+		{
+			return false;
+		}
+
+		// A single axis over 2^21 cells would overflow the Morton key, and makes for a very sparse grid anyway
+		const FVector Size = InBounds.GetSize();
+		if (Size.GetMax() / InMaxRadius > (1 << 21))
+		{
+			return false;
+		}
+
+		FIntVector Dims;
+		const int64 NumCells = Grid::NumCellsFor(Size, InMaxRadius, Dims);
+
+		// Too few cells and every query scans most of the data: the octree prunes better.
+		// Too many cells relative to the points and the grid is mostly empty memory.
+		return NumCells >= 27 && NumCells <= FMath::Min(Grid::MaxCells, FMath::Max<int64>(4096, static_cast<int64>(InNumPoints) * 4));
+	}
+
+	FCandidateGrid::FCandidateGrid(const TArray<FVector>& InPositions, const TArray<int8>& InAccept, const FBox& InBounds, const double InMaxRadius)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExProbing::FCandidateGrid::Build);
+
+		const double CellSize = FMath::Max(InMaxRadius, UE_KINDA_SMALL_NUMBER);
+		InvCellSize = 1 / CellSize;
+
+		const FBox Bounds = InBounds.ExpandBy(PointExtent);
+		Origin = Bounds.Min;
+
+		const int64 NumCells = Grid::NumCellsFor(Bounds.GetSize(), CellSize, Dims);
+		CellRanges.Init(FIntPoint(0, 0), static_cast<int32>(NumCells));
+
+		const int32 NumPoints = InPositions.Num();
+
+		TArray<PCGEx::FIndexKey> Keys;
+		Keys.Reserve(NumPoints);
+
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			if (!InAccept[i])
+			{
+				continue;
+			}
+			const FIntVector C = ToCell(InPositions[i]);
+			Keys.Emplace(i, PCGExMath::Morton3(C.X, C.Y, C.Z));
+		}
+
+		// LSD radix is stable: points within a cell keep ascending index order, so layout is deterministic
+		PCGExSortingHelpers::RadixSort(Keys);
+
+		const int32 NumKeys = Keys.Num();
+		X.SetNumUninitialized(NumKeys);
+		Y.SetNumUninitialized(NumKeys);
+		Z.SetNumUninitialized(NumKeys);
+		Indices.SetNumUninitialized(NumKeys);
+
+		for (int32 i = 0; i < NumKeys; i++)
+		{
+			const int32 Index = Keys[i].Index;
+			const FVector& P = InPositions[Index];
+
+			X[i] = P.X;
+			Y[i] = P.Y;
+			Z[i] = P.Z;
+			Indices[i] = Index;
+
+			const FIntVector C = ToCell(P);
+			FIntPoint& Range = CellRanges[C.X + C.Y * Dims.X + C.Z * Dims.X * Dims.Y];
+			if (!Range.Y) { Range.X = i; }
+			Range.Y++;
+		}
+	}
+}
@@ -117,6 +117,7 @@ namespace PCGExConnectPoints
 
 		Engine = MakeShared<PCGExProbing::FProbingEngine>(PointDataFacade);
 		Engine->SetCoincidence(Settings->bPreventCoincidence, Context->CWCoincidenceTolerance);
+		Engine->bOutputEdgeBatches = true;
 		if (Settings->bProjectPoints)
 		{
 			Engine->SetProjection(Settings->ProjectionDetails);
@@ -186,7 +187,7 @@ namespace PCGExConnectPoints
 			[PCGEX_ASYNC_THIS_CAPTURE]()
 			{
 				PCGEX_ASYNC_THIS
-				This->GraphBuilder->Graph->InsertEdges_Unsafe(This->Engine->GetUniqueEdges(), -1);
+				This->GraphBuilder->Graph->InsertEdges(*This->Engine->GetEdgeBatches(), -1);
 				This->GraphBuilder->CompileAsync(This->TaskManager, true);
 			});
 	}
@@ -25,8 +25,15 @@ namespace PCGExMT
 	class TScopedSet;
 }
 
+namespace PCGExGraphs
+{
+	class FEdgeBatches;
+}
+
 namespace PCGExProbing
 {
+	class FCandidateGrid;
+
 	/** Constrains which point pairs probes may connect, based on per-point group ids. */
 	enum class EEdgeRelation : uint8
 	{
@@ -67,6 +74,12 @@ namespace PCGExProbing
 		void SetCoincidence(const bool bInPreventCoincidence, const FVector& InTolerance);
 		void SetProjection(const FPCGExGeo2DProjectionDetails& InDetails);
 
+		/**
+		 * Stage edges as FEdgeBatches for FGraph::InsertEdges rather than merging them into a single set.
+		 * Each scope fills its own batch, so nothing is merged serially; GetUniqueEdges() stays empty.
+		 */
+		bool bOutputEdgeBatches = false;
+
 		/** Optional: per-point group ids consumed by EdgeRelation. */
 		const TArray<int32>* PointGroupIds = nullptr;
 		EEdgeRelation EdgeRelation = EEdgeRelation::Any;
@@ -87,6 +100,7 @@ namespace PCGExProbing
 		void RunAsync(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager, TFunction<void()>&& InOnComplete);
 
 		TSet<uint64>& GetUniqueEdges() { return UniqueEdges; }
+		const TSharedPtr<PCGExGraphs::FEdgeBatches>& GetEdgeBatches() const { return EdgeBatches; }
 		const TArray<FVector>& GetWorkingPositions() const { return WorkingPositions; }
 		const TArray<FTransform>& GetWorkingTransforms() const { return WorkingTransforms; }
 
@@ -108,13 +122,16 @@ namespace PCGExProbing
 		int32 NumSharedOps = 0;
 
 		bool bOnlyGlobalOps = false;
-		bool bWantsOctree = false;
+		bool bWantsOctree = false; // Operations reading the octree themselves, regardless of candidate gathering
 
 		bool bUseVariableRadius = false;
 		double SharedSearchRadius = 0;
 
 		TUniquePtr<PCGExOctree::FItemOctree> Octree;
 
+		// Candidate provider for radius sources when radii are small relative to the bounds; octree otherwise.
+		TUniquePtr<FCandidateGrid> CandidateGrid;
+
 		TArray<FTransform> WorkingTransforms;
 		TArray<FVector> WorkingPositions;
 
@@ -122,6 +139,9 @@ namespace PCGExProbing
 		TSharedPtr<PCGExMT::TScopedSet<uint64>> ScopedEdges;
 		TSet<uint64> UniqueEdges;
 
+		TSharedPtr<PCGExGraphs::FEdgeBatches> EdgeBatches;
+		TArray<TArray<uint64>> GlobalBatches; // Global-probe outputs in batch mode, guarded by UniqueEdgesLock
+
 		FPCGExGeo2DProjectionDetails ProjectionDetails;
 		bool bUseProjection = false;
 
@@ -137,6 +157,7 @@ namespace PCGExProbing
 		bool HasGlobalWork() const { return !GlobalOperations.IsEmpty(); }
 
 		void PrepareWorkingData();
+		void PrepareCandidateGrid();
 		void PrepareScopes(const TArray<PCGExMT::FScope>& Loops);
 		void ProcessScope(const PCGExMT::FScope& Scope);
 		void CollapseScopedEdges();
@@ -148,6 +169,8 @@ namespace PCGExProbing
 		void AdvanceRun();
 
 		bool RequiresEdgePostFilter() const { return EdgeRelation != EEdgeRelation::Any && PointGroupIds; }
+		bool MatchesEdgeRelation(const uint64 Edge) const;
 		void AppendEdgesFiltered_Unsafe(const TSet<uint64>& InEdges);
+		void AppendBatch(TArray<uint64>& OutBatch, const TSet<uint64>& InEdges) const;
 	};
 }
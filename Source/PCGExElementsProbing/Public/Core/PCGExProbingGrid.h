@@ -0,0 +1,87 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+
+namespace PCGExProbing
+{
+	/**
+	 * Fixed-radius cell-linked grid used for candidate gathering in place of the octree, when the
+	 * search radius is bounded and small relative to the point bounds.
+	 *
+	 * Cells are one search radius wide, so a query only ever touches the 3x3x3 (3x3 when projected)
+	 * block around its origin. Points are stored SoA, grouped by cell, with cells laid out in Morton
+	 * order so neighboring cells sit close in memory. The inclusion test replicates the octree's
+	 * box-vs-point-box test exactly: the engine gets the same candidate set either way.
+	 */
+	class PCGEXELEMENTSPROBING_API FCandidateGrid
+	{
+	public:
+		/** Half-size of the reference box each point is inserted with (matches the octree items). */
+		static constexpr double PointExtent = 0.05;
+
+		/** Whether a grid sized for InMaxRadius beats the octree for these bounds. */
+		static bool IsWorthIt(const FBox& InBounds, const double InMaxRadius, const int32 InNumPoints);
+
+		FCandidateGrid(const TArray<FVector>& InPositions, const TArray<int8>& InAccept, const FBox& InBounds, const double InMaxRadius);
+
+		/** Calls Callback(PointIndex) for every point whose reference box intersects the cube of half-size InExtent around InCenter. */
+		template <typename Func>
+		void FindInBox(const FVector& InCenter, const double InExtent, Func&& Callback) const
+		{
+			const double Reach = InExtent + PointExtent;
+			const FIntVector Lo = ToCell(InCenter - FVector(Reach));
+			const FIntVector Hi = ToCell(InCenter + FVector(Reach));
+
+			const double* RESTRICT PX = X.GetData();
+			const double* RESTRICT PY = Y.GetData();
+			const double* RESTRICT PZ = Z.GetData();
+
+			for (int32 CZ = Lo.Z; CZ <= Hi.Z; CZ++)
+			{
+				for (int32 CY = Lo.Y; CY <= Hi.Y; CY++)
+				{
+					for (int32 CX = Lo.X; CX <= Hi.X; CX++)
+					{
+						const FIntPoint& Range = CellRanges[CX + CY * Dims.X + CZ * Dims.X * Dims.Y];
+						const int32 End = Range.X + Range.Y;
+						for (int32 i = Range.X; i < End; i++)
+						{
+							if (FMath::Abs(PX[i] - InCenter.X) > Reach ||
+								FMath::Abs(PY[i] - InCenter.Y) > Reach ||
+								FMath::Abs(PZ[i] - InCenter.Z) > Reach)
+							{
+								continue;
+							}
+
+							Callback(Indices[i]);
+						}
+					}
+				}
+			}
+		}
+
+	protected:
+		FVector Origin = FVector::ZeroVector;
+		double InvCellSize = 1;
+		FIntVector Dims = FIntVector(1);
+
+		TArray<FIntPoint> CellRanges; // Start & count per cell, indexed by linear cell index
+
+		TArray<double> X;
+		TArray<double> Y;
+		TArray<double> Z;
+		TArray<int32> Indices;
+
+		FORCEINLINE FIntVector ToCell(const FVector& P) const
+		{
+			const FVector L = (P - Origin) * InvCellSize;
+			return FIntVector(
+				FMath::Clamp(FMath::FloorToInt32(L.X), 0, Dims.X - 1),
+				FMath::Clamp(FMath::FloorToInt32(L.Y), 0, Dims.Y - 1),
+				FMath::Clamp(FMath::FloorToInt32(L.Z), 0, Dims.Z - 1));
+		}
+	};
+}
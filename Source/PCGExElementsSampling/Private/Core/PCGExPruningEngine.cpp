@@ -0,0 +1,236 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExPruningEngine.h"
+
+#include "Math/OBB/PCGExOBBTests.h"
+
+namespace PCGExSelfPruning
+{
+	namespace Resolution
+	{
+		// Below this many undecided points, a sequential sweep beats another parallel round
+		constexpr int32 SequentialThreshold = 4096;
+
+		// A round settling less than 1/MinProgress of the remaining points means long dependency chains
+		// (e.g. priority following a spatial axis) -- the sweep finishes those in one go.
+		constexpr int32 MinProgress = 8;
+	}
+
+	FPruningEngine::FPruningEngine(
+		const TArray<int32>& InPriority,
+		const TArray<int8>& InParticipants,
+		const TArray<FBox>& InPrimaryBoxes,
+		const TArray<FBox>& InSecondaryBoxes,
+		const TArray<PCGExMath::OBB::FOBB>* InPrimaryOBBs,
+		const TArray<PCGExMath::OBB::FOBB>* InSecondaryOBBs)
+		: Priority(InPriority)
+		  , Participants(InParticipants)
+		  , PrimaryBoxes(InPrimaryBoxes)
+		  , SecondaryBoxes(InSecondaryBoxes)
+		  , PrimaryOBBs(InPrimaryOBBs && InSecondaryOBBs ? InPrimaryOBBs : nullptr)
+		  , SecondaryOBBs(InPrimaryOBBs && InSecondaryOBBs ? InSecondaryOBBs : nullptr)
+	{
+	}
+
+	void FPruningEngine::Init()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSelfPruning::FPruningEngine::Init);
+
+		const int32 NumPoints = Priority.Num();
+
+		FBox OctreeBounds(ForceInit);
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			if (Participants[i]) { OctreeBounds += SecondaryBoxes[i]; }
+		}
+
+		NumDominators.Init(0, NumPoints);
+
+		if (!OctreeBounds.IsValid)
+		{
+			return;
+		}
+
+		// Only participants go in; non-participants neither prune nor get pruned
+		Octree = MakeShared<PCGExOctree::FItemOctree>(OctreeBounds.GetCenter(), OctreeBounds.GetExtent().Length());
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			if (Participants[i]) { Octree->AddElement(PCGExOctree::FItem(i, FBoxSphereBounds(SecondaryBoxes[i]))); }
+		}
+	}
+
+	void FPruningEngine::PrepareScopes(const TArray<PCGExMT::FScope>& Loops)
+	{
+		ScopedDominators.SetNum(Loops.Num());
+	}
+
+	void FPruningEngine::ProcessScope(const PCGExMT::FScope& Scope)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSelfPruning::FPruningEngine::ProcessScope);
+
+		if (!Octree)
+		{
+			return;
+		}
+
+		TArray<int32>& Out = ScopedDominators[Scope.LoopIndex];
+		Out.Reserve(Scope.Count);
+
+		PCGEX_SCOPE_LOOP(Index)
+		{
+			if (!Participants[Index])
+			{
+				continue;
+			}
+
+			const int32 CurrentPriority = Priority[Index];
+			const FBox& Box = PrimaryBoxes[Index];
+			const int32 Start = Out.Num();
+
+			Octree->FindElementsWithBoundsTest(Box, [&](const PCGExOctree::FItem& Item)
+			{
+				const int32 OtherIndex = Item.Index;
+
+				// Only higher priorities can prune this point; lower ones are this point's own business
+				if (OtherIndex == Index || Priority[OtherIndex] < CurrentPriority)
+				{
+					return;
+				}
+
+				// Octree bounds went through a sphere-bounds round trip, test the source box
+				if (!Box.Intersect(SecondaryBoxes[OtherIndex]))
+				{
+					return;
+				}
+
+				if (PrimaryOBBs && !PCGExMath::OBB::SATOverlap((*PrimaryOBBs)[Index], (*SecondaryOBBs)[OtherIndex]))
+				{
+					return;
+				}
+
+				Out.Add(OtherIndex);
+			});
+
+			const int32 Num = Out.Num() - Start;
+			NumDominators[Index] = Num;
+
+			// Highest priorities first -- they settle first, so evaluation tends to stop at the first entry
+			if (Num > 1)
+			{
+				TArrayView<int32>(Out.GetData() + Start, Num).Sort([&](const int32 A, const int32 B) { return Priority[A] > Priority[B]; });
+			}
+		}
+	}
+
+	void FPruningEngine::CompileGraph()
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSelfPruning::FPruningEngine::CompileGraph);
+
+		const int32 NumPoints = NumDominators.Num();
+
+		DominatorStart.SetNumUninitialized(NumPoints + 1);
+		int32 Total = 0;
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			DominatorStart[i] = Total;
+			Total += NumDominators[i];
+		}
+		DominatorStart[NumPoints] = Total;
+
+		Dominators.Reserve(Total);
+		for (TArray<int32>& Scoped : ScopedDominators) { Dominators.Append(Scoped); }
+		check(Dominators.Num() == Total);
+
+		ScopedDominators.Empty();
+		NumDominators.Empty();
+	}
+
+	int8 FPruningEngine::Evaluate(const int32 Index) const
+	{
+		bool bAllPruned = true;
+		for (int32 d = DominatorStart[Index]; d < DominatorStart[Index + 1]; d++)
+		{
+			const int8 S = State[Dominators[d]];
+			if (S == Keep) { return Prune; }
+			if (S == Undecided) { bAllPruned = false; }
+		}
+		return bAllPruned ? Keep : Undecided;
+	}
+
+	int32 FPruningEngine::Resolve(TBitArray<>& OutKeep)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSelfPruning::FPruningEngine::Resolve);
+
+		CompileGraph();
+
+		const int32 NumPoints = Priority.Num();
+		State.Init(Undecided, NumPoints);
+
+		// Participants by descending priority -- the order the sequential sweep must honor
+		TArray<int32> Pending;
+		{
+			TArray<int32> ByPriority;
+			ByPriority.Init(-1, NumPoints);
+			for (int32 i = 0; i < NumPoints; i++)
+			{
+				if (Participants[i]) { ByPriority[NumPoints - 1 - Priority[i]] = i; }
+			}
+
+			Pending.Reserve(NumPoints);
+			for (const int32 i : ByPriority)
+			{
+				if (i != -1) { Pending.Add(i); }
+			}
+		}
+
+		TArray<int8> Decisions;
+		while (Pending.Num() >= Resolution::SequentialThreshold)
+		{
+			TRACE_CPUPROFILER_EVENT_SCOPE(PCGExSelfPruning::FPruningEngine::Round);
+
+			const int32 NumPending = Pending.Num();
+			Decisions.SetNumUninitialized(NumPending, EAllowShrinking::No);
+
+			// Decide against last round's state only, so the outcome doesn't depend on scheduling
+			PCGExMT::ParallelOrSequential(NumPending, [&](const int32 i) { Decisions[i] = Evaluate(Pending[i]); });
+
+			int32 WriteIndex = 0;
+			for (int32 i = 0; i < NumPending; i++)
+			{
+				if (Decisions[i] == Undecided) { Pending[WriteIndex++] = Pending[i]; }
+				else { State[Pending[i]] = Decisions[i]; }
+			}
+
+			const int32 NumSettled = NumPending - WriteIndex;
+			Pending.SetNum(WriteIndex, EAllowShrinking::No);
+
+			if (NumSettled * Resolution::MinProgress < NumPending)
+			{
+				break;
+			}
+		}
+
+		// Ordered sweep: every dominator has a higher priority hence is already settled when we get to a point
+		for (const int32 Index : Pending)
+		{
+			State[Index] = Evaluate(Index) == Prune ? Prune : Keep;
+		}
+
+		int32 NumPruned = 0;
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			if (State[i] == Prune)
+			{
+				OutKeep[i] = false;
+				NumPruned++;
+			}
+			else if (State[i] == Keep)
+			{
+				OutKeep[i] = true;
+			}
+		}
+
+		return NumPruned;
+	}
+}
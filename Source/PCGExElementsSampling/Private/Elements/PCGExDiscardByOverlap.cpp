@@ -7,8 +7,8 @@
 #include "Data/PCGExDataHelpers.h"
 #include "Data/PCGExDataTags.h"
 #include "Data/PCGExPointIO.h"
-#include "Helpers/PCGExArrayHelpers.h"
 #include "Math/PCGExMathBounds.h"
+#include "Utils/PCGExIndexedHeap.h"
 
 
 #define LOCTEXT_NAMESPACE "PCGExDiscardByOverlapElement"
@@ -52,6 +52,22 @@ void FPCGExOverlapScoresWeighting::Max(const FPCGExOverlapScoresWeighting& Other
 	DataScore = FMath::Max(DataScore, Other.DataScore);
 }
 
+bool FPCGExOverlapScoresWeighting::SharesAnyScore(const FPCGExOverlapScoresWeighting& Other) const
+{
+	return OverlapCount == Other.OverlapCount || OverlapSubCount == Other.OverlapSubCount ||
+		OverlapVolume == Other.OverlapVolume || OverlapVolumeDensity == Other.OverlapVolumeDensity ||
+		NumPoints == Other.NumPoints || Volume == Other.Volume || VolumeDensity == Other.VolumeDensity ||
+		CustomTagScore == Other.CustomTagScore || DataScore == Other.DataScore;
+}
+
+bool FPCGExOverlapScoresWeighting::HasSameScores(const FPCGExOverlapScoresWeighting& Other) const
+{
+	return OverlapCount == Other.OverlapCount && OverlapSubCount == Other.OverlapSubCount &&
+		OverlapVolume == Other.OverlapVolume && OverlapVolumeDensity == Other.OverlapVolumeDensity &&
+		NumPoints == Other.NumPoints && Volume == Other.Volume && VolumeDensity == Other.VolumeDensity &&
+		CustomTagScore == Other.CustomTagScore && DataScore == Other.DataScore;
+}
+
 TSharedPtr<PCGExDiscardByOverlap::FOverlap> FPCGExDiscardByOverlapContext::RegisterOverlap(PCGExDiscardByOverlap::FProcessor* InA, PCGExDiscardByOverlap::FProcessor* InB, const FBox& InIntersection)
 {
 	const uint64 HashID = PCGEx::H64U(InA->BatchIndex, InB->BatchIndex);
@@ -78,6 +94,79 @@ TSharedPtr<PCGExDiscardByOverlap::FOverlap> FPCGExDiscardByOverlapContext::Regis
 	}
 }
 
+const TArray<int32>& FPCGExDiscardByOverlapContext::GetBroadphaseCandidates(const PCGExPointsMT::IBatch* InBatch, const int32 InBatchIndex)
+{
+	{
+		FReadScopeLock ReadScopeLock(BroadphaseLock);
+		if (bBroadphaseBuilt) { return BroadphaseCandidates[InBatchIndex]; }
+	}
+
+	{
+		FWriteScopeLock WriteScopeLock(BroadphaseLock);
+		if (!bBroadphaseBuilt)
+		{
+			BuildBroadphase(InBatch);
+			bBroadphaseBuilt = true;
+		}
+		return BroadphaseCandidates[InBatchIndex];
+	}
+}
+
+void FPCGExDiscardByOverlapContext::BuildBroadphase(const PCGExPointsMT::IBatch* InBatch)
+{
+	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExDiscardByOverlapContext::BuildBroadphase);
+
+	const int32 NumProcessors = InBatch->GetNumProcessors();
+	BroadphaseCandidates.SetNum(NumProcessors);
+
+	TArray<FBox> DataBounds;
+	DataBounds.SetNumUninitialized(NumProcessors);
+
+	TArray<int32> Order;
+	Order.Reserve(NumProcessors);
+
+	for (int32 i = 0; i < NumProcessors; i++)
+	{
+		// Batch index matches the processor's position in the batch
+		DataBounds[i] = static_cast<const PCGExDiscardByOverlap::FProcessor&>(InBatch->Processors[i].Get()).GetBounds();
+		if (DataBounds[i].IsValid) { Order.Add(i); }
+	}
+
+	Order.Sort([&](const int32 A, const int32 B)
+	{
+		return DataBounds[A].Min.X == DataBounds[B].Min.X ? A < B : DataBounds[A].Min.X < DataBounds[B].Min.X;
+	});
+
+	// Sweep along X, only pairs whose X intervals overlap get their Y/Z tested.
+	// Touching bounds count as overlapping, same as FBox::Overlap.
+	const int32 NumValid = Order.Num();
+	for (int32 i = 0; i < NumValid; i++)
+	{
+		const int32 A = Order[i];
+		const FBox& BoxA = DataBounds[A];
+
+		for (int32 j = i + 1; j < NumValid; j++)
+		{
+			const int32 B = Order[j];
+			const FBox& BoxB = DataBounds[B];
+
+			if (BoxB.Min.X > BoxA.Max.X) { break; }
+
+			if (BoxA.Min.Y > BoxB.Max.Y || BoxB.Min.Y > BoxA.Max.Y ||
+				BoxA.Min.Z > BoxB.Max.Z || BoxB.Min.Z > BoxA.Max.Z)
+			{
+				continue;
+			}
+
+			BroadphaseCandidates[A].Add(B);
+			BroadphaseCandidates[B].Add(A);
+		}
+	}
+
+	// Keep registration order stable regardless of sweep order
+	for (TArray<int32>& Candidates : BroadphaseCandidates) { Candidates.Sort(); }
+}
+
 void FPCGExDiscardByOverlapContext::UpdateScores(const TArray<PCGExDiscardByOverlap::FProcessor*>& InStack)
 {
 	MaxScores.ResetMin();
@@ -93,10 +182,14 @@ void FPCGExDiscardByOverlapContext::UpdateScores(const TArray<PCGExDiscardByOver
 
 void FPCGExDiscardByOverlapContext::Prune()
 {
+	TRACE_CPUPROFILER_EVENT_SCOPE(FPCGExDiscardByOverlapContext::Prune);
+
 	PCGEX_SETTINGS_LOCAL(DiscardByOverlap)
 
+	const int32 NumProcessors = MainBatch->GetNumProcessors();
+
 	TArray<PCGExDiscardByOverlap::FProcessor*> OverlapsStack;
-	OverlapsStack.Reserve(MainBatch->GetNumProcessors());
+	OverlapsStack.Reserve(NumProcessors);
 
 	for (const TPair<PCGExData::FPointIO*, TSharedPtr<PCGExPointsMT::IProcessor>> Pair : SubProcessorMap)
 	{
@@ -115,39 +208,100 @@ void FPCGExDiscardByOverlapContext::Prune()
 		}
 	}
 
+	if (OverlapsStack.IsEmpty())
+	{
+		return;
+	}
+
 	UpdateScores(OverlapsStack);
 
-	while (!OverlapsStack.IsEmpty())
+	// Heap items are batch indices. Min-heap on weight (or its negation when pruning high first),
+	// ties resolved by lowest IO index -- same pick order as sorting the whole stack every iteration.
+	const double Sign = Settings->Logic == EPCGExOverlapPruningLogic::LowFirst ? 1 : -1;
+
+	TArray<PCGExDiscardByOverlap::FProcessor*> Lookup;
+	Lookup.Init(nullptr, NumProcessors);
+
+	PCGEx::FIndexedHeap Heap(NumProcessors);
+	for (PCGExDiscardByOverlap::FProcessor* P : OverlapsStack)
 	{
-		// Sort remaining overlaps...
+		Lookup[P->BatchIndex] = P;
+		Heap.Push(P->BatchIndex, Sign * P->Weight, P->PointDataFacade->Source->IOIndex);
+	}
 
-		if (Settings->Logic == EPCGExOverlapPruningLogic::LowFirst)
+	TArray<PCGExDiscardByOverlap::FProcessor*> Affected;
+
+	while (!Heap.IsEmpty())
+	{
+		PCGExDiscardByOverlap::FProcessor* Candidate = Lookup[Heap.Pop()];
+
+		// Only the candidate and the processors it overlaps see their raw scores change.
+		// If none of them currently holds a maximum, the maximums can only go up.
+		bool bRescanMax = MaxScores.SharesAnyScore(Candidate->RawScores);
+		for (const TSharedPtr<PCGExDiscardByOverlap::FOverlap>& Overlap : Candidate->Overlaps)
 		{
-			OverlapsStack.Sort([](const PCGExDiscardByOverlap::FProcessor& A, const PCGExDiscardByOverlap::FProcessor& B)
-			{
-				return A.Weight == B.Weight ? A.PointDataFacade->Source->IOIndex > B.PointDataFacade->Source->IOIndex : A.Weight > B.Weight;
-			});
+			if (bRescanMax) { break; }
+			bRescanMax = MaxScores.SharesAnyScore(Overlap->GetOther(Candidate)->RawScores);
+		}
+
+		Affected.Reset();
+
+		if (Candidate->HasOverlaps())
+		{
+			Candidate->Pruned(Affected);
 		}
 		else
 		{
-			OverlapsStack.Sort([](const PCGExDiscardByOverlap::FProcessor& A, const PCGExDiscardByOverlap::FProcessor& B)
-			{
-				return A.Weight == B.Weight ? A.PointDataFacade->Source->IOIndex > B.PointDataFacade->Source->IOIndex : A.Weight < B.Weight;
-			});
+			PCGEX_INIT_IO_VOID(Candidate->PointDataFacade->Source, PCGExData::EIOInit::Forward)
+		}
+
+		for (const PCGExDiscardByOverlap::FProcessor* P : Affected)
+		{
+			// Lost its last overlap & was forwarded
+			if (!P->HasOverlaps()) { Heap.Remove(P->BatchIndex); }
 		}
 
-		PCGExDiscardByOverlap::FProcessor* Candidate = OverlapsStack.Pop();
+		if (Heap.IsEmpty())
+		{
+			break;
+		}
 
-		if (Candidate->HasOverlaps())
+		const FPCGExOverlapScoresWeighting PrevMaxScores = MaxScores;
+
+		if (bRescanMax)
 		{
-			Candidate->Pruned(OverlapsStack);
+			MaxScores.ResetMin();
+			for (const int32 Item : Heap.GetItems()) { MaxScores.Max(Lookup[Item]->RawScores); }
 		}
 		else
 		{
-			PCGEX_INIT_IO_VOID(Candidate->PointDataFacade->Source, PCGExData::EIOInit::Forward)
+			for (const PCGExDiscardByOverlap::FProcessor* P : Affected)
+			{
+				if (Heap.Contains(P->BatchIndex)) { MaxScores.Max(P->RawScores); }
+			}
 		}
 
-		UpdateScores(OverlapsStack);
+		if (!MaxScores.HasSameScores(PrevMaxScores))
+		{
+			// Weights are relative to the maximums, every one of them moved
+			for (const int32 Item : Heap.GetItems())
+			{
+				PCGExDiscardByOverlap::FProcessor* P = Lookup[Item];
+				P->UpdateWeight(MaxScores);
+				Heap.SetKeyUnordered(Item, Sign * P->Weight);
+			}
+
+			Heap.Rebuild();
+		}
+		else
+		{
+			for (PCGExDiscardByOverlap::FProcessor* P : Affected)
+			{
+				if (!Heap.Contains(P->BatchIndex)) { continue; }
+				P->UpdateWeight(MaxScores);
+				Heap.Update(P->BatchIndex, Sign * P->Weight);
+			}
+		}
 	}
 }
 
@@ -236,51 +390,34 @@ namespace PCGExDiscardByOverlap
 		Overlaps.Add(Overlap);
 	}
 
-	void FProcessor::RemoveOverlap(const TSharedPtr<FOverlap>& InOverlap, TArray<FProcessor*>& RemaininStack)
+	bool FProcessor::RemoveOverlap(const TSharedPtr<FOverlap>& InOverlap)
 	{
 		Overlaps.Remove(InOverlap);
 
 		if (Overlaps.IsEmpty())
 		{
-			// Remove from stack & output.
-			PCGEX_INIT_IO_VOID(PointDataFacade->Source, PCGExData::EIOInit::Forward)
-			RemaininStack.Remove(this);
-			return;
+			// Out of the stack, output as-is.
+			PCGEX_INIT_IO(PointDataFacade->Source, PCGExData::EIOInit::Forward)
+			return false;
 		}
 
 		Stats.Remove(InOverlap->Stats, NumPoints, TotalVolume);
 		UpdateWeightValues();
+		return true;
 	}
 
-	void FProcessor::Pruned(TArray<FProcessor*>& RemaininStack)
+	void FProcessor::Pruned(TArray<FProcessor*>& OutAffected)
 	{
-		// Remove self from the stack
 		for (const TSharedPtr<FOverlap>& Overlap : Overlaps)
 		{
-			Overlap->GetOther(this)->RemoveOverlap(Overlap, RemaininStack);
+			FProcessor* Other = Overlap->GetOther(this);
+			Other->RemoveOverlap(Overlap);
+			OutAffected.Add(Other);
 		}
 
 		Overlaps.Empty();
 	}
 
-	void FProcessor::RegisterPointBounds(const int32 Index, const TSharedPtr<FPointBounds>& InPointBounds)
-	{
-		const int8 bValidPoint = PointFilterCache[Index];
-		if (!bValidPoint && !Settings->bIncludeFilteredInMetrics)
-		{
-			return;
-		}
-
-		const FBox& B = InPointBounds->Bounds.GetBox();
-		Bounds += B;
-		TotalVolume += B.GetVolume();
-
-		if (bValidPoint)
-		{
-			LocalPointBounds[Index] = InPointBounds;
-		}
-	}
-
 	bool FProcessor::Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager)
 	{
 		PointDataFacade->bSupportsScopedGet = Context->bScopedAttributeGet;
@@ -295,7 +432,8 @@ namespace PCGExDiscardByOverlap
 		InPoints = PointDataFacade->GetIn();
 		NumPoints = InPoints->GetNumPoints();
 
-		PCGExArrayHelpers::InitArray(LocalPointBounds, NumPoints);
+		LocalPointBounds.SetNumUninitialized(NumPoints);
+		WorldPointBounds.SetNumUninitialized(NumPoints);
 
 		StartParallelLoopForPoints(PCGExData::EIOSide::In);
 
@@ -307,13 +445,14 @@ namespace PCGExDiscardByOverlap
 		PointDataFacade->Fetch(Scope);
 		FilterScope(Scope);
 
+		const TConstPCGValueRange<FTransform> InTransforms = InPoints->GetConstTransformValueRange();
+
 #define PCGEX_PREPARE_BOUNDS(_BOUND_SOURCE) \
 		if (Settings->BoundsSource == EPCGExPointBoundsSource::_BOUND_SOURCE){\
 			PCGEX_SCOPE_LOOP(i){\
-				const PCGExData::FConstPoint Point(InPoints, i);\
-				const FBox LocalBounds = PCGExMath::GetLocalBounds<EPCGExPointBoundsSource::_BOUND_SOURCE>(Point).ExpandBy(Settings->Expansion);\
-				TSharedPtr<PCGExDiscardByOverlap::FPointBounds> PtBounds = MakeShared<PCGExDiscardByOverlap::FPointBounds>(i, Point, LocalBounds);\
-				RegisterPointBounds(i, PtBounds); } }
+				const FBox LocalBounds = PCGExMath::GetLocalBounds<EPCGExPointBoundsSource::_BOUND_SOURCE>(PCGExData::FConstPoint(InPoints, i)).ExpandBy(Settings->Expansion);\
+				LocalPointBounds[i] = LocalBounds;\
+				WorldPointBounds[i] = LocalBounds.TransformBy(InTransforms[i].ToMatrixNoScale()); } }
 
 		PCGEX_PREPARE_BOUNDS(ScaledBounds)
 		else
@@ -328,17 +467,33 @@ namespace PCGExDiscardByOverlap
 
 	void FProcessor::OnPointsProcessingComplete()
 	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExDiscardByOverlap::FProcessor::OnPointsProcessingComplete);
+
 		const TConstPCGValueRange<float> Densities = InPoints->GetConstDensityValueRange();
 
-		Octree = MakeUnique<FPointBoundsOctree>(Bounds.GetCenter(), Bounds.GetExtent().Length());
-		for (const TSharedPtr<FPointBounds>& PtBounds : LocalPointBounds)
+		// Accumulated here rather than from within the parallel scopes
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			if (!PointFilterCache[i] && !Settings->bIncludeFilteredInMetrics)
+			{
+				continue;
+			}
+
+			const FBox& B = WorldPointBounds[i];
+			Bounds += B;
+			TotalVolume += B.GetVolume();
+		}
+
+		Octree = MakeShared<PCGExOctree::FItemOctree>(Bounds.GetCenter(), Bounds.GetExtent().Length());
+		for (int32 i = 0; i < NumPoints; i++)
 		{
-			if (!PtBounds)
+			if (!PointFilterCache[i])
 			{
 				continue;
 			}
-			Octree->AddElement(PtBounds.Get());
-			TotalDensity += Densities[PtBounds->Index];
+
+			Octree->AddElement(PCGExOctree::FItem(i, FBoxSphereBounds(WorldPointBounds[i])));
+			TotalDensity += Densities[i];
 		}
 
 		VolumeDensity = NumPoints / TotalVolume;
@@ -349,17 +504,11 @@ namespace PCGExDiscardByOverlap
 		// 2 - Find overlaps between large bounds, we'll be searching only there.
 
 		const TSharedPtr<PCGExPointsMT::IBatch> LocalParent = ParentBatch.Pin();
-		const TArray<TSharedRef<PCGExData::FFacade>>& ProcessorFacades = ParentBatch.Pin()->ProcessorFacades;
-		const int32 NumOtherProcessors = ProcessorFacades.Num();
-		for (int i = 0; i < NumOtherProcessors; i++)
-		{
-			const TSharedPtr<PCGExData::FFacade> OtherFacade = LocalParent->ProcessorFacades[i];
-			if (PointDataFacade == OtherFacade)
-			{
-				continue;
-			} // Skip self
 
-			const TSharedRef<FProcessor> OtherProcessor = StaticCastSharedRef<FProcessor>(*LocalParent->SubProcessorMap->Find(&OtherFacade->Source.Get()));
+		// Broadphase already rejected every data whose bounds can't touch ours
+		for (const int32 i : Context->GetBroadphaseCandidates(LocalParent.Get(), BatchIndex))
+		{
+			FProcessor* OtherProcessor = static_cast<FProcessor*>(&LocalParent->Processors[i].Get());
 			const FBox Intersection = Bounds.Overlap(OtherProcessor->GetBounds());
 
 			if (!Intersection.IsValid)
@@ -367,7 +516,7 @@ namespace PCGExDiscardByOverlap
 				continue;
 			} // No overlap
 
-			RegisterOverlap(&OtherProcessor.Get(), Intersection);
+			RegisterOverlap(OtherProcessor, Intersection);
 		}
 
 		if (Settings->TestMode == EPCGExOverlapTestMode::Fast)
@@ -397,19 +546,24 @@ namespace PCGExDiscardByOverlap
 			// For each managed overlap, find per-point intersections
 
 			const TSharedPtr<FOverlap> Overlap = ManagedOverlaps[Index];
-			const TSharedRef<FProcessor> OtherProcessor = StaticCastSharedRef<FProcessor>(*ParentBatch.Pin()->SubProcessorMap->Find(&Overlap->GetOther(this)->PointDataFacade->Source.Get()));
-
+			const FProcessor* OtherProcessor = Overlap->GetOther(this);
 
 			if (Settings->TestMode != EPCGExOverlapTestMode::Sphere)
 			{
-				Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Overlap->Intersection.GetCenter(), Overlap->Intersection.GetExtent()), [&](const FPointBounds* LocalPoint)
+				const TConstPCGValueRange<FTransform> OtherTransforms = OtherProcessor->GetInPoints()->GetConstTransformValueRange();
+				const TArray<FBox>& OtherLocalBounds = OtherProcessor->GetLocalPointBounds();
+
+				Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Overlap->Intersection.GetCenter(), Overlap->Intersection.GetExtent()), [&](const PCGExOctree::FItem& LocalPoint)
 				{
-					const double Length = LocalPoint->LocalBounds.GetExtent().Length() * 2;
-					const FMatrix InvMatrix = InTransforms[LocalPoint->Index].ToMatrixNoScale().Inverse();
+					const FBox& LocalBounds = LocalPointBounds[LocalPoint.Index];
+					const double Length = LocalBounds.GetExtent().Length() * 2;
+					const FMatrix InvMatrix = InTransforms[LocalPoint.Index].ToMatrixNoScale().Inverse();
 
-					OtherProcessor->GetOctree()->FindElementsWithBoundsTest(FBoxCenterAndExtent(LocalPoint->Bounds.GetBox()), [&](const FPointBounds* OtherPoint)
+					OtherProcessor->GetOctree()->FindElementsWithBoundsTest(FBoxCenterAndExtent(LocalPoint.Bounds.Origin, LocalPoint.Bounds.BoxExtent), [&](const PCGExOctree::FItem& OtherPoint)
 					{
-						const FBox Intersection = LocalPoint->LocalBounds.Overlap(OtherPoint->TransposedBounds(InvMatrix));
+						// Other point's bounds, expressed in this point's local space
+						const FBox Transposed = OtherLocalBounds[OtherPoint.Index].TransformBy(OtherTransforms[OtherPoint.Index].ToMatrixNoScale() * InvMatrix);
+						const FBox Intersection = LocalBounds.Overlap(Transposed);
 
 						if (!Intersection.IsValid)
 						{
@@ -436,14 +590,14 @@ namespace PCGExDiscardByOverlap
 			}
 			else
 			{
-				Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Overlap->Intersection.GetCenter(), Overlap->Intersection.GetExtent()), [&](const FPointBounds* OwnedPoint)
+				Octree->FindElementsWithBoundsTest(FBoxCenterAndExtent(Overlap->Intersection.GetCenter(), Overlap->Intersection.GetExtent()), [&](const PCGExOctree::FItem& OwnedPoint)
 				{
-					const FSphere S1 = OwnedPoint->Bounds.GetSphere();
+					const FSphere S1 = OwnedPoint.Bounds.GetSphere();
 
-					OtherProcessor->GetOctree()->FindElementsWithBoundsTest(FBoxCenterAndExtent(OwnedPoint->Bounds.GetBox()), [&](const FPointBounds* OtherPoint)
+					OtherProcessor->GetOctree()->FindElementsWithBoundsTest(FBoxCenterAndExtent(OwnedPoint.Bounds.Origin, OwnedPoint.Bounds.BoxExtent), [&](const PCGExOctree::FItem& OtherPoint)
 					{
 						double Amount = 0;
-						if (!PCGExMath::SphereOverlap(S1, OtherPoint->Bounds.GetSphere(), Amount))
+						if (!PCGExMath::SphereOverlap(S1, OtherPoint.Bounds.GetSphere(), Amount))
 						{
 							return;
 						}
@@ -299,6 +299,7 @@ namespace PCGExSampleInsidePath
 
 		Path = MakeShared<PCGExPaths::FPolyPath>(PointDataFacade, Settings->ProjectionDetails, 1, Settings->HeightInclusion);
 		Path->OffsetProjection(Settings->InclusionOffset);
+		Path->BuildQueryGrid();
 
 		// Allocate edge native properties
 
@@ -9,6 +9,7 @@
 #include "Data/PCGExPointIO.h"
 #include "Details/PCGExSettingsDetails.h"
 #include "Math/PCGExMathDistances.h"
+#include "Paths/PCGExSplineQuery.h"
 #include "Sampling/PCGExSamplingHelpers.h"
 #include "Types/PCGExTypes.h"
 
@@ -193,6 +194,16 @@ bool FPCGExSampleNearestSplineElement::Boot(FPCGExContext* InContext) const
 		}
 	}
 
+	if (!Settings->bSampleSpecificAlpha)
+	{
+		Context->SplineQueries.SetNum(Context->NumTargets);
+		PCGExMT::ParallelOrSequential(
+			Context->NumTargets, [&](const int32 i)
+			{
+				Context->SplineQueries[i] = MakeShared<PCGExPaths::FSplineQuery>(Context->Splines[i]);
+			}, 8);
+	}
+
 	if (Settings->bUseOctree)
 	{
 		Context->SplineOctree = MakeShared<PCGExOctree::FItemOctree>(Context->OctreeBounds.GetCenter(), Context->OctreeBounds.GetExtent().Length());
@@ -525,7 +536,7 @@ namespace PCGExSampleNearestSpline
 				auto ProcessClosestAlpha = [&](const int32 TargetIndex)
 				{
 					const FPCGSplineStruct& Line = Context->Splines[TargetIndex];
-					const double Time = Line.FindInputKeyClosestToWorldLocation(Origin);
+					const double Time = Context->SplineQueries[TargetIndex]->FindInputKeyClosest(Origin);
 					ProcessTarget(Line.GetTransformAtSplineInputKey
 					              (static_cast<float>(Time), ESplineCoordinateSpace::World, Settings->bSplineScalesRanges),
 					              Time, Context->SegmentCounts[TargetIndex], Line);
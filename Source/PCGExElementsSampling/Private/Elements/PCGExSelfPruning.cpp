@@ -3,6 +3,7 @@
 
 #include "Elements/PCGExSelfPruning.h"
 
+#include "Core/PCGExPruningEngine.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointIO.h"
 #include "Data/PCGPointData.h"
@@ -181,10 +182,18 @@ namespace PCGExSelfPruning
 		TArray<int32> Order;
 		PCGExArrayHelpers::ArrayOfIndices(Order, NumPoints);
 
-		PCGExArrayHelpers::InitArray(Candidates, NumPoints);
 		Priority.SetNumUninitialized(NumPoints);
 		BoxSecondary.Init(FBox(NoInit), NumPoints);
 
+		if (Settings->Mode == EPCGExSelfPruningMode::WriteResult)
+		{
+			PCGExArrayHelpers::InitArray(Candidates, NumPoints);
+		}
+		else
+		{
+			BoxPrimary.Init(FBox(NoInit), NumPoints);
+		}
+
 		// Allocate OBB arrays only when precise testing is enabled
 		if (Settings->bPreciseTest)
 		{
@@ -259,9 +268,8 @@ namespace PCGExSelfPruning
 			Priority[Order[i]] = i;
 		}
 
-		// Only force single-threaded for Prune mode (Mask is shared state)
-		// WriteResult mode can run in parallel since each candidate's overlap count is independent
-		bForceSingleThreadedProcessRange = (Settings->Mode == EPCGExSelfPruningMode::Prune);
+		// Both modes run the range loop in parallel: WriteResult overlap counts are independent,
+		// and pruning only gathers conflicts there -- they are resolved once all scopes are done.
 		StartParallelLoopForPoints(PCGExData::EIOSide::In);
 
 		return true;
@@ -275,12 +283,41 @@ namespace PCGExSelfPruning
 		PointDataFacade->Fetch(Scope);
 		FilterScope(Scope);
 
-		PCGEX_SCOPE_LOOP(Index)
+		if (Settings->Mode == EPCGExSelfPruningMode::WriteResult)
+		{
+			PCGEX_SCOPE_LOOP(Index)
+			{
+				FCandidateInfos& Candidate = Candidates[Index];
+				Candidate.Index = Index;
+				Candidate.bSkip = false;
+				Candidate.Overlaps = 0;
+			}
+		}
+		else
 		{
-			FCandidateInfos& Candidate = Candidates[Index];
-			Candidate.Index = Index;
-			Candidate.bSkip = false;
-			Candidate.Overlaps = 0;
+			// Build BoxPrimary (world AABBs tested against others' BoxSecondary)
+			switch (Settings->PrimaryMode)
+			{
+			case EPCGExSelfPruningExpandOrder::Before:
+				PCGEX_SCOPE_LOOP(Index)
+				{
+					BoxPrimary[Index] = InData->GetLocalBounds(Index).ExpandBy(PrimaryExpansion->Read(Index)).TransformBy(Transforms[Index]);
+				}
+				break;
+			case EPCGExSelfPruningExpandOrder::After:
+				PCGEX_SCOPE_LOOP(Index)
+				{
+					BoxPrimary[Index] = InData->GetLocalBounds(Index).TransformBy(Transforms[Index]).ExpandBy(PrimaryExpansion->Read(Index));
+				}
+				break;
+			default:
+			case EPCGExSelfPruningExpandOrder::None:
+				PCGEX_SCOPE_LOOP(Index)
+				{
+					BoxPrimary[Index] = InData->GetLocalBounds(Index).TransformBy(Transforms[Index]);
+				}
+				break;
+			}
 		}
 
 		// Build BoxSecondary (world AABBs for octree pre-filtering)
@@ -372,25 +409,36 @@ namespace PCGExSelfPruning
 
 	void FProcessor::OnPointsProcessingComplete()
 	{
-		Candidates.Sort([&](const FCandidateInfos& A, const FCandidateInfos& B)
+		if (Settings->Mode == EPCGExSelfPruningMode::WriteResult)
 		{
-			return Priority[A.Index] > Priority[B.Index];
-		});
-		LastCandidatesCount = Candidates.Num();
+			StartParallelLoopForRange(Candidates.Num());
+			return;
+		}
+
+		PruningEngine = MakeShared<FPruningEngine>(
+			Priority, PointFilterCache, BoxPrimary, BoxSecondary,
+			Settings->bPreciseTest ? &PrimaryOBBs : nullptr,
+			Settings->bPreciseTest ? &SecondaryOBBs : nullptr);
 
-		StartParallelLoopForRange(Candidates.Num());
+		PruningEngine->Init();
+		StartParallelLoopForRange(PointDataFacade->GetNum());
+	}
+
+	void FProcessor::PrepareLoopScopesForRanges(const TArray<PCGExMT::FScope>& Loops)
+	{
+		if (PruningEngine) { PruningEngine->PrepareScopes(Loops); }
 	}
 
 	void FProcessor::ProcessRange(const PCGExMT::FScope& Scope)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGEx::SelfPruning::ProcessRange);
 
-		const UPCGBasePointData* InData = PointDataFacade->GetIn();
-		const PCGPointOctree::FPointOctree& Octree = InData->GetPointOctree();
-		TConstPCGValueRange<FTransform> Transforms = InData->GetConstTransformValueRange();
-
 		if (Settings->Mode == EPCGExSelfPruningMode::WriteResult)
 		{
+			const UPCGBasePointData* InData = PointDataFacade->GetIn();
+			const PCGPointOctree::FPointOctree& Octree = InData->GetPointOctree();
+			TConstPCGValueRange<FTransform> Transforms = InData->GetConstTransformValueRange();
+
 			PCGEX_SCOPE_LOOP(i)
 			{
 				FCandidateInfos& Candidate = Candidates[i];
@@ -443,73 +491,7 @@ namespace PCGExSelfPruning
 		}
 		else
 		{
-			PCGEX_SCOPE_LOOP(i)
-			{
-				FCandidateInfos& Candidate = Candidates[i];
-				Candidate.bSkip = true;
-
-				const int32 Index = Candidate.Index;
-
-				if (!PointFilterCache[Index])
-				{
-					continue;
-				}
-
-				const int32 CurrentPriority = Priority[Index];
-				const FTransform& Transform = Transforms[Index];
-
-
-				FBox BoxA = InData->GetLocalBounds(Index);
-				FBox Box = FBox(NoInit);
-				if (Settings->PrimaryMode == EPCGExSelfPruningExpandOrder::Before)
-				{
-					BoxA = BoxA.ExpandBy(PrimaryExpansion->Read(Index));
-					Box = BoxA.TransformBy(Transform);
-				}
-				else if (Settings->PrimaryMode == EPCGExSelfPruningExpandOrder::After)
-				{
-					Box = BoxA.TransformBy(Transform).ExpandBy(PrimaryExpansion->Read(Index));
-					BoxA = BoxA.ExpandBy(PrimaryExpansion->Read(Index));
-				}
-				else
-				{
-					Box = BoxA.TransformBy(Transform);
-				}
-
-				Octree.FindFirstElementWithBoundsTest(Box, [&](const PCGPointOctree::FPointRef& Other)
-				{
-					const int32 OtherIndex = Other.Index;
-
-					// Ignore self
-					if (OtherIndex == Index || !PointFilterCache[OtherIndex] || !Mask[OtherIndex])
-					{
-						return true;
-					}
-
-					// Ignore lower priorities, those will be pruned by this candidate when their turn comes
-					if (Priority[OtherIndex] < CurrentPriority)
-					{
-						return true;
-					}
-
-					if (Box.Intersect(BoxSecondary[OtherIndex]))
-					{
-						if (Settings->bPreciseTest)
-						{
-							// Use pre-built OBBs instead of constructing them each time
-							if (!PCGExMath::OBB::SATOverlap(PrimaryOBBs[Index], SecondaryOBBs[OtherIndex]))
-							{
-								return true;
-							}
-						}
-
-						Mask[Index] = false;
-						return false;
-					}
-
-					return true;
-				});
-			}
+			PruningEngine->ProcessScope(Scope);
 		}
 	}
 
@@ -558,31 +540,8 @@ namespace PCGExSelfPruning
 			return;
 		}
 
-		int32 WriteIndex = 0;
-		for (int32 i = 0; i < Candidates.Num(); i++)
-		{
-			FCandidateInfos& Candidate = Candidates[i];
-			if (!Candidate.bSkip)
-			{
-				Candidates[WriteIndex++] = MoveTemp(Candidate);
-			}
-		}
-
-		Candidates.SetNum(WriteIndex);
-
-		if (!Candidates.IsEmpty())
-		{
-			if (LastCandidatesCount == WriteIndex)
-			{
-				// Error
-				// Somehow the last run could not get rid of some overlap, number of candidates hasn't changed
-				// We have to stop iterating now or we'll iterate forever
-				return;
-			}
-
-			LastCandidatesCount = WriteIndex;
-			StartParallelLoopForRange(WriteIndex);
-		}
+		PruningEngine->Resolve(Mask);
+		PruningEngine.Reset();
 	}
 
 	void FProcessor::CompleteWork()
@@ -0,0 +1,91 @@
+﻿// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "PCGExOctree.h"
+#include "Core/PCGExMTCommon.h"
+#include "Math/OBB/PCGExOBB.h"
+
+namespace PCGExSelfPruning
+{
+	/**
+	 * Priority-ordered pruning over box overlaps, resolved as a greedy maximal independent set.
+	 *
+	 * A point is kept unless it overlaps a kept point of higher priority -- the outcome of visiting points one at a
+	 * time in descending priority order. Rather than re-querying the broadphase as points get pruned, the conflict graph
+	 * (each point's higher-priority overlapping neighbors, its "dominators") is built once, in parallel, then resolved in
+	 * rounds: a point is pruned as soon as one of its dominators is kept, and kept once they're all pruned.
+	 * Rounds only read the previous round's state, so the result is identical whatever the thread count;
+	 * once rounds stop paying off, the few remaining points are settled with a single ordered sweep.
+	 *
+	 * Overlap of i against a higher-priority j is Primary(i) vs Secondary(j), optionally refined with an OBB SAT test.
+	 */
+	class PCGEXELEMENTSSAMPLING_API FPruningEngine : public TSharedFromThis<FPruningEngine>
+	{
+	public:
+		/**
+		 * @param InPriority Unique per-point priority in [0, Num), higher wins
+		 * @param InParticipants Points taking part in pruning. Others are always kept and never prune anyone.
+		 * @param InPrimaryBoxes World bounds used when a point is tested against others
+		 * @param InSecondaryBoxes World bounds used when a point is tested by others
+		 * @param InPrimaryOBBs Optional, precise counterpart of InPrimaryBoxes (requires InSecondaryOBBs)
+		 * @param InSecondaryOBBs Optional, precise counterpart of InSecondaryBoxes
+		 */
+		FPruningEngine(
+			const TArray<int32>& InPriority,
+			const TArray<int8>& InParticipants,
+			const TArray<FBox>& InPrimaryBoxes,
+			const TArray<FBox>& InSecondaryBoxes,
+			const TArray<PCGExMath::OBB::FOBB>* InPrimaryOBBs = nullptr,
+			const TArray<PCGExMath::OBB::FOBB>* InSecondaryOBBs = nullptr);
+
+		/** Builds the broadphase. Must be called before any scope is processed. */
+		void Init();
+
+		void PrepareScopes(const TArray<PCGExMT::FScope>& Loops);
+
+		/** Gathers the dominators of every point in the scope. Scopes are independent and can run in parallel. */
+		void ProcessScope(const PCGExMT::FScope& Scope);
+
+		/**
+		 * Compiles the conflict graph & resolves it.
+		 * @param OutKeep Keep mask, one bit per point. Only participants are written to.
+		 * @return Number of participants pruned
+		 */
+		int32 Resolve(TBitArray<>& OutKeep);
+
+		int32 GetNumConflicts() const { return Dominators.Num(); }
+
+	protected:
+		enum EState : int8
+		{
+			Undecided = 0,
+			Keep      = 1,
+			Prune     = 2,
+		};
+
+		const TArray<int32>& Priority;
+		const TArray<int8>& Participants;
+		const TArray<FBox>& PrimaryBoxes;
+		const TArray<FBox>& SecondaryBoxes;
+		const TArray<PCGExMath::OBB::FOBB>* PrimaryOBBs = nullptr;
+		const TArray<PCGExMath::OBB::FOBB>* SecondaryOBBs = nullptr;
+
+		TSharedPtr<PCGExOctree::FItemOctree> Octree;
+
+		// Per-scope gathering, compiled into CSR once all scopes are done.
+		// Scopes cover contiguous, ascending index ranges so concatenating them in loop order is already CSR order.
+		TArray<TArray<int32>> ScopedDominators;
+		TArray<int32> NumDominators;
+
+		TArray<int32> DominatorStart;
+		TArray<int32> Dominators; // Sorted by descending priority within each point's range
+
+		TArray<int8> State;
+
+		void CompileGraph();
+		int8 Evaluate(const int32 Index) const;
+	};
+}
@@ -99,6 +99,10 @@ struct FPCGExOverlapScoresWeighting
 	void Init();
 	void ResetMin();
 	void Max(const FPCGExOverlapScoresWeighting& Other);
+
+	/** True if any score component is equal to its counterpart in Other */
+	bool SharesAnyScore(const FPCGExOverlapScoresWeighting& Other) const;
+	bool HasSameScores(const FPCGExOverlapScoresWeighting& Other) const;
 };
 
 namespace PCGExDiscardByOverlap
@@ -183,6 +187,9 @@ struct FPCGExDiscardByOverlapContext final : FPCGExPointsProcessorContext
 
 	TSharedPtr<PCGExDiscardByOverlap::FOverlap> RegisterOverlap(PCGExDiscardByOverlap::FProcessor* InA, PCGExDiscardByOverlap::FProcessor* InB, const FBox& InIntersection);
 
+	/** Indices of the processors whose bounds touch the given one's, ascending. Swept once for the whole batch, on first request. */
+	const TArray<int32>& GetBroadphaseCandidates(const PCGExPointsMT::IBatch* InBatch, const int32 InBatchIndex);
+
 	FPCGExOverlapScoresWeighting Weights;
 	FPCGExOverlapScoresWeighting MaxScores;
 	TArray<PCGExDiscardByOverlap::FProcessor*> AllProcessors;
@@ -191,6 +198,12 @@ struct FPCGExDiscardByOverlapContext final : FPCGExPointsProcessorContext
 	void Prune();
 
 protected:
+	mutable FRWLock BroadphaseLock;
+	bool bBroadphaseBuilt = false;
+	TArray<TArray<int32>> BroadphaseCandidates;
+
+	void BuildBroadphase(const PCGExPointsMT::IBatch* InBatch);
+
 	PCGEX_ELEMENT_BATCH_POINT_DECL
 };
 
@@ -264,6 +277,7 @@ namespace PCGExDiscardByOverlap
 		}
 	};
 
+	// Kept for sample overlap stats, discard-by-overlap itself stores its point bounds flat (see FProcessor)
 	struct PCGEXELEMENTSSAMPLING_API FPointBounds
 	{
 		FPointBounds(const int32 InIndex, const PCGExData::FConstPoint& InPoint, const FBox& InBounds)
@@ -294,9 +308,11 @@ namespace PCGExDiscardByOverlap
 		const UPCGBasePointData* InPoints = nullptr;
 		FBox Bounds = FBox(ForceInit);
 
-		TUniquePtr<FPointBoundsOctree> Octree;
-
-		TArray<TSharedPtr<FPointBounds>> LocalPointBounds;
+		// Per-point expanded local bounds and their world-space counterpart, indexed by point.
+		// Only points that pass the filters are inserted in the octree.
+		TArray<FBox> LocalPointBounds;
+		TArray<FBox> WorldPointBounds;
+		TSharedPtr<PCGExOctree::FItemOctree> Octree;
 
 		mutable FRWLock RegistrationLock;
 		TArray<TSharedPtr<FOverlap>> Overlaps;
@@ -326,12 +342,17 @@ namespace PCGExDiscardByOverlap
 			return Bounds;
 		}
 
-		FORCEINLINE const TArray<TSharedPtr<FPointBounds>>& GetPointBounds() const
+		FORCEINLINE const UPCGBasePointData* GetInPoints() const
+		{
+			return InPoints;
+		}
+
+		FORCEINLINE const TArray<FBox>& GetLocalPointBounds() const
 		{
 			return LocalPointBounds;
 		}
 
-		FORCEINLINE const FPointBoundsOctree* GetOctree() const
+		FORCEINLINE const PCGExOctree::FItemOctree* GetOctree() const
 		{
 			return Octree.Get();
 		}
@@ -342,9 +363,11 @@ namespace PCGExDiscardByOverlap
 		}
 
 		void RegisterOverlap(FProcessor* InOtherProcessor, const FBox& Intersection);
-		void RemoveOverlap(const TSharedPtr<FOverlap>& InOverlap, TArray<FProcessor*>& RemaininStack);
-		void Pruned(TArray<FProcessor*>& RemaininStack);
-		void RegisterPointBounds(const int32 Index, const TSharedPtr<FPointBounds>& InPointBounds);
+		/** Returns false if this was the last overlap, in which case the data is forwarded as-is. */
+		bool RemoveOverlap(const TSharedPtr<FOverlap>& InOverlap);
+
+		/** Release all overlaps this processor was part of; OutAffected receives the processors on the other end. */
+		void Pruned(TArray<FProcessor*>& OutAffected);
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager) override;
 		virtual void ProcessPoints(const PCGExMT::FScope& Scope) override;
@@ -47,6 +47,11 @@ namespace PCGExMT
 	class TScopedNumericValue;
 }
 
+namespace PCGExPaths
+{
+	class FSplineQuery;
+}
+
 UENUM()
 enum class EPCGExSplineDepthMode : uint8
 {
@@ -486,6 +491,9 @@ struct FPCGExSampleNearestSplineContext final : FPCGExPointsProcessorContext
 	TArray<double> SegmentCounts;
 	TArray<double> Lengths;
 
+	// Closest-key accelerators, one per target; only built when sampling at closest alpha
+	TArray<TSharedPtr<PCGExPaths::FSplineQuery>> SplineQueries;
+
 	FBox OctreeBounds = FBox(ForceInit);
 	TSharedPtr<PCGExOctree::FItemOctree> SplineOctree;
 
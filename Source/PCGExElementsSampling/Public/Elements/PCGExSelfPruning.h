@@ -170,6 +170,8 @@ protected:
 
 namespace PCGExSelfPruning
 {
+	class FPruningEngine;
+
 	struct FCandidateInfos
 	{
 		FCandidateInfos() = default;
@@ -187,14 +189,15 @@ namespace PCGExSelfPruning
 
 		TBitArray<> Mask;
 		TArray<int32> Priority;
-		TArray<FCandidateInfos> Candidates;
+		TArray<FCandidateInfos> Candidates; // WriteResult only
+		TArray<FBox> BoxPrimary;            // Prune only
 		TArray<FBox> BoxSecondary;
 
 		// Pre-built OBBs for precise testing (only allocated when bPreciseTest is true)
 		TArray<PCGExMath::OBB::FOBB> PrimaryOBBs;
 		TArray<PCGExMath::OBB::FOBB> SecondaryOBBs;
 
-		int32 LastCandidatesCount = 0;
+		TSharedPtr<FPruningEngine> PruningEngine;
 
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
@@ -211,6 +214,7 @@ namespace PCGExSelfPruning
 		virtual void ProcessPoints(const PCGExMT::FScope& Scope) override;
 		virtual void OnPointsProcessingComplete() override;
 
+		virtual void PrepareLoopScopesForRanges(const TArray<PCGExMT::FScope>& Loops) override;
 		virtual void ProcessRange(const PCGExMT::FScope& Scope) override;
 		virtual void OnRangeProcessingComplete() override;
 
@@ -7,6 +7,7 @@
 
 #include "Elements/Layout/PCGExBinPacking3D.h"
 
+#include "Core/PCGExMTCommon.h"
 #include "Data/PCGExAttributeBroadcaster.h"
 #include "Data/PCGExData.h"
 #include "Data/PCGExPointIO.h"
@@ -306,9 +307,49 @@ namespace PCGExBinPacking3D
 
 #pragma endregion
 
+#pragma region FBP3DItemGrid
+
+	void FBP3DItemGrid::Init(const FBox& InBounds, const double InCellSize)
+	{
+		Origin = InBounds.Min;
+
+		const FVector Size = InBounds.GetSize();
+		const double CellSize = FMath::Max(InCellSize, UE_KINDA_SMALL_NUMBER);
+
+		for (int C = 0; C < 3; C++)
+		{
+			Dims[C] = FMath::Clamp(FMath::CeilToInt32(Size[C] / CellSize), 1, MaxDim);
+			InvCellSize[C] = Size[C] > UE_KINDA_SMALL_NUMBER ? Dims[C] / Size[C] : 0;
+		}
+
+		Cells.SetNum(Dims.X * Dims.Y * Dims.Z);
+	}
+
+	void FBP3DItemGrid::Add(const int32 InItemIndex, const FBox& InBox)
+	{
+		const FIntVector Lo = ToCell(InBox.Min);
+		const FIntVector Hi = ToCell(InBox.Max);
+
+		if (FirstCell.Num() <= InItemIndex) { FirstCell.SetNum(InItemIndex + 1); }
+		FirstCell[InItemIndex] = Lo;
+
+		for (int32 CZ = Lo.Z; CZ <= Hi.Z; CZ++)
+		{
+			for (int32 CY = Lo.Y; CY <= Hi.Y; CY++)
+			{
+				for (int32 CX = Lo.X; CX <= Hi.X; CX++)
+				{
+					Cells[CX + CY * Dims.X + CZ * Dims.X * Dims.Y].Add(InItemIndex);
+				}
+			}
+		}
+	}
+
+#pragma endregion
+
 #pragma region FBP3DBin
 
-	FBP3DBin::FBP3DBin(int32 InBinIndex, const PCGExData::FConstPoint& InBinPoint, const FVector& InSeed)
+	FBP3DBin::FBP3DBin(int32 InBinIndex, const PCGExData::FConstPoint& InBinPoint, const FVector& InSeed, const double InCellSize)
 	{
 		BinIndex = InBinIndex;
 		Seed = InSeed;
@@ -321,6 +362,8 @@ namespace PCGExBinPacking3D
 		UsedVolume = 0;
 		CurrentWeight = 0;
 
+		Grid.Init(Bounds, InCellSize);
+
 		// Determine packing direction from seed position relative to bin center
 		const FVector BinCenter = Bounds.GetCenter();
 		for (int C = 0; C < 3; C++)
@@ -360,12 +403,18 @@ namespace PCGExBinPacking3D
 			const int32 A = (C + 1) % 3;
 			const int32 B = (C + 2) % 3;
 
+			// Only items in the column between the point and the bin wall can stop it
+			FBox Column(RawPoint - FVector(KINDA_SMALL_NUMBER), RawPoint + FVector(KINDA_SMALL_NUMBER));
+
 			if (PackSign[C] > 0)
 			{
 				// Packing from Min: slide toward Min, stop at nearest item Max face
+				Column.Min[C] = Bounds.Min[C];
+
 				double Best = Bounds.Min[C];
-				for (const FBP3DItem& Item : Items)
+				Grid.ForEachCandidate(Column, [&](const int32 ItemIndex)
 				{
+					const FBP3DItem& Item = Items[ItemIndex];
 					if (Item.PaddedBox.Max[C] <= RawPoint[C] + KINDA_SMALL_NUMBER && Item.PaddedBox.Max[C] > Best)
 					{
 						// Point must be within item's footprint on the other two axes
@@ -377,15 +426,18 @@ namespace PCGExBinPacking3D
 							Best = Item.PaddedBox.Max[C];
 						}
 					}
-				}
+				});
 				Result[C] = Best;
 			}
 			else
 			{
 				// Packing from Max: slide toward Max, stop at nearest item Min face
+				Column.Max[C] = Bounds.Max[C];
+
 				double Best = Bounds.Max[C];
-				for (const FBP3DItem& Item : Items)
+				Grid.ForEachCandidate(Column, [&](const int32 ItemIndex)
 				{
+					const FBP3DItem& Item = Items[ItemIndex];
 					if (Item.PaddedBox.Min[C] >= RawPoint[C] - KINDA_SMALL_NUMBER && Item.PaddedBox.Min[C] < Best)
 					{
 						if (RawPoint[A] >= Item.PaddedBox.Min[A] - KINDA_SMALL_NUMBER &&
@@ -396,7 +448,7 @@ namespace PCGExBinPacking3D
 							Best = Item.PaddedBox.Min[C];
 						}
 					}
-				}
+				});
 				Result[C] = Best;
 			}
 		}
@@ -406,19 +458,16 @@ namespace PCGExBinPacking3D
 
 	bool FBP3DBin::IsInsideAnyItem(const FVector& Point) const
 	{
-		for (const FBP3DItem& Item : Items)
+		return Grid.AnyCandidate(FBox(Point, Point), [&](const int32 ItemIndex)
 		{
-			if (Point.X > Item.PaddedBox.Min.X + KINDA_SMALL_NUMBER &&
+			const FBP3DItem& Item = Items[ItemIndex];
+			return Point.X > Item.PaddedBox.Min.X + KINDA_SMALL_NUMBER &&
 				Point.X < Item.PaddedBox.Max.X - KINDA_SMALL_NUMBER &&
 				Point.Y > Item.PaddedBox.Min.Y + KINDA_SMALL_NUMBER &&
 				Point.Y < Item.PaddedBox.Max.Y - KINDA_SMALL_NUMBER &&
 				Point.Z > Item.PaddedBox.Min.Z + KINDA_SMALL_NUMBER &&
-				Point.Z < Item.PaddedBox.Max.Z - KINDA_SMALL_NUMBER)
-			{
-				return true;
-			}
-		}
-		return false;
+				Point.Z < Item.PaddedBox.Max.Z - KINDA_SMALL_NUMBER;
+		});
 	}
 
 	void FBP3DBin::GenerateExtremePoints(const FBox& PaddedItemBox)
@@ -481,20 +530,18 @@ namespace PCGExBinPacking3D
 
 	bool FBP3DBin::HasOverlap(const FBox& TestBox) const
 	{
-		for (const FBP3DItem& Item : Items)
+		return Grid.AnyCandidate(TestBox, [&](const int32 ItemIndex)
 		{
+			const FBP3DItem& Item = Items[ItemIndex];
+
 			// Strict overlap check (touching faces is OK)
-			if (TestBox.Min.X < Item.PaddedBox.Max.X - KINDA_SMALL_NUMBER &&
+			return TestBox.Min.X < Item.PaddedBox.Max.X - KINDA_SMALL_NUMBER &&
 				TestBox.Max.X > Item.PaddedBox.Min.X + KINDA_SMALL_NUMBER &&
 				TestBox.Min.Y < Item.PaddedBox.Max.Y - KINDA_SMALL_NUMBER &&
 				TestBox.Max.Y > Item.PaddedBox.Min.Y + KINDA_SMALL_NUMBER &&
 				TestBox.Min.Z < Item.PaddedBox.Max.Z - KINDA_SMALL_NUMBER &&
-				TestBox.Max.Z > Item.PaddedBox.Min.Z + KINDA_SMALL_NUMBER)
-			{
-				return true;
-			}
-		}
-		return false;
+				TestBox.Max.Z > Item.PaddedBox.Min.Z + KINDA_SMALL_NUMBER;
+		});
 	}
 
 	double FBP3DBin::ComputeContactScore(const FBox& TestBox) const
@@ -515,8 +562,9 @@ namespace PCGExBinPacking3D
 		}
 
 		// Check contact with placed items (face-to-face adjacency with padded boxes)
-		for (const FBP3DItem& Item : Items)
+		Grid.ForEachCandidate(TestBox.ExpandBy(KINDA_SMALL_NUMBER * 2), [&](const int32 ItemIndex)
 		{
+			const FBP3DItem& Item = Items[ItemIndex];
 			for (int C = 0; C < 3; C++)
 			{
 				const int32 A = (C + 1) % 3;
@@ -540,7 +588,7 @@ namespace PCGExBinPacking3D
 					}
 				}
 			}
-		}
+		});
 
 		// Normalize to [0,1], lower is better (more contacts = better = lower score)
 		return 1.0 - (static_cast<double>(FMath::Min(Contacts, 6)) / 6.0);
@@ -657,30 +705,31 @@ namespace PCGExBinPacking3D
 		const FBox CandidateActual(Candidate.PlacementMin, Candidate.PlacementMin + Candidate.RotatedSize);
 		const FBox CandidatePadded = CandidateActual.ExpandBy(Candidate.EffectivePadding);
 
-		for (const FBP3DItem& Existing : Items)
+		// Only items below the candidate's footprint matter
+		FBox Column = CandidatePadded;
+		Column.Min.Z = Bounds.Min.Z;
+		Column.Max.Z = CandidatePadded.Min.Z + KINDA_SMALL_NUMBER;
+
+		const bool bOverloads = Grid.AnyCandidate(Column, [&](const int32 ItemIndex)
 		{
+			const FBP3DItem& Existing = Items[ItemIndex];
+
 			// Check if candidate is above existing using padded geometry
 			const bool bAbove = CandidatePadded.Min.Z >= Existing.PaddedBox.Max.Z - KINDA_SMALL_NUMBER;
 
 			if (!bAbove)
 			{
-				continue;
+				return false;
 			}
 
 			// Check XY overlap using padded geometry
 			const bool bXOverlap = CandidatePadded.Min.X < Existing.PaddedBox.Max.X && CandidatePadded.Max.X > Existing.PaddedBox.Min.X;
 			const bool bYOverlap = CandidatePadded.Min.Y < Existing.PaddedBox.Max.Y && CandidatePadded.Max.Y > Existing.PaddedBox.Min.Y;
 
-			if (bXOverlap && bYOverlap)
-			{
-				if (ItemWeight > Threshold * Existing.Weight)
-				{
-					return false;
-				}
-			}
-		}
+			return bXOverlap && bYOverlap && ItemWeight > Threshold * Existing.Weight;
+		});
 
-		return true;
+		return !bOverloads;
 	}
 
 	double FBP3DBin::ComputeSupportRatio(const FBox& ItemBox) const
@@ -699,9 +748,19 @@ namespace PCGExBinPacking3D
 
 		// Sum XY overlap area with items whose padded top touches our bottom
 		// Uses PaddedBox since the algorithm places items in padded-box space
+		FBox Slab = ItemBox;
+		Slab.Min.Z = ItemBox.Min.Z - KINDA_SMALL_NUMBER;
+		Slab.Max.Z = ItemBox.Min.Z + KINDA_SMALL_NUMBER;
+
+		// Summed in placement order so the ratio doesn't depend on grid layout
+		TArray<int32, TInlineAllocator<32>> Supports;
+		Grid.ForEachCandidate(Slab, [&](const int32 ItemIndex) { Supports.Add(ItemIndex); });
+		Supports.Sort();
+
 		double SupportArea = 0.0;
-		for (const FBP3DItem& Existing : Items)
+		for (const int32 ItemIndex : Supports)
 		{
+			const FBP3DItem& Existing = Items[ItemIndex];
 			if (!FMath::IsNearlyEqual(Existing.PaddedBox.Max.Z, ItemBox.Min.Z, KINDA_SMALL_NUMBER))
 			{
 				continue;
@@ -748,7 +807,7 @@ namespace PCGExBinPacking3D
 		const FVector PaddedSize = InItem.PaddedBox.GetSize();
 		UsedVolume += PaddedSize.X * PaddedSize.Y * PaddedSize.Z;
 
-		Items.Add(InItem);
+		Grid.Add(Items.Add(InItem), InItem.PaddedBox);
 
 		// Generate new extreme points from the placed item's padded box
 		GenerateExtremePoints(InItem.PaddedBox);
@@ -757,6 +816,34 @@ namespace PCGExBinPacking3D
 		RemoveInvalidExtremePoints(InItem.PaddedBox);
 	}
 
+	void FBP3DBin::PruneExtremePoints(const double InMinExtent)
+	{
+		if (InMinExtent <= 0)
+		{
+			return;
+		}
+
+		// Smallest box any remaining item could occupy when anchored at an extreme point.
+		// Both tests below only get worse as boxes grow away from the point, so failing them here rules out every placement.
+		const FVector MinSize = FVector(InMinExtent);
+
+		ExtremePoints.RemoveAll([&](const FVector& EP)
+		{
+			FVector Min;
+			for (int C = 0; C < 3; C++) { Min[C] = PackSign[C] > 0 ? EP[C] : EP[C] - MinSize[C]; }
+
+			const FBox MinBox(Min, Min + MinSize);
+
+			return MinBox.Min.X < Bounds.Min.X - KINDA_SMALL_NUMBER ||
+				MinBox.Min.Y < Bounds.Min.Y - KINDA_SMALL_NUMBER ||
+				MinBox.Min.Z < Bounds.Min.Z - KINDA_SMALL_NUMBER ||
+				MinBox.Max.X > Bounds.Max.X + KINDA_SMALL_NUMBER ||
+				MinBox.Max.Y > Bounds.Max.Y + KINDA_SMALL_NUMBER ||
+				MinBox.Max.Z > Bounds.Max.Z + KINDA_SMALL_NUMBER ||
+				HasOverlap(MinBox);
+		});
+	}
+
 	void FBP3DBin::UpdatePoint(PCGExData::FMutablePoint& InPoint, const FBP3DItem& InItem) const
 	{
 		const FQuat RotQuat = InItem.Rotation.Quaternion();
@@ -919,43 +1006,72 @@ namespace PCGExBinPacking3D
 		// Positive affinity: if item belongs to a group that's already placed, restrict to that bin
 		const int32 RequiredBin = Settings->bEnableAffinities ? FindRequiredBinForPositiveAffinity(InItem.Category) : -1;
 
-		auto EvaluateBin = [&](int32 BinIdx)
+		auto IsBinEligible = [&](const FBP3DBin& Bin)
 		{
-			const TSharedPtr<FBP3DBin>& Bin = Bins[BinIdx];
-
 			// Weight constraint pre-check
 			if (Settings->bEnableWeightConstraint)
 			{
-				if (Bin->CurrentWeight + InItem.Weight > Bin->MaxWeight)
+				if (Bin.CurrentWeight + InItem.Weight > Bin.MaxWeight)
 				{
-					return;
+					return false;
 				}
 			}
 
 			// Negative affinity pre-check
 			if (Settings->bEnableAffinities && InItem.Category >= 0)
 			{
-				if (!IsCategoryCompatibleWithBin(InItem.Category, *Bin))
+				if (!IsCategoryCompatibleWithBin(InItem.Category, Bin))
 				{
-					return;
+					return false;
 				}
 			}
 
-			for (int32 EPIdx = 0; EPIdx < Bin->GetEPCount(); EPIdx++)
+			return true;
+		};
+
+		// Each (bin, extreme point) unit is scored independently and keeps its best rotation.
+		// Units are then reduced in bin/extreme point order with a strict comparison, which picks
+		// the same candidate a serial bin -> extreme point -> rotation scan would.
+		TArray<FIntPoint> Units;
+		TArray<FBP3DPlacementCandidate> UnitBest;
+
+		auto EvaluateBins = [&](const TConstArrayView<int32> InBinIndices)
+		{
+			Units.Reset();
+			for (const int32 BinIdx : InBinIndices)
 			{
-				for (int32 RotIdx = 0; RotIdx < RotationsToTest.Num(); RotIdx++)
+				const FBP3DBin& Bin = *Bins[BinIdx];
+				if (!IsBinEligible(Bin)) { continue; }
+				for (int32 EPIdx = 0; EPIdx < Bin.GetEPCount(); EPIdx++) { Units.Emplace(BinIdx, EPIdx); }
+			}
+
+			UnitBest.Reset();
+			UnitBest.SetNum(Units.Num());
+
+			PCGExMT::ParallelOrSequential(
+				Units.Num(),
+				[&](const int32 UnitIndex)
 				{
-					FBP3DPlacementCandidate Candidate;
-					Candidate.RotationIndex = RotIdx;
+					const FIntPoint& Unit = Units[UnitIndex];
+					const FBP3DBin& Bin = *Bins[Unit.X];
+					FBP3DPlacementCandidate& UnitCandidate = UnitBest[UnitIndex];
 
-					if (Bin->EvaluatePlacement(OriginalSize, InItem.Padding, EPIdx, RotationsToTest[RotIdx], Candidate))
+					for (int32 RotIdx = 0; RotIdx < RotationsToTest.Num(); RotIdx++)
 					{
+						FBP3DPlacementCandidate Candidate;
+						Candidate.RotationIndex = RotIdx;
+
+						if (!Bin.EvaluatePlacement(OriginalSize, InItem.Padding, Unit.Y, RotationsToTest[RotIdx], Candidate))
+						{
+							continue;
+						}
+
 						// Support check -- reject placements with no physical support beneath
 						if (Settings->bRequireSupport)
 						{
 							const FBox CandidateActualBox(Candidate.PlacementMin, Candidate.PlacementMin + Candidate.RotatedSize);
 							const FBox CandidatePaddedBox = CandidateActualBox.ExpandBy(Candidate.EffectivePadding);
-							const double Support = Bin->ComputeSupportRatio(CandidatePaddedBox);
+							const double Support = Bin.ComputeSupportRatio(CandidatePaddedBox);
 							if (Support < InItem.MinSupportRatio - KINDA_SMALL_NUMBER)
 							{
 								continue;
@@ -970,7 +1086,7 @@ namespace PCGExBinPacking3D
 						// Load bearing post-check
 						if (Settings->bEnableLoadBearing)
 						{
-							if (!Bin->CheckLoadBearing(Candidate, InItem.Weight, InItem.LoadBearingThreshold))
+							if (!Bin.CheckLoadBearing(Candidate, InItem.Weight, InItem.LoadBearingThreshold))
 							{
 								continue;
 							}
@@ -978,49 +1094,43 @@ namespace PCGExBinPacking3D
 
 						Candidate.Score = ComputeFinalScore(Candidate);
 
-						if (Candidate.Score < BestScore)
+						if (Candidate.Score < UnitCandidate.Score)
 						{
-							BestScore = Candidate.Score;
-							BestCandidate = Candidate;
+							UnitCandidate = Candidate;
 						}
 					}
-				}
-			}
-		};
+				}, 32);
 
-		if (Settings->bGlobalBestFit)
-		{
-			if (RequiredBin >= 0)
-			{
-				EvaluateBin(RequiredBin);
-			}
-			else
+			for (const FBP3DPlacementCandidate& Candidate : UnitBest)
 			{
-				for (int32 BinIdx = 0; BinIdx < Bins.Num(); BinIdx++)
+				if (Candidate.IsValid() && Candidate.Score < BestScore)
 				{
-					EvaluateBin(BinIdx);
+					BestScore = Candidate.Score;
+					BestCandidate = Candidate;
 				}
 			}
+		};
+
+		if (RequiredBin >= 0)
+		{
+			EvaluateBins(MakeArrayView(&RequiredBin, 1));
+		}
+		else if (Settings->bGlobalBestFit)
+		{
+			TArray<int32> AllBins;
+			PCGExArrayHelpers::ArrayOfIndices(AllBins, Bins.Num());
+			EvaluateBins(AllBins);
 		}
 		else
 		{
-			if (RequiredBin >= 0)
-			{
-				EvaluateBin(RequiredBin);
-			}
-			else
+			// First fit: bins are tried in order, the first one offering any placement wins
+			for (int32 BinIdx = 0; BinIdx < Bins.Num(); BinIdx++)
 			{
-				for (int32 BinIdx = 0; BinIdx < Bins.Num(); BinIdx++)
-				{
-					BestScore = TNumericLimits<double>::Max();
-					BestCandidate = FBP3DPlacementCandidate();
-
-					EvaluateBin(BinIdx);
+				EvaluateBins(MakeArrayView(&BinIdx, 1));
 
-					if (BestCandidate.IsValid())
-					{
-						break;
-					}
+				if (BestCandidate.IsValid())
+				{
+					break;
 				}
 			}
 		}
@@ -1066,8 +1176,9 @@ namespace PCGExBinPacking3D
 		PCGEX_INIT_IO(TargetBins, PCGExData::EIOInit::Duplicate)
 
 		// Init shorthand buffers
+		// Padding is read for every point by the extent pre-pass below, ahead of any scoped fetch
 		PaddingBuffer = Settings->OccupationPadding.GetValueSetting();
-		if (!PaddingBuffer->Init(PointDataFacade))
+		if (!PaddingBuffer->Init(PointDataFacade, false))
 		{
 			return false;
 		}
@@ -1203,6 +1314,39 @@ namespace PCGExBinPacking3D
 			}
 		}
 
+		// Item footprints: the average padded size sets the bins' grid resolution,
+		// the smallest one still to be placed bounds which extreme points remain usable.
+		double CellSize = 0;
+		RemainingMinExtent.SetNumUninitialized(NumPoints + 1);
+		RemainingMinExtent[NumPoints] = 0;
+
+		{
+			const UPCGBasePointData* InPoints = PointDataFacade->GetIn();
+
+			TArray<double> MinExtents;
+			MinExtents.SetNumUninitialized(NumPoints);
+
+			double SumExtent = 0;
+			for (int32 i = 0; i < NumPoints; i++)
+			{
+				const FVector Size = PCGExMath::GetLocalBounds<EPCGExPointBoundsSource::ScaledBounds>(PCGExData::FConstPoint(InPoints, i)).GetSize();
+				const FVector Padding = PaddingBuffer->Read(i);
+
+				// Rotations only permute axes, so the smallest components bound every orientation
+				MinExtents[i] = Size.GetMin() + Padding.GetMin() * 2;
+				SumExtent += (Size.X + Size.Y + Size.Z + (Padding.X + Padding.Y + Padding.Z) * 2) / 3;
+			}
+
+			CellSize = NumPoints > 0 ? SumExtent / NumPoints : 0;
+
+			double RunningMin = TNumericLimits<double>::Max();
+			for (int32 i = NumPoints - 1; i >= 0; i--)
+			{
+				RunningMin = FMath::Min(RunningMin, MinExtents[ProcessingOrder[i]]);
+				RemainingMinExtent[i] = RunningMin - KINDA_SMALL_NUMBER;
+			}
+		}
+
 		// Create bins
 		BinMaxWeights.SetNum(TargetBins->GetNum());
 		for (int i = 0; i < TargetBins->GetNum(); i++)
@@ -1220,7 +1364,7 @@ namespace PCGExBinPacking3D
 				Seed = BinPoint.GetTransform().InverseTransformPositionNoScale(SeedGetter ? SeedGetter->FetchSingle(BinPoint, FVector::ZeroVector) : Settings->SeedPosition);
 			}
 
-			PCGEX_MAKE_SHARED(NewBin, FBP3DBin, i, BinPoint, Seed)
+			PCGEX_MAKE_SHARED(NewBin, FBP3DBin, i, BinPoint, Seed, CellSize)
 
 			NewBin->bAbsolutePadding = Settings->bAbsolutePadding;
 
@@ -1276,6 +1420,7 @@ namespace PCGExBinPacking3D
 				TSharedPtr<FBP3DBin>& Bin = Bins[BestPlacement.BinIndex];
 				Bin->CommitPlacement(BestPlacement, Item);
 				Bin->UpdatePoint(Point, Item);
+				Bin->PruneExtremePoints(RemainingMinExtent[Index + 1]);
 				bPlaced = true;
 			}
 
@@ -9,6 +9,7 @@
 #include "Details/PCGExInfluenceDetails.h"
 #include "Math/Geo/PCGExDelaunay.h"
 #include "Math/Geo/PCGExGeo.h"
+#include "Math/Geo/PCGExIncrementalDelaunay.h"
 
 #define LOCTEXT_NAMESPACE "PCGExLloydRelaxElement"
 #define PCGEX_NAMESPACE LloydRelax
@@ -110,14 +111,8 @@ namespace PCGExLloydRelax
 		{
 			NumIterations--;
 
-			TUniquePtr<PCGExMath::Geo::TDelaunay3> Delaunay = MakeUnique<PCGExMath::Geo::TDelaunay3>();
 			TArray<FVector>& Positions = Processor->ActivePositions;
-
 			const TArrayView<FVector> View = MakeArrayView(Positions);
-			if (!Delaunay->Process<false, false>(View))
-			{
-				return;
-			}
 
 			const int32 NumPoints = Positions.Num();
 
@@ -127,14 +122,34 @@ namespace PCGExLloydRelax
 			TArray<double> Counts;
 			Counts.Init(1, NumPoints);
 
-			FVector Centroid;
-			for (const PCGExMath::Geo::FDelaunaySite3& Site : Delaunay->Sites)
+			if (const TSharedPtr<PCGExMath::Geo::FIncrementalDelaunay3>& Triangulation = Processor->Triangulation)
 			{
-				PCGExMath::Geo::GetCentroid(Positions, Site.Vtx, Centroid);
-				for (const int32 PtIndex : Site.Vtx)
+				// Warm start: repair last iteration's tetrahedralization rather than rebuilding it
+				const bool bValid = Triangulation->Tets.IsEmpty() ? Triangulation->Build(View) : Triangulation->Update(View);
+				if (!bValid)
 				{
-					Counts[PtIndex] += 1;
-					Sum[PtIndex] += Centroid;
+					return;
+				}
+
+				Triangulation->AccumulateCentroids(View, Sum, Counts);
+			}
+			else
+			{
+				TUniquePtr<PCGExMath::Geo::TDelaunay3> Delaunay = MakeUnique<PCGExMath::Geo::TDelaunay3>();
+				if (!Delaunay->Process<false, false>(View))
+				{
+					return;
+				}
+
+				FVector Centroid;
+				for (const PCGExMath::Geo::FDelaunaySite3& Site : Delaunay->Sites)
+				{
+					PCGExMath::Geo::GetCentroid(Positions, Site.Vtx, Centroid);
+					for (const int32 PtIndex : Site.Vtx)
+					{
+						Counts[PtIndex] += 1;
+						Sum[PtIndex] += Centroid;
+					}
 				}
 			}
 
@@ -143,8 +158,6 @@ namespace PCGExLloydRelax
 				PCGEX_PARALLEL_FOR(NumPoints, Positions[i] = FMath::Lerp(Positions[i], Sum[i] / Counts[i], InfluenceSettings->GetInfluence(i));)
 			}
 
-			Delaunay.Reset();
-
 			if (NumIterations > 0)
 			{
 				PCGEX_LAUNCH_INTERNAL(FLloydRelaxTask, TaskIndex + 1, Processor, InfluenceSettings, NumIterations)
@@ -172,6 +185,8 @@ namespace PCGExLloydRelax
 
 		PCGExPointArrayDataHelpers::PointsToPositions(PointDataFacade->GetIn(), ActivePositions);
 
+		if (Settings->bIncrementalTriangulation && Settings->Iterations > 1) { Triangulation = MakeShared<PCGExMath::Geo::FIncrementalDelaunay3>(); }
+
 		PCGEX_SHARED_THIS_DECL
 		PCGEX_LAUNCH(FLloydRelaxTask, 0, ThisPtr, &InfluenceDetails, Settings->Iterations)
 
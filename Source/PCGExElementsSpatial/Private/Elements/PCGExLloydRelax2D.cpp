@@ -9,6 +9,7 @@
 #include "Math/PCGExBestFitPlane.h"
 #include "Math/Geo/PCGExDelaunay.h"
 #include "Math/Geo/PCGExGeo.h"
+#include "Math/Geo/PCGExIncrementalDelaunay.h"
 
 #define LOCTEXT_NAMESPACE "PCGExLloydRelax2DElement"
 #define PCGEX_NAMESPACE LloydRelax2D
@@ -111,15 +112,8 @@ namespace PCGExLloydRelax2D
 		{
 			NumIterations--;
 
-			TUniquePtr<PCGExMath::Geo::TDelaunay2> Delaunay = MakeUnique<PCGExMath::Geo::TDelaunay2>();
 			TArray<FVector>& Positions = Processor->ActivePositions;
-
 			const TArrayView<FVector> View = MakeArrayView(Positions);
-			// Only Sites are consumed below; skip the DelaunayEdges set and hull extraction.
-			if (!Delaunay->Process(View, Processor->ProjectionDetails, false, false))
-			{
-				return;
-			}
 
 			const int32 NumPoints = Positions.Num();
 
@@ -132,14 +126,39 @@ namespace PCGExLloydRelax2D
 				Counts[i] = 1;
 			}
 
-			FVector Centroid;
-			for (const PCGExMath::Geo::FDelaunaySite2& Site : Delaunay->Sites)
+			if (const TSharedPtr<PCGExMath::Geo::FIncrementalDelaunay2>& Triangulation = Processor->Triangulation)
 			{
-				PCGExMath::Geo::GetCentroid(Positions, Site.Vtx, Centroid);
-				for (const int32 PtIndex : Site.Vtx)
+				// Warm start: repair last iteration's triangulation rather than rebuilding it
+				const bool bValid = Triangulation->Triangles.IsEmpty() ?
+					                    Triangulation->Build(View, Processor->ProjectionDetails) :
+					                    Triangulation->Update(View, Processor->ProjectionDetails);
+
+				if (!bValid)
 				{
-					Counts[PtIndex] += 1;
-					Sum[PtIndex] += Centroid;
+					return;
+				}
+
+				Triangulation->AccumulateCentroids(View, Sum, Counts);
+			}
+			else
+			{
+				TUniquePtr<PCGExMath::Geo::TDelaunay2> Delaunay = MakeUnique<PCGExMath::Geo::TDelaunay2>();
+
+				// Only Sites are consumed below; skip edges and hull extraction.
+				if (!Delaunay->Process(View, Processor->ProjectionDetails, false, false))
+				{
+					return;
+				}
+
+				FVector Centroid;
+				for (const PCGExMath::Geo::FDelaunaySite2& Site : Delaunay->Sites)
+				{
+					PCGExMath::Geo::GetCentroid(Positions, Site.Vtx, Centroid);
+					for (const int32 PtIndex : Site.Vtx)
+					{
+						Counts[PtIndex] += 1;
+						Sum[PtIndex] += Centroid;
+					}
 				}
 			}
 
@@ -151,8 +170,6 @@ namespace PCGExLloydRelax2D
 					)
 			}
 
-			Delaunay.Reset();
-
 			if (NumIterations > 0)
 			{
 				PCGEX_LAUNCH_INTERNAL(FLloydRelaxTask, TaskIndex + 1, Processor, InfluenceSettings, NumIterations)
@@ -183,6 +200,8 @@ namespace PCGExLloydRelax2D
 
 		PCGExPointArrayDataHelpers::PointsToPositions(PointDataFacade->GetIn(), ActivePositions);
 
+		if (Settings->bIncrementalTriangulation && Settings->Iterations > 1) { Triangulation = MakeShared<PCGExMath::Geo::FIncrementalDelaunay2>(); }
+
 		PCGEX_SHARED_THIS_DECL
 		PCGEX_LAUNCH(FLloydRelaxTask, 0, ThisPtr, &InfluenceDetails, Settings->Iterations)
 
@@ -334,6 +334,88 @@ namespace PCGExBinPacking3D
 		static FVector RotateSize(const FVector& Size, const FRotator& Rotation);
 	};
 
+	/**
+	 * Uniform grid over a bin's volume, referencing placed items by the cells their padded box spans.
+	 * Queries visit each item at most once (in the first cell shared by the item and the query range),
+	 * and only report candidates: callers still run their exact box tests.
+	 */
+	class PCGEXELEMENTSSPATIAL_API FBP3DItemGrid
+	{
+	public:
+		/** Upper bound on cells per axis. */
+		static constexpr int32 MaxDim = 64;
+
+		void Init(const FBox& InBounds, double InCellSize);
+		void Add(int32 InItemIndex, const FBox& InBox);
+
+		/** Calls Callback(ItemIndex) for every item whose cells overlap the ones spanned by InQuery. */
+		template <typename Func>
+		void ForEachCandidate(const FBox& InQuery, Func&& Callback) const
+		{
+			const FIntVector Lo = ToCell(InQuery.Min);
+			const FIntVector Hi = ToCell(InQuery.Max);
+
+			for (int32 CZ = Lo.Z; CZ <= Hi.Z; CZ++)
+			{
+				for (int32 CY = Lo.Y; CY <= Hi.Y; CY++)
+				{
+					for (int32 CX = Lo.X; CX <= Hi.X; CX++)
+					{
+						for (const int32 ItemIndex : Cells[CX + CY * Dims.X + CZ * Dims.X * Dims.Y])
+						{
+							const FIntVector& First = FirstCell[ItemIndex];
+							if (FMath::Max(First.X, Lo.X) != CX || FMath::Max(First.Y, Lo.Y) != CY || FMath::Max(First.Z, Lo.Z) != CZ) { continue; }
+							Callback(ItemIndex);
+						}
+					}
+				}
+			}
+		}
+
+		/** Returns true as soon as Predicate(ItemIndex) does, for the same candidates ForEachCandidate would visit. */
+		template <typename Func>
+		bool AnyCandidate(const FBox& InQuery, Func&& Predicate) const
+		{
+			const FIntVector Lo = ToCell(InQuery.Min);
+			const FIntVector Hi = ToCell(InQuery.Max);
+
+			for (int32 CZ = Lo.Z; CZ <= Hi.Z; CZ++)
+			{
+				for (int32 CY = Lo.Y; CY <= Hi.Y; CY++)
+				{
+					for (int32 CX = Lo.X; CX <= Hi.X; CX++)
+					{
+						for (const int32 ItemIndex : Cells[CX + CY * Dims.X + CZ * Dims.X * Dims.Y])
+						{
+							const FIntVector& First = FirstCell[ItemIndex];
+							if (FMath::Max(First.X, Lo.X) != CX || FMath::Max(First.Y, Lo.Y) != CY || FMath::Max(First.Z, Lo.Z) != CZ) { continue; }
+							if (Predicate(ItemIndex)) { return true; }
+						}
+					}
+				}
+			}
+
+			return false;
+		}
+
+	protected:
+		FVector Origin = FVector::ZeroVector;
+		FVector InvCellSize = FVector::OneVector;
+		FIntVector Dims = FIntVector(1);
+
+		TArray<TArray<int32>> Cells;
+		TArray<FIntVector> FirstCell; // Lowest cell spanned by each item
+
+		FORCEINLINE FIntVector ToCell(const FVector& P) const
+		{
+			const FVector L = (P - Origin) * InvCellSize;
+			return FIntVector(
+				FMath::Clamp(FMath::FloorToInt32(L.X), 0, Dims.X - 1),
+				FMath::Clamp(FMath::FloorToInt32(L.Y), 0, Dims.Y - 1),
+				FMath::Clamp(FMath::FloorToInt32(L.Z), 0, Dims.Z - 1));
+		}
+	};
+
 	// Bin using Extreme Point placement (replaces guillotine-cut free-space approach)
 	class PCGEXELEMENTSSPATIAL_API FBP3DBin : public TSharedFromThis<FBP3DBin>
 	{
@@ -344,6 +426,7 @@ namespace PCGExBinPacking3D
 		FVector PackSign = FVector::OneVector;
 
 		TArray<FVector> ExtremePoints;
+		FBP3DItemGrid Grid;
 
 		void AddExtremePoint(const FVector& Point);
 		void GenerateExtremePoints(const FBox& PaddedItemBox);
@@ -366,7 +449,7 @@ namespace PCGExBinPacking3D
 		// Affinity: set of categories present in this bin
 		TSet<int32> PresentCategories;
 
-		FBP3DBin(int32 InBinIndex, const PCGExData::FConstPoint& InBinPoint, const FVector& InSeed);
+		FBP3DBin(int32 InBinIndex, const PCGExData::FConstPoint& InBinPoint, const FVector& InSeed, double InCellSize);
 		~FBP3DBin() = default;
 
 		double GetFillRatio() const
@@ -398,6 +481,13 @@ namespace PCGExBinPacking3D
 		double ComputeSupportRatio(const FBox& ItemBox) const;
 
 		void CommitPlacement(const FBP3DPlacementCandidate& Candidate, FBP3DItem& InItem);
+
+		/**
+		 * Drops extreme points no item with a padded extent of at least InMinExtent (on every axis) can ever use:
+		 * any box that large anchored there leaves the bin or overlaps a placed item. Items are never removed,
+		 * so such points stay unusable for the rest of the packing.
+		 */
+		void PruneExtremePoints(double InMinExtent);
 		void UpdatePoint(PCGExData::FMutablePoint& InPoint, const FBP3DItem& InItem) const;
 	};
 
@@ -424,6 +514,9 @@ namespace PCGExBinPacking3D
 		// Per-bin max weight
 		TArray<double> BinMaxWeights;
 
+		// Smallest padded extent among items from a given processing index onward, for extreme point pruning
+		TArray<double> RemainingMinExtent;
+
 		FBP3DPlacementCandidate FindBestPlacement(const FBP3DItem& InItem);
 		double ComputeFinalScore(const FBP3DPlacementCandidate& Candidate) const;
 
@@ -12,6 +12,11 @@
 
 #include "PCGExLloydRelax.generated.h"
 
+namespace PCGExMath::Geo
+{
+	class FIncrementalDelaunay3;
+}
+
 /**
  * 
  */
@@ -48,6 +53,10 @@ public:
 	/** Influence Settings*/
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExInfluenceDetails InfluenceDetails;
+
+	/** Keep the triangulation between iterations and repair it with local flips as points move, instead of rebuilding it every iteration. Falls back to a full rebuild whenever repair isn't possible. Results may differ slightly from a rebuild on co-circular or duplicate points. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, AdvancedDisplay)
+	bool bIncrementalTriangulation = false;
 };
 
 struct FPCGExLloydRelaxContext final : FPCGExPointsProcessorContext
@@ -75,6 +84,7 @@ namespace PCGExLloydRelax
 
 		FPCGExInfluenceDetails InfluenceDetails;
 		TArray<FVector> ActivePositions;
+		TSharedPtr<PCGExMath::Geo::FIncrementalDelaunay3> Triangulation;
 
 	public:
 		explicit FProcessor(const TSharedRef<PCGExData::FFacade>& InPointDataFacade)
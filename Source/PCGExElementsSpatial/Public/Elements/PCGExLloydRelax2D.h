@@ -10,6 +10,11 @@
 #include "Math/PCGExProjectionDetails.h"
 #include "PCGExLloydRelax2D.generated.h"
 
+namespace PCGExMath::Geo
+{
+	class FIncrementalDelaunay2;
+}
+
 /**
  * 
  */
@@ -47,6 +52,10 @@ public:
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExInfluenceDetails InfluenceDetails;
 
+	/** Keep the triangulation between iterations and repair it with local flips as points move, instead of rebuilding it every iteration. Falls back to a full rebuild whenever repair isn't possible. Results may differ slightly from a rebuild on co-circular or duplicate points. */
+	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, AdvancedDisplay)
+	bool bIncrementalTriangulation = false;
+
 	/** Projection settings. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_Overridable))
 	FPCGExGeo2DProjectionDetails ProjectionDetails;
@@ -77,6 +86,7 @@ namespace PCGExLloydRelax2D
 
 		FPCGExInfluenceDetails InfluenceDetails;
 		TArray<FVector> ActivePositions;
+		TSharedPtr<PCGExMath::Geo::FIncrementalDelaunay2> Triangulation;
 
 		FPCGExGeo2DProjectionDetails ProjectionDetails;
 
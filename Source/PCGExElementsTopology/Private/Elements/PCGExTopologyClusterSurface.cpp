@@ -6,6 +6,10 @@
 #include "Clusters/PCGExCluster.h"
 #include "Clusters/Artifacts/PCGExCellDetails.h"
 #include "Clusters/Artifacts/PCGExPlanarFaceEnumerator.h"
+#include "ConstrainedDelaunay2.h"
+#include "UDynamicMesh.h"
+#include "CompGeom/PolygonTriangulation.h"
+#include "Core/PCGExMTCommon.h"
 #include "Data/PCGExData.h"
 #include "GeometryScript/MeshPrimitiveFunctions.h"
 #include "GeometryScript/PolygonFunctions.h"
@@ -59,6 +63,77 @@ bool FPCGExTopologyClusterSurfaceElement::AdvanceWork(FPCGExContext* InContext,
 
 namespace PCGExTopologyClusterSurface
 {
+	static bool TriangulateCellPolygon(const TArray<FVector2D>& InPolygon, TArray<UE::Geometry::FIndex3i>& OutTriangles)
+	{
+		const int32 NumPoints = InPolygon.Num();
+		if (NumPoints < 3)
+		{
+			return false;
+		}
+
+		// Convex fast path, fan from the first vertex
+		int32 Sign = 0;
+		bool bIsConvex = true;
+		for (int32 i = 0; i < NumPoints && bIsConvex; i++)
+		{
+			const FVector2D& A = InPolygon[i];
+			const FVector2D& B = InPolygon[(i + 1) % NumPoints];
+			const FVector2D& C = InPolygon[(i + 2) % NumPoints];
+			const double Cross = FVector2D::CrossProduct(B - A, C - B);
+			if (FMath::IsNearlyZero(Cross))
+			{
+				continue;
+			}
+
+			const int32 CurrentSign = Cross > 0 ? 1 : -1;
+			if (Sign == 0)
+			{
+				Sign = CurrentSign;
+			}
+			else if (Sign != CurrentSign)
+			{
+				bIsConvex = false;
+			}
+		}
+
+		OutTriangles.Reset(NumPoints - 2);
+
+		if (bIsConvex)
+		{
+			for (int32 i = 1; i < NumPoints - 1; i++)
+			{
+				OutTriangles.Emplace(0, i, i + 1);
+			}
+		}
+		else
+		{
+			// Ear clipping, with a constrained Delaunay fallback for polygons it can't fully resolve
+			PolygonTriangulation::TriangulateSimplePolygon<double>(InPolygon, OutTriangles, false);
+
+			if (OutTriangles.Num() != NumPoints - 2)
+			{
+				UE::Geometry::FGeneralPolygon2d GeneralPolygon{UE::Geometry::FPolygon2d(InPolygon)};
+				OutTriangles = UE::Geometry::ConstrainedDelaunayTriangulate<double>(GeneralPolygon);
+				if (OutTriangles.IsEmpty())
+				{
+					return false;
+				}
+			}
+		}
+
+		// Consistent winding regardless of the cell's, so the surface faces up in projected space
+		for (UE::Geometry::FIndex3i& Triangle : OutTriangles)
+		{
+			const FVector2D& A = InPolygon[Triangle.A];
+			if (FVector2D::CrossProduct(InPolygon[Triangle.B] - A, InPolygon[Triangle.C] - A) < 0)
+			{
+				Swap(Triangle.B, Triangle.C);
+			}
+		}
+
+		return true;
+	}
+
 	bool FProcessor::Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExTopologyClusterSurface::Process);
@@ -81,12 +156,8 @@ namespace PCGExTopologyClusterSurface
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExTopologyClusterSurface::CompleteWork);
 
-		// Build polygons from enumerated cells
-		FGeometryScriptGeneralPolygonList ClusterPolygonList;
-		ClusterPolygonList.Reset();
-
-		TArray<FGeometryScriptSimplePolygon> Polygons;
-		Polygons.Reserve(ValidCells.Num() + 1);
+		TArray<const PCGExClusters::FCell*> Cells;
+		Cells.Reserve(ValidCells.Num() + 1);
 
 		for (const TSharedPtr<PCGExClusters::FCell>& Cell : ValidCells)
 		{
@@ -95,25 +166,49 @@ namespace PCGExTopologyClusterSurface
 				continue;
 			}
 
-			FGeometryScriptSimplePolygon& Polygon = Polygons.Emplace_GetRef();
-			Polygon.Reset(Cell->Polygon.Num());
-			Polygon.Vertices->Append(Cell->Polygon);
+			Cells.Add(Cell.Get());
 		}
 
 		// Handle wrapper cell as sole path if needed
-		if (Polygons.IsEmpty() && CellsConstraints->WrapperCell && Settings->Constraints.bKeepWrapperIfSolePath)
+		if (Cells.IsEmpty() && CellsConstraints->WrapperCell && Settings->Constraints.bKeepWrapperIfSolePath)
 		{
-			FGeometryScriptSimplePolygon& Polygon = Polygons.Emplace_GetRef();
-			Polygon.Reset(CellsConstraints->WrapperCell->Polygon.Num());
-			Polygon.Vertices->Append(CellsConstraints->WrapperCell->Polygon);
+			Cells.Add(CellsConstraints->WrapperCell.Get());
 		}
 
-		if (Polygons.IsEmpty())
+		if (Cells.IsEmpty())
 		{
 			bIsProcessorValid = false;
 			return;
 		}
 
+		const bool bTriangulationError = Settings->TriangulationMethod == EPCGExCellTriangulationMethod::Native ? !AppendNative(Cells) : !AppendGeometryScript(Cells);
+
+		if (bTriangulationError && !Settings->Topology.bQuietTriangulationError)
+		{
+			PCGE_LOG_C(Error, GraphAndLog, ExecutionContext, FTEXT("Triangulation error."));
+		}
+
+		ApplyPointData();
+	}
+
+	bool FProcessor::AppendGeometryScript(const TArray<const PCGExClusters::FCell*>& InCells)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExTopologyClusterSurface::AppendGeometryScript);
+
+		// Build polygons from enumerated cells
+		FGeometryScriptGeneralPolygonList ClusterPolygonList;
+		ClusterPolygonList.Reset();
+
+		TArray<FGeometryScriptSimplePolygon> Polygons;
+		Polygons.Reserve(InCells.Num());
+
+		for (const PCGExClusters::FCell* Cell : InCells)
+		{
+			FGeometryScriptSimplePolygon& Polygon = Polygons.Emplace_GetRef();
+			Polygon.Reset(Cell->Polygon.Num());
+			Polygon.Vertices->Append(Cell->Polygon);
+		}
+
 		UGeometryScriptLibrary_PolygonListFunctions::AppendPolygonList(
 			ClusterPolygonList,
 			UGeometryScriptLibrary_PolygonListFunctions::CreatePolygonListFromSimplePolygons(Polygons));
@@ -128,12 +223,124 @@ namespace PCGExTopologyClusterSurface
 			Settings->Topology.TriangulationOptions,
 			bTriangulationError);
 
-		if (bTriangulationError && !Settings->Topology.bQuietTriangulationError)
+		return !bTriangulationError;
+	}
+
+	bool FProcessor::AppendNative(const TArray<const PCGExClusters::FCell*>& InCells)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExTopologyClusterSurface::AppendNative);
+
+		const int32 NumCells = InCells.Num();
+
+		// Triangles are indices into their cell's polygon
+		TArray<TArray<UE::Geometry::FIndex3i>> CellTriangles;
+		CellTriangles.SetNum(NumCells);
+
+		std::atomic<bool> bFailed{false};
+
+		PCGExMT::ParallelOrSequential(NumCells, [&](const int32 i)
 		{
-			PCGE_LOG_C(Error, GraphAndLog, ExecutionContext, FTEXT("Triangulation error."));
+			if (!TriangulateCellPolygon(InCells[i]->Polygon, CellTriangles[i]))
+			{
+				bFailed.store(true, std::memory_order_relaxed);
+			}
+		}, 64);
+
+		// Mesh vertex of each polygon vertex, laid out cell after cell.
+		// When welding, cells resolve their cluster nodes to a shared vertex instead.
+		TArray<int32> CellOffsets;
+		CellOffsets.SetNumUninitialized(NumCells);
+
+		int32 NumPolygonVertices = 0;
+		for (int32 i = 0; i < NumCells; i++)
+		{
+			CellOffsets[i] = NumPolygonVertices;
+			NumPolygonVertices += InCells[i]->Polygon.Num();
 		}
 
-		ApplyPointData();
+		TArray<int32> PolygonToVertex;
+		PolygonToVertex.SetNumUninitialized(NumPolygonVertices);
+
+		TArray<FVector2D> Positions;
+		Positions.Reserve(NumPolygonVertices);
+
+		if (Settings->bWeldByNode)
+		{
+			TArray<int32> NodeToVertex;
+			NodeToVertex.Init(-1, Cluster->Nodes->Num());
+
+			for (int32 i = 0; i < NumCells; i++)
+			{
+				const PCGExClusters::FCell* Cell = InCells[i];
+				const int32 Offset = CellOffsets[i];
+
+				for (int32 j = 0; j < Cell->Polygon.Num(); j++)
+				{
+					int32& Vertex = NodeToVertex[Cell->Nodes[j]];
+					if (Vertex == -1)
+					{
+						Vertex = Positions.Add(Cell->Polygon[j]);
+					}
+					PolygonToVertex[Offset + j] = Vertex;
+				}
+			}
+		}
+		else
+		{
+			for (int32 i = 0; i < NumCells; i++)
+			{
+				for (const FVector2D& Point : InCells[i]->Polygon)
+				{
+					PolygonToVertex[Positions.Num()] = Positions.Num();
+					Positions.Add(Point);
+				}
+			}
+		}
+
+		// Mirror what Geometry Script does with the primitive options: one polygroup per cell unless a single group
+		// is requested, and winding reversed on flip. UV mode and triangulation options have no native counterpart.
+		const bool bFlip = Settings->Topology.PrimitiveOptions.bFlipOrientation;
+		const bool bGroupPerCell = Settings->Topology.PrimitiveOptions.PolygroupMode != EGeometryScriptPrimitivePolygroupMode::SingleGroup;
+
+		InternalMesh->EditMesh([&](FDynamicMesh3& InMesh)
+		{
+			const int32 BaseVertex = InMesh.MaxVertexID();
+
+			if (bGroupPerCell) { InMesh.EnableTriangleGroups(); }
+			for (const FVector2D& Point : Positions)
+			{
+				InMesh.AppendVertex(FVector3d(Point.X, Point.Y, 0));
+			}
+
+			for (int32 i = 0; i < NumCells; i++)
+			{
+				const int32* Map = PolygonToVertex.GetData() + CellOffsets[i];
+				const int32 GroupID = bGroupPerCell ? InMesh.AllocateTriangleGroup() : 0;
+
+				for (const UE::Geometry::FIndex3i& Triangle : CellTriangles[i])
+				{
+					UE::Geometry::FIndex3i Tri(BaseVertex + Map[Triangle.A], BaseVertex + Map[Triangle.B], BaseVertex + Map[Triangle.C]);
+					if (bFlip) { Swap(Tri.B, Tri.C); }
+
+					// Collapsed by welding, i.e duplicated leaf points
+					if (Tri.A == Tri.B || Tri.B == Tri.C || Tri.C == Tri.A)
+					{
+						continue;
+					}
+
+					if (InMesh.AppendTriangle(Tri, GroupID) == FDynamicMesh3::NonManifoldID)
+					{
+						// Split off the offending triangle, point data is matched by position anyway
+						InMesh.AppendTriangle(UE::Geometry::FIndex3i(
+							InMesh.AppendVertex(InMesh.GetVertex(Tri.A)),
+							InMesh.AppendVertex(InMesh.GetVertex(Tri.B)),
+							InMesh.AppendVertex(InMesh.GetVertex(Tri.C))), GroupID);
+					}
+				}
+			}
+		}, EDynamicMeshChangeType::GeneralEdit, EDynamicMeshAttributeChangeFlags::Unknown, true);
+
+		return !bFailed.load();
 	}
 
 	FBatch::FBatch(FPCGExContext* InContext, const TSharedRef<PCGExData::FPointIO>& InVtx, TArrayView<TSharedRef<PCGExData::FPointIO>> InEdges)
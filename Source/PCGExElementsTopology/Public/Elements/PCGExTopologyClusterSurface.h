@@ -26,6 +26,16 @@ protected:
 	virtual FPCGElementPtr CreateElement() const override;
 	//~End UPCGSettings
 
+public:
+	/** How cells are turned into triangles. */
+	UPROPERTY(EditAnywhere, Category = Settings, meta = (PCG_NotOverridable))
+	EPCGExCellTriangulationMethod TriangulationMethod = EPCGExCellTriangulationMethod::GeometryScript;
+
+	/** Cells sharing a cluster node share a single mesh vertex, instead of each cell getting its own copy.
+	 * Cheaper than welding edges afterward, and exact since it doesn't rely on positions. */
+	UPROPERTY(EditAnywhere, Category = Settings, meta = (PCG_Overridable, EditCondition="TriangulationMethod == EPCGExCellTriangulationMethod::Native", EditConditionHides))
+	bool bWeldByNode = true;
+
 private:
 	friend class FPCGExTopologyClustersProcessorElement;
 };
@@ -72,6 +82,10 @@ namespace PCGExTopologyClusterSurface
 
 		virtual bool Process(const TSharedPtr<PCGExMT::FTaskManager>& InTaskManager) override;
 		virtual void CompleteWork() override;
+
+	protected:
+		bool AppendGeometryScript(const TArray<const PCGExClusters::FCell*>& InCells);
+		bool AppendNative(const TArray<const PCGExClusters::FCell*>& InCells);
 	};
 
 	class FBatch final : public PCGExTopologyEdges::TBatch<FProcessor>
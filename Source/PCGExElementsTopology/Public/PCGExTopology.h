@@ -49,6 +49,13 @@ enum class EPCGExTopologyOutputType : uint8
 	Merged  = 0 UMETA(DisplayName = "Merged Geometry", Tooltip="Output a single geometry that merges all generated topologies"),
 };
 
+UENUM()
+enum class EPCGExCellTriangulationMethod : uint8
+{
+	GeometryScript = 0 UMETA(DisplayName = "Geometry Script", Tooltip="Build a polygon list and let Geometry Script triangulate and append it."),
+	Native         = 1 UMETA(DisplayName = "Native", Tooltip="Triangulate cells in parallel and write them straight into the mesh. Only honors orientation flip and polygroup mode from the primitive options."),
+};
+
 namespace PCGExTopology
 {
 	const FName MeshOutputLabel = TEXT("Mesh");
@@ -124,12 +131,14 @@ struct PCGEXELEMENTSTOPOLOGY_API FPCGExTopologyDetails
 	FPCGExTopologyUVDetails UVChannels;
 
 	/** Default primitive options
-	 * Note that those are applied when triangulation is appended to the dynamic mesh. */
+	 * Note that those are applied when triangulation is appended to the dynamic mesh.
+	 * Native cell triangulation only honors orientation flip and polygroup mode. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_NotOverridable))
 	FGeometryScriptPrimitiveOptions PrimitiveOptions;
 
 	/** Triangulation options
-	 * Note that those are applied when triangulation is appended to the dynamic mesh. */
+	 * Note that those are applied when triangulation is appended to the dynamic mesh.
+	 * Geometry Script only, ignored by native cell triangulation. */
 	UPROPERTY(BlueprintReadWrite, EditAnywhere, Category = Settings, meta = (PCG_NotOverridable))
 	FGeometryScriptPolygonsTriangulationOptions TriangulationOptions;
 
@@ -0,0 +1,135 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#include "Core/PCGExValueKeyMemo.h"
+
+#include "Data/PCGBasePointData.h"
+#include "Data/PCGExAttributeBroadcaster.h"
+#include "Helpers/PCGExMetaHelpers.h"
+#include "Metadata/PCGMetadataAttribute.h"
+
+namespace PCGExPointFilter
+{
+	bool FValueKeyMemo::Init(const UPCGBasePointData* InData, const FPCGMetadataAttributeBase* InAttribute, TFunctionRef<bool(int32)> Predicate)
+	{
+		return Group(InData, InAttribute) && Resolve(Predicate);
+	}
+
+	bool FValueKeyMemo::Group(const UPCGBasePointData* InData, const FPCGMetadataAttributeBase* InAttribute)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPointFilter::FValueKeyMemo::Group);
+
+		Results.Reset();
+		Representatives.Reset();
+		PointSlots.Reset();
+
+		if (!InData || !InAttribute)
+		{
+			return false;
+		}
+
+		const int32 NumPoints = InData->GetNumPoints();
+		if (NumPoints < MinPoints)
+		{
+			return false;
+		}
+
+		const TConstPCGValueRange<int64> Entries = InData->GetConstMetadataEntryValueRange();
+
+		TArray<PCGMetadataEntryKey> EntryKeys;
+		EntryKeys.SetNumUninitialized(NumPoints);
+		for (int32 i = 0; i < NumPoints; i++) { EntryKeys[i] = Entries[i]; }
+
+		TArray<PCGMetadataValueKey> ValueKeys;
+		InAttribute->GetValueKeys(TConstArrayView<PCGMetadataEntryKey>(EntryKeys), ValueKeys);
+		if (ValueKeys.Num() != NumPoints)
+		{
+			return false;
+		}
+
+		// Cardinality check first, so a high-cardinality attribute costs a map walk and no predicate call
+		const int32 MaxDistinct = NumPoints / MinReuse;
+
+		TMap<PCGMetadataValueKey, int32> Slots;
+		PointSlots.SetNumUninitialized(NumPoints);
+
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			if (const int32* Slot = Slots.Find(ValueKeys[i]))
+			{
+				PointSlots[i] = *Slot;
+				continue;
+			}
+
+			if (Representatives.Num() >= MaxDistinct)
+			{
+				Representatives.Empty();
+				PointSlots.Empty();
+				return false;
+			}
+
+			PointSlots[i] = Slots.Add(ValueKeys[i], Representatives.Add(i));
+		}
+
+		return true;
+	}
+
+	bool FValueKeyMemo::Resolve(TFunctionRef<bool(int32)> Predicate)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExPointFilter::FValueKeyMemo::Resolve);
+
+		if (PointSlots.IsEmpty())
+		{
+			return false;
+		}
+
+		const int32 NumPoints = PointSlots.Num();
+
+		TBitArray<> SlotResults(false, Representatives.Num());
+		for (int32 i = 0; i < Representatives.Num(); i++) { SlotResults[i] = Predicate(Representatives[i]); }
+
+		Results.Init(false, NumPoints);
+		for (int32 i = 0; i < NumPoints; i++) { Results[i] = SlotResults[PointSlots[i]]; }
+
+		Representatives.Empty();
+		PointSlots.Empty();
+
+		return true;
+	}
+
+	const FPCGMetadataAttributeBase* GetMemoizableAttribute(const PCGExData::IAttributeBroadcaster& InBroadcaster)
+	{
+		const PCGExData::IAttributeBroadcaster::FAttributeProcessingInfos& Infos = InBroadcaster.ProcessingInfos;
+
+		if (!Infos.bIsValid || Infos.bIsDataDomain || !Infos.Attribute ||
+			Infos.Selector.GetSelection() != EPCGAttributePropertySelection::Attribute ||
+			Infos.SubSelection.HasSelection())
+		{
+			return nullptr;
+		}
+
+		return Infos.Attribute;
+	}
+
+	const FPCGMetadataAttributeBase* GetMemoizableAttribute(const UPCGData* InData, const FPCGAttributePropertyInputSelector& InSelector)
+	{
+		if (!InData)
+		{
+			return nullptr;
+		}
+
+		const FPCGAttributePropertyInputSelector Selector = InSelector.CopyAndFixLast(InData);
+		if (Selector.GetSelection() != EPCGAttributePropertySelection::Attribute || !Selector.GetExtraNames().IsEmpty())
+		{
+			return nullptr;
+		}
+
+		const FPCGAttributeIdentifier Identifier = PCGExMetaHelpers::GetAttributeIdentifier(Selector, InData);
+		if (Identifier.MetadataDomain.Flag == EPCGMetadataDomainFlag::Data)
+		{
+			return nullptr;
+		}
+
+		return PCGExMetaHelpers::TryGetConstAttribute(InData, Identifier);
+	}
+}
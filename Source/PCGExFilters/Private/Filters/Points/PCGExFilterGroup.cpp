@@ -8,6 +8,7 @@
 #include "Clusters/PCGExCluster.h"
 #include "Containers/PCGExManagedObjects.h"
 #include "Core/PCGExFilterTypeSets.h"
+#include "Helpers/PCGExArrayHelpers.h"
 
 namespace PCGExFilterGroup
 {
@@ -176,6 +177,11 @@ namespace PCGExFilterGroup
 			Stack.Add(Filter.Get());
 		}
 
+		// Nothing to reorder with a single filter
+		OrderedStack = Stack;
+		if (Stack.Num() > 1) { Samples = MakeUnique<FSample[]>(Stack.Num()); }
+		else { bOrdered.store(true, std::memory_order_release); }
+
 		return true;
 	}
 
@@ -184,45 +190,86 @@ namespace PCGExFilterGroup
 		InFilter->PostInit();
 	}
 
-	bool FFilterGroupAND::Test(const int32 Index) const
+	template <bool bStopOn, typename T>
+	bool FFilterGroup::ShortCircuits(const T& Item) const
 	{
-		for (const PCGExPointFilter::IFilter* Filter : Stack)
+		if (!bOrdered.load(std::memory_order_acquire)
+			&& NumSampleClaims.load(std::memory_order_relaxed) < SampleSize
+			&& NumSampleClaims.fetch_add(1, std::memory_order_relaxed) < SampleSize)
 		{
-			if (!Filter->Test(Index))
-			{
-				return bInvert;
-			}
+			return SampleShortCircuits<bStopOn>(Item);
 		}
-		return !bInvert;
+
+		for (const PCGExPointFilter::IFilter* Filter : GetOrderedStack())
+		{
+			if (Filter->Test(Item) == bStopOn) { return true; }
+		}
+
+		return false;
 	}
 
-	bool FFilterGroupAND::Test(const PCGExClusters::FNode& Node) const
+	template <bool bStopOn, typename T>
+	bool FFilterGroup::SampleShortCircuits(const T& Item) const
 	{
-		for (const PCGExPointFilter::IFilter* Filter : Stack)
+		// Every filter runs so pass rates aren't skewed by whichever filter happens to come first
+		bool bShortCircuits = false;
+		for (int32 i = 0; i < Stack.Num(); i++)
 		{
-			if (!Filter->Test(Node))
-			{
-				return bInvert;
-			}
+			const uint64 Start = FPlatformTime::Cycles64();
+			const bool bPass = Stack[i]->Test(Item);
+			Samples[i].Cycles.fetch_add(FPlatformTime::Cycles64() - Start, std::memory_order_relaxed);
+			if (bPass) { Samples[i].Passes.fetch_add(1, std::memory_order_relaxed); }
+			bShortCircuits |= bPass == bStopOn;
 		}
-		return !bInvert;
+
+		if (NumSamplesDone.fetch_add(1, std::memory_order_acq_rel) + 1 == SampleSize) { SortStack<bStopOn>(); }
+
+		return bShortCircuits;
 	}
 
-	bool FFilterGroupAND::Test(const PCGExGraphs::FEdge& Edge) const
+	template <bool bStopOn>
+	void FFilterGroup::SortStack() const
 	{
-		for (const PCGExPointFilter::IFilter* Filter : Stack)
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExFilterGroup::FFilterGroup::SortStack);
+
+		// Expected cost of a filter's position is its cost over the odds it ends the evaluation:
+		// cost / (1 - pass rate) for AND, cost / pass rate for OR. Filters that never short-circuit sink to the end.
+		TArray<double> Scores;
+		Scores.SetNumUninitialized(Stack.Num());
+		for (int32 i = 0; i < Stack.Num(); i++)
 		{
-			if (!Filter->Test(Edge))
-			{
-				return bInvert;
-			}
+			const double PassRate = static_cast<double>(Samples[i].Passes.load(std::memory_order_relaxed)) / SampleSize;
+			const double StopRate = bStopOn ? PassRate : 1 - PassRate;
+			const double Cost = static_cast<double>(FMath::Max<uint64>(1, Samples[i].Cycles.load(std::memory_order_relaxed)));
+			Scores[i] = StopRate > 0 ? Cost / StopRate : TNumericLimits<double>::Max();
 		}
-		return !bInvert;
+
+		TArray<int32> Order;
+		PCGExArrayHelpers::ArrayOfIndices(Order, Stack.Num());
+		Order.StableSort([&](const int32 A, const int32 B) { return Scores[A] < Scores[B]; });
+
+		for (int32 i = 0; i < Order.Num(); i++) { OrderedStack[i] = Stack[Order[i]]; }
+		bOrdered.store(true, std::memory_order_release);
+	}
+
+	bool FFilterGroupAND::Test(const int32 Index) const
+	{
+		return ShortCircuits<false>(Index) ? bInvert : !bInvert;
+	}
+
+	bool FFilterGroupAND::Test(const PCGExClusters::FNode& Node) const
+	{
+		return ShortCircuits<false>(Node) ? bInvert : !bInvert;
+	}
+
+	bool FFilterGroupAND::Test(const PCGExGraphs::FEdge& Edge) const
+	{
+		return ShortCircuits<false>(Edge) ? bInvert : !bInvert;
 	}
 
 	bool FFilterGroupAND::Test(const PCGExData::FProxyPoint& Point) const
 	{
-		for (const PCGExPointFilter::IFilter* Filter : Stack)
+		for (const PCGExPointFilter::IFilter* Filter : GetOrderedStack())
 		{
 			if (!Filter->Test(Point))
 			{
@@ -246,43 +293,22 @@ namespace PCGExFilterGroup
 
 	bool FFilterGroupOR::Test(const int32 Index) const
 	{
-		for (const PCGExPointFilter::IFilter* Filter : Stack)
-		{
-			if (Filter->Test(Index))
-			{
-				return !bInvert;
-			}
-		}
-		return bInvert;
+		return ShortCircuits<true>(Index) ? !bInvert : bInvert;
 	}
 
 	bool FFilterGroupOR::Test(const PCGExClusters::FNode& Node) const
 	{
-		for (const PCGExPointFilter::IFilter* Filter : Stack)
-		{
-			if (Filter->Test(Node))
-			{
-				return !bInvert;
-			}
-		}
-		return bInvert;
+		return ShortCircuits<true>(Node) ? !bInvert : bInvert;
 	}
 
 	bool FFilterGroupOR::Test(const PCGExGraphs::FEdge& Edge) const
 	{
-		for (const PCGExPointFilter::IFilter* Filter : Stack)
-		{
-			if (Filter->Test(Edge))
-			{
-				return !bInvert;
-			}
-		}
-		return bInvert;
+		return ShortCircuits<true>(Edge) ? !bInvert : bInvert;
 	}
 
 	bool FFilterGroupOR::Test(const PCGExData::FProxyPoint& Point) const
 	{
-		for (const PCGExPointFilter::IFilter* Filter : Stack)
+		for (const PCGExPointFilter::IFilter* Filter : GetOrderedStack())
 		{
 			if (Filter->Test(Point))
 			{
@@ -50,17 +50,30 @@ bool PCGExPointFilter::FGameplayTagsFilter::Init(FPCGExContext* InContext, const
 		PathSegments.Add(PropertyPath.GetSegment(i).Name.ToString());
 	}
 
-	ActorReferences = PointDataFacade->GetBroadcaster<FSoftObjectPath>(TypedFilterFactory->Config.ActorReference, true);
+	// Points usually share a handful of actors: resolve each one and query its tags once.
+	// Memoized results are computed right away, so the reader can't be scoped in that case.
+	FPCGAttributePropertyInputSelector ActorSelector;
+	ActorSelector.Update(TypedFilterFactory->Config.ActorReference.ToString());
+	const bool bMemoize = Memo.Group(PointDataFacade->GetIn(), GetMemoizableAttribute(PointDataFacade->GetIn(), ActorSelector));
+
+	ActorReferences = PointDataFacade->GetBroadcaster<FSoftObjectPath>(TypedFilterFactory->Config.ActorReference, !bMemoize);
 	if (!ActorReferences)
 	{
 		PCGEX_LOG_INVALID_ATTR_HANDLED_C(InContext, Actor Reference, TypedFilterFactory->Config.ActorReference)
 		return false;
 	}
 
+	if (bMemoize) { Memo.Resolve([&](const int32 Index) { return TestPoint(Index); }); }
+
 	return true;
 }
 
 bool PCGExPointFilter::FGameplayTagsFilter::Test(const int32 PointIndex) const
+{
+	return Memo.IsValid() ? Memo.Get(PointIndex) : TestPoint(PointIndex);
+}
+
+bool PCGExPointFilter::FGameplayTagsFilter::TestPoint(const int32 PointIndex) const
 {
 	AActor* TargetActor = TSoftObjectPtr<AActor>(ActorReferences->Read(PointIndex)).Get();
 	if (!TargetActor)
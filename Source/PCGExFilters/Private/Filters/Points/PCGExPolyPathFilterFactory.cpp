@@ -201,6 +201,8 @@ PCGExFactories::EPreparationResult UPCGExPolyPathFilterFactory::Prepare(FPCGExCo
 			{
 				Path->BuildEdgeOctree();
 			}
+			// Inclusion tests hit every path many times over; projection is final at this point
+			Path->BuildQueryGrid();
 			TempPolyPaths[Index] = Path;
 			TSharedPtr<PCGExData::FTags> Tags = MakeShared<PCGExData::FTags>(TempTargets[Index].Tags);
 			TempTaggedData[Index] = FPCGExTaggedData(Data, Index, Tags, nullptr);
@@ -69,6 +69,7 @@ bool PCGExPointFilter::FStringCompareFilter::Init(FPCGExContext* InContext, cons
 		else
 		{
 			OperandBConstantName = FName(TypedFilterFactory->Config.OperandBConstant);
+			Memo.Init(PointDataFacade->GetIn(), GetMemoizableAttribute(*OperandAName), [&](const int32 Index) { return TestPoint(Index); });
 		}
 
 		return true;
@@ -90,11 +91,21 @@ bool PCGExPointFilter::FStringCompareFilter::Init(FPCGExContext* InContext, cons
 			return false;
 		}
 	}
+	else
+	{
+		// Few distinct strings: compare once per value rather than once per point
+		Memo.Init(PointDataFacade->GetIn(), GetMemoizableAttribute(*OperandA), [&](const int32 Index) { return TestPoint(Index); });
+	}
 
 	return true;
 }
 
 bool PCGExPointFilter::FStringCompareFilter::Test(const int32 PointIndex) const
+{
+	return Memo.IsValid() ? Memo.Get(PointIndex) : TestPoint(PointIndex);
+}
+
+bool PCGExPointFilter::FStringCompareFilter::TestPoint(const int32 PointIndex) const
 {
 	const PCGExData::FConstPoint Point = PointDataFacade->Source->GetInPoint(PointIndex);
 
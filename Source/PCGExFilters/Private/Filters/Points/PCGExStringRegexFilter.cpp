@@ -54,10 +54,18 @@ bool PCGExPointFilter::FStringRegexFilter::Init(FPCGExContext* InContext, const
 		return false;
 	}
 
+	// Few distinct strings: run the regex once per value rather than once per point
+	Memo.Init(PointDataFacade->GetIn(), GetMemoizableAttribute(*OperandA), [&](const int32 Index) { return TestPoint(Index); });
+
 	return true;
 }
 
 bool PCGExPointFilter::FStringRegexFilter::Test(const int32 PointIndex) const
+{
+	return Memo.IsValid() ? Memo.Get(PointIndex) : TestPoint(PointIndex);
+}
+
+bool PCGExPointFilter::FStringRegexFilter::TestPoint(const int32 PointIndex) const
 {
 	const PCGExData::FConstPoint Point = PointDataFacade->Source->GetInPoint(PointIndex);
 	const FString A = OperandA->FetchSingle(Point, TEXT(""));
@@ -177,7 +177,13 @@ bool PCGExPointFilter::FValueHashFilter::Init(FPCGExContext* InContext, const TS
 	bAnyPass = TypedFilterFactory->Config.Mode == EPCGExValueHashMode::Individual ? TypedFilterFactory->Config.Inclusion == EPCGExValueHashSetInclusionMode::Any : true;
 
 	FPCGAttributeIdentifier Identifier = PCGExMetaHelpers::GetAttributeIdentifier(TypedFilterFactory->Config.OperandA, PointDataFacade->GetIn());
-	OperandA = InPointDataFacade->GetDefaultReadable(Identifier, PCGExData::EIOSide::In, true);
+
+	// Few distinct values: hash and look up the sets once per value rather than once per point.
+	// Memoized results are computed right away, so the reader can't be scoped in that case.
+	const bool bMemoize = Identifier.MetadataDomain.Flag != EPCGMetadataDomainFlag::Data &&
+		Memo.Group(PointDataFacade->GetIn(), PCGExMetaHelpers::TryGetConstAttribute(PointDataFacade->GetIn(), Identifier));
+
+	OperandA = InPointDataFacade->GetDefaultReadable(Identifier, PCGExData::EIOSide::In, !bMemoize);
 
 	if (!OperandA)
 	{
@@ -185,10 +191,17 @@ bool PCGExPointFilter::FValueHashFilter::Init(FPCGExContext* InContext, const TS
 		return false;
 	}
 
+	if (bMemoize) { Memo.Resolve([&](const int32 Index) { return TestPoint(Index); }); }
+
 	return true;
 }
 
 bool PCGExPointFilter::FValueHashFilter::Test(const int32 PointIndex) const
+{
+	return Memo.IsValid() ? Memo.Get(PointIndex) : TestPoint(PointIndex);
+}
+
+bool PCGExPointFilter::FValueHashFilter::TestPoint(const int32 PointIndex) const
 {
 	const PCGExValueHash H = OperandA->ReadValueHash(PointIndex);
 	bool bPass = false;
@@ -0,0 +1,59 @@
+// Copyright 2026 Timothé Lapetite and contributors
+// Released under the MIT license https://opensource.org/license/MIT/
+
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Metadata/PCGAttributePropertySelector.h"
+
+class UPCGData;
+class UPCGBasePointData;
+class FPCGMetadataAttributeBase;
+
+namespace PCGExData
+{
+	class IAttributeBroadcaster;
+}
+
+namespace PCGExPointFilter
+{
+	/**
+	 * Per-point results of a predicate that only depends on the value of a single element attribute.
+	 * Points are grouped by metadata value key, the predicate runs once per distinct key on the first point
+	 * holding it, and tests become a bit lookup. Only worth it when there are few distinct values compared
+	 * to the number of points -- Init bails out otherwise, and the filter should keep testing as usual.
+	 *
+	 * Resolve evaluates the predicate straight away, outside of any Fetch: readers it relies on must not be scoped.
+	 * Filters reading through facade buffers call Group first, and only request a scoped reader when it fails.
+	 */
+	class PCGEXFILTERS_API FValueKeyMemo
+	{
+	public:
+		static constexpr int32 MinPoints = 256;
+		static constexpr int32 MinReuse = 8; // Minimum average number of points per distinct value
+
+		FValueKeyMemo() = default;
+
+		bool Init(const UPCGBasePointData* InData, const FPCGMetadataAttributeBase* InAttribute, TFunctionRef<bool(int32)> Predicate);
+
+		/** Group points by value key. False if the attribute has too many distinct values to be worth it. */
+		bool Group(const UPCGBasePointData* InData, const FPCGMetadataAttributeBase* InAttribute);
+
+		/** Run the predicate once per group found by Group, and store the per-point results. */
+		bool Resolve(TFunctionRef<bool(int32)> Predicate);
+
+		FORCEINLINE bool IsValid() const { return !Results.IsEmpty(); }
+		FORCEINLINE bool Get(const int32 PointIndex) const { return Results[PointIndex]; }
+
+	protected:
+		TBitArray<> Results;
+		TArray<int32> Representatives; // Slot -> first point holding that value key
+		TArray<int32> PointSlots;
+	};
+
+	/** Element attribute a broadcaster reads as-is (no property, no sub-selection), null otherwise. */
+	PCGEXFILTERS_API const FPCGMetadataAttributeBase* GetMemoizableAttribute(const PCGExData::IAttributeBroadcaster& InBroadcaster);
+
+	/** Element attribute a selector points to as-is (no property, no sub-selection), null otherwise. */
+	PCGEXFILTERS_API const FPCGMetadataAttributeBase* GetMemoizableAttribute(const UPCGData* InData, const FPCGAttributePropertyInputSelector& InSelector);
+}
@@ -73,6 +73,10 @@ namespace PCGExFilterGroup
 	 * Subclasses (FFilterGroupAND / FFilterGroupOR) implement the Test() logic:
 	 * - AND: short-circuits on first failure, returns !bInvert
 	 * - OR:  short-circuits on first success, returns !bInvert
+	 *
+	 * Index, node and edge tests are evaluated in adaptive order: the first SampleSize tests run the whole stack,
+	 * timing each filter and counting its passes, after which the stack is reordered so the filters most likely to
+	 * short-circuit per unit of cost run first. Filters are side-effect free, so only the cost changes, never the result.
 	 */
 	class PCGEXFILTERS_API FFilterGroup : public PCGExClusterFilter::IFilter
 	{
@@ -107,11 +111,42 @@ namespace PCGExFilterGroup
 
 		virtual void SetSupportedTypes(const TSet<FPCGDataTypeBaseId>* InTypes) override;
 
+		/** Number of fully-evaluated tests used to measure the stack before it gets reordered. */
+		static constexpr int32 SampleSize = 128;
+
 	protected:
 		const TSet<FPCGDataTypeBaseId>* SupportedFactoriesTypes = nullptr;
 		TArray<TSharedPtr<PCGExPointFilter::IFilter>> ManagedFilters;
 		TArray<const PCGExPointFilter::IFilter*> Stack;
 
+		struct FSample
+		{
+			std::atomic<uint64> Cycles{0};
+			std::atomic<int32> Passes{0};
+		};
+
+		// Written once by whichever thread completes the last sample, then published through bOrdered
+		mutable TArray<const PCGExPointFilter::IFilter*> OrderedStack;
+		mutable std::atomic<bool> bOrdered{false};
+		mutable std::atomic<int32> NumSampleClaims{0};
+		mutable std::atomic<int32> NumSamplesDone{0};
+		TUniquePtr<FSample[]> Samples;
+
+		FORCEINLINE const TArray<const PCGExPointFilter::IFilter*>& GetOrderedStack() const
+		{
+			return bOrdered.load(std::memory_order_acquire) ? OrderedStack : Stack;
+		}
+
+		/** Whether any filter returned bStopOn, checking the stack in its current evaluation order. Feeds the sampler until the order is settled. */
+		template <bool bStopOn, typename T>
+		bool ShortCircuits(const T& Item) const;
+
+		template <bool bStopOn, typename T>
+		bool SampleShortCircuits(const T& Item) const;
+
+		template <bool bStopOn>
+		void SortStack() const;
+
 		virtual bool InitManaged(FPCGExContext* InContext);
 		bool InitManagedFilter(FPCGExContext* InContext, const TSharedPtr<PCGExPointFilter::IFilter>& Filter, const bool bQuiet = false) const;
 		virtual bool PostInitManaged(FPCGExContext* InContext);
@@ -10,6 +10,7 @@
 #include "UObject/Object.h"
 
 #include "Core/PCGExPointFilter.h"
+#include "Core/PCGExValueKeyMemo.h"
 
 #include "PropertyPathHelpers.h"
 
@@ -93,6 +94,7 @@ namespace PCGExPointFilter
 		TArray<FString> PathSegments;
 
 		TSharedPtr<PCGExData::TBuffer<FSoftObjectPath>> ActorReferences;
+		FValueKeyMemo Memo;
 
 		virtual bool Init(FPCGExContext* InContext, const TSharedPtr<PCGExData::FFacade>& InPointDataFacade) override;
 		virtual bool Test(const int32 PointIndex) const override;
@@ -100,6 +102,9 @@ namespace PCGExPointFilter
 		virtual ~FGameplayTagsFilter() override
 		{
 		}
+
+	protected:
+		bool TestPoint(const int32 PointIndex) const;
 	};
 }
 
@@ -9,6 +9,7 @@
 #include "Utils/PCGExCompare.h"
 
 #include "Core/PCGExPointFilter.h"
+#include "Core/PCGExValueKeyMemo.h"
 
 
 #include "PCGExStringCompareFilter.generated.h"
@@ -98,6 +99,9 @@ namespace PCGExPointFilter
 		TSharedPtr<PCGExData::TAttributeBroadcaster<FName>> OperandBName;
 		FName OperandBConstantName = NAME_None;
 
+		// Only used when comparing against a constant, the result then only depends on operand A's value.
+		FValueKeyMemo Memo;
+
 		virtual bool Init(FPCGExContext* InContext, const TSharedPtr<PCGExData::FFacade>& InPointDataFacade) override;
 
 		virtual bool Test(const int32 PointIndex) const override;
@@ -106,6 +110,9 @@ namespace PCGExPointFilter
 		virtual ~FStringCompareFilter() override
 		{
 		}
+
+	protected:
+		bool TestPoint(const int32 PointIndex) const;
 	};
 }
 
@@ -9,6 +9,7 @@
 #include "Utils/PCGExRegex.h"
 
 #include "Core/PCGExPointFilter.h"
+#include "Core/PCGExValueKeyMemo.h"
 
 
 #include "PCGExStringRegexFilter.generated.h"
@@ -75,6 +76,7 @@ namespace PCGExPointFilter
 
 		TSharedPtr<PCGExData::TAttributeBroadcaster<FString>> OperandA;
 		PCGExRegex::FPattern RegexMatcher;
+		FValueKeyMemo Memo;
 
 		virtual bool Init(FPCGExContext* InContext, const TSharedPtr<PCGExData::FFacade>& InPointDataFacade) override;
 
@@ -84,6 +86,9 @@ namespace PCGExPointFilter
 		virtual ~FStringRegexFilter() override
 		{
 		}
+
+	protected:
+		bool TestPoint(const int32 PointIndex) const;
 	};
 }
 
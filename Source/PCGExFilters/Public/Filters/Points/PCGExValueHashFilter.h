@@ -9,6 +9,7 @@
 #include "UObject/Object.h"
 
 #include "Core/PCGExPointFilter.h"
+#include "Core/PCGExValueKeyMemo.h"
 
 #include "PCGExValueHashFilter.generated.h"
 
@@ -112,6 +113,7 @@ namespace PCGExPointFilter
 		TSharedPtr<PCGExData::IBuffer> OperandA;
 		bool bInvert = false;
 		bool bAnyPass = true;
+		FValueKeyMemo Memo;
 
 		virtual bool Init(FPCGExContext* InContext, const TSharedPtr<PCGExData::FFacade>& InPointDataFacade) override;
 
@@ -121,6 +123,9 @@ namespace PCGExPointFilter
 		virtual ~FValueHashFilter() override
 		{
 		}
+
+	protected:
+		bool TestPoint(const int32 PointIndex) const;
 	};
 }
 
@@ -677,4 +677,131 @@ namespace PCGExClusters
 	void FCell::PostProcessPoints(UPCGBasePointData* InMutablePoints)
 	{
 	}
+
+	FCellLocator::FCellLocator(const TArray<TSharedPtr<FCell>>& InCells, const int32 InCellsPerBucket)
+		: Cells(InCells)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusters::FCellLocator::Build);
+
+		int32 NumIndexed = 0;
+		for (const TSharedPtr<FCell>& Cell : Cells)
+		{
+			if (!Cell || Cell->Polygon.IsEmpty() || !Cell->Bounds2D.bIsValid) { continue; }
+			Bounds += Cell->Bounds2D;
+			NumIndexed++;
+		}
+
+		if (!NumIndexed) { return; }
+
+		// Aim for a handful of cells per bucket, keeping buckets roughly square
+		const FVector2D Size = Bounds.GetSize().ComponentMax(FVector2D(UE_KINDA_SMALL_NUMBER));
+		const double BucketSize = FMath::Sqrt((Size.X * Size.Y) / FMath::Max(1, NumIndexed / FMath::Max(1, InCellsPerBucket)));
+
+		constexpr int32 MaxBucketsPerAxis = 1024;
+		NumBuckets = FIntPoint(
+			FMath::Clamp(FMath::CeilToInt32(Size.X / BucketSize), 1, MaxBucketsPerAxis),
+			FMath::Clamp(FMath::CeilToInt32(Size.Y / BucketSize), 1, MaxBucketsPerAxis));
+
+		InvBucketSize = FVector2D(NumBuckets.X / Size.X, NumBuckets.Y / Size.Y);
+
+		// Two passes over each cell's bucket footprint: count, then fill. Cells are visited in order,
+		// so each bucket lists its candidates in ascending cell index.
+		BucketStart.Init(0, NumBuckets.X * NumBuckets.Y + 1);
+
+		auto ForEachBucket = [&](const FBox2D& InBox, auto&& Func)
+		{
+			const int32 MinX = FMath::Clamp(FMath::FloorToInt32((InBox.Min.X - Bounds.Min.X) * InvBucketSize.X), 0, NumBuckets.X - 1);
+			const int32 MinY = FMath::Clamp(FMath::FloorToInt32((InBox.Min.Y - Bounds.Min.Y) * InvBucketSize.Y), 0, NumBuckets.Y - 1);
+			const int32 MaxX = FMath::Clamp(FMath::FloorToInt32((InBox.Max.X - Bounds.Min.X) * InvBucketSize.X), 0, NumBuckets.X - 1);
+			const int32 MaxY = FMath::Clamp(FMath::FloorToInt32((InBox.Max.Y - Bounds.Min.Y) * InvBucketSize.Y), 0, NumBuckets.Y - 1);
+
+			for (int32 Y = MinY; Y <= MaxY; Y++)
+			{
+				for (int32 X = MinX; X <= MaxX; X++) { Func(X + Y * NumBuckets.X); }
+			}
+		};
+
+		for (const TSharedPtr<FCell>& Cell : Cells)
+		{
+			if (!Cell || Cell->Polygon.IsEmpty() || !Cell->Bounds2D.bIsValid) { continue; }
+			ForEachBucket(Cell->Bounds2D, [&](const int32 Bucket) { BucketStart[Bucket + 1]++; });
+		}
+
+		for (int32 i = 1; i < BucketStart.Num(); i++) { BucketStart[i] += BucketStart[i - 1]; }
+
+		BucketCells.SetNumUninitialized(BucketStart.Last());
+
+		TArray<int32> Cursor(BucketStart.GetData(), BucketStart.Num() - 1);
+		for (int32 i = 0; i < Cells.Num(); i++)
+		{
+			const TSharedPtr<FCell>& Cell = Cells[i];
+			if (!Cell || Cell->Polygon.IsEmpty() || !Cell->Bounds2D.bIsValid) { continue; }
+			ForEachBucket(Cell->Bounds2D, [&](const int32 Bucket) { BucketCells[Cursor[Bucket]++] = i; });
+		}
+	}
+
+	int32 FCellLocator::FindFirst(const FVector2D& Point) const
+	{
+		const int32 Bucket = GetBucket(Point);
+		if (Bucket == -1) { return -1; }
+
+		for (int32 i = BucketStart[Bucket]; i < BucketStart[Bucket + 1]; i++)
+		{
+			if (Contains(BucketCells[i], Point)) { return BucketCells[i]; }
+		}
+
+		return -1;
+	}
+
+	void FCellLocator::FindAll(const FVector2D& Point, TArray<int32>& OutIndices) const
+	{
+		const int32 Bucket = GetBucket(Point);
+		if (Bucket == -1) { return; }
+
+		for (int32 i = BucketStart[Bucket]; i < BucketStart[Bucket + 1]; i++)
+		{
+			if (Contains(BucketCells[i], Point)) { OutIndices.Add(BucketCells[i]); }
+		}
+	}
+
+	void FCellLocator::GroupPoints(const int32 NumPoints, TFunctionRef<FVector2D(int32)> GetPoint, TArray<int32>& OutStart, TArray<int32>& OutPoints) const
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(PCGExClusters::FCellLocator::GroupPoints);
+
+		TArray<FIntPoint> Hits; // (Cell, Point)
+		Hits.Reserve(NumPoints);
+
+		TArray<int32> Located;
+		for (int32 i = 0; i < NumPoints; i++)
+		{
+			Located.Reset();
+			FindAll(GetPoint(i), Located);
+			for (const int32 CellIndex : Located) { Hits.Emplace(CellIndex, i); }
+		}
+
+		OutStart.Init(0, Cells.Num() + 1);
+		for (const FIntPoint& Hit : Hits) { OutStart[Hit.X + 1]++; }
+		for (int32 i = 1; i < OutStart.Num(); i++) { OutStart[i] += OutStart[i - 1]; }
+
+		// Hits are in point order already, a stable scatter keeps it that way within each cell
+		OutPoints.SetNumUninitialized(Hits.Num());
+		TArray<int32> Cursor(OutStart.GetData(), Cells.Num());
+		for (const FIntPoint& Hit : Hits) { OutPoints[Cursor[Hit.X]++] = Hit.Y; }
+	}
+
+	int32 FCellLocator::GetBucket(const FVector2D& Point) const
+	{
+		// Cell bounds tests are strict, anything outside the overall bounds can't be inside a cell
+		if (BucketCells.IsEmpty() || !Bounds.IsInside(Point)) { return -1; }
+
+		const int32 X = FMath::Clamp(FMath::FloorToInt32((Point.X - Bounds.Min.X) * InvBucketSize.X), 0, NumBuckets.X - 1);
+		const int32 Y = FMath::Clamp(FMath::FloorToInt32((Point.Y - Bounds.Min.Y) * InvBucketSize.Y), 0, NumBuckets.Y - 1);
+		return X + Y * NumBuckets.X;
+	}
+
+	bool FCellLocator::Contains(const int32 CellIndex, const FVector2D& Point) const
+	{
+		const FCell* Cell = Cells[CellIndex].Get();
+		return Cell->Bounds2D.IsInside(Point) && PCGExMath::Geo::IsPointInPolygon(Point, Cell->Polygon);
+	}
 }
@@ -4,6 +4,7 @@
 #include "Graphs/PCGExGraph.h"
 
 #include "PCGExH.h"
+#include "Algo/Unique.h"
 #include "Clusters/PCGExEdge.h"
 #include "Core/PCGExMTCommon.h"
 #include "Graphs/PCGExSubGraph.h"
@@ -11,6 +12,111 @@
 
 namespace PCGExGraphs
 {
+	FEdgeBatches::FEdgeBatches(const TArray<PCGExMT::FScope>& InScopes, const int32 InReserve)
+	{
+		Batches.SetNum(InScopes.Num());
+		if (InReserve > 0)
+		{
+			for (TArray<uint64>& Batch : Batches) { Batch.Reserve(InReserve); }
+		}
+		else if (InReserve < 0)
+		{
+			// Negative reserve is a per-scope-item factor, same convention as TScopedSet
+			const int32 ReserveFactor = FMath::Abs(InReserve);
+			for (int i = 0; i < InScopes.Num(); i++) { Batches[i].Reserve(InScopes[i].Count * ReserveFactor); }
+		}
+	}
+
+	FEdgeBatches::FEdgeBatches(const int32 InNumBatches)
+	{
+		Batches.SetNum(InNumBatches);
+	}
+
+	int32 FEdgeBatches::GetTotalNum() const
+	{
+		int32 TotalNum = 0;
+		for (const TArray<uint64>& Batch : Batches) { TotalNum += Batch.Num(); }
+		return TotalNum;
+	}
+
+	void FEdgeBatches::Collapse(TArray<uint64>& OutSortedUnique)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FEdgeBatches::Collapse);
+
+		OutSortedUnique.Reset();
+
+		// Drop empty batches upfront so merge rounds only pair up actual work
+		TArray<TArray<uint64>> Runs;
+		Runs.Reserve(Batches.Num());
+		for (TArray<uint64>& Batch : Batches)
+		{
+			if (!Batch.IsEmpty()) { Runs.Add(MoveTemp(Batch)); }
+		}
+		Batches.Empty();
+
+		if (Runs.IsEmpty()) { return; }
+
+		// Local sort & unique -- producers commonly emit the same edge from both endpoints,
+		// so this usually halves the data before any merge happens.
+		ParallelFor(
+			Runs.Num(), [&](const int32 i)
+			{
+				TArray<uint64>& Run = Runs[i];
+				Run.Sort();
+				Run.SetNum(Algo::Unique(Run), EAllowShrinking::No);
+			});
+
+		// Pairwise merge rounds. Each round halves the number of runs and every merge is independent,
+		// dropping duplicates across runs as it goes. Final order only depends on the hashes.
+		while (Runs.Num() > 1)
+		{
+			const int32 NumPairs = Runs.Num() / 2;
+			TArray<TArray<uint64>> Merged;
+			Merged.SetNum(NumPairs + (Runs.Num() & 1));
+
+			ParallelFor(
+				NumPairs, [&](const int32 i)
+				{
+					const TArray<uint64>& L = Runs[i * 2];
+					const TArray<uint64>& R = Runs[i * 2 + 1];
+					TArray<uint64>& Out = Merged[i];
+					Out.SetNumUninitialized(L.Num() + R.Num());
+
+					const uint64* LData = L.GetData();
+					const uint64* RData = R.GetData();
+					uint64* OutData = Out.GetData();
+
+					int32 li = 0;
+					int32 ri = 0;
+					int32 o = 0;
+
+					while (li < L.Num() && ri < R.Num())
+					{
+						const uint64 A = LData[li];
+						const uint64 B = RData[ri];
+						if (A < B) { OutData[o++] = A; li++; }
+						else if (B < A) { OutData[o++] = B; ri++; }
+						else
+						{
+							OutData[o++] = A;
+							li++;
+							ri++;
+						}
+					}
+
+					while (li < L.Num()) { OutData[o++] = LData[li++]; }
+					while (ri < R.Num()) { OutData[o++] = RData[ri++]; }
+
+					Out.SetNum(o, EAllowShrinking::No);
+				});
+
+			if (Runs.Num() & 1) { Merged.Last() = MoveTemp(Runs.Last()); }
+			Runs = MoveTemp(Merged);
+		}
+
+		OutSortedUnique = MoveTemp(Runs[0]);
+	}
+
 	FGraph::FGraph(const int32 InNumNodes)
 	{
 		int32 StartNodeIndex = 0;
@@ -153,6 +259,67 @@ namespace PCGExGraphs
 		return StartIndex;
 	}
 
+	int32 FGraph::InsertEdges(FEdgeBatches& InBatches, const int32 InIOIndex)
+	{
+		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::InsertEdges_Batched)
+
+		// Merge happens outside the graph lock, producers are done by now
+		TArray<uint64> Candidates;
+		InBatches.Collapse(Candidates);
+
+		FWriteScopeLock WriteLock(GraphLock);
+		const int32 StartIndex = Edges.Num();
+
+		const int32 NumCandidates = Candidates.Num();
+		if (!NumCandidates) { return StartIndex; }
+
+		// Reject edges already in the graph as well as degenerate ones.
+		// UniqueEdges is only read here, which is safe to do concurrently under the write lock.
+		TArray<int8> Keep;
+		Keep.SetNumUninitialized(NumCandidates);
+
+		PCGExMT::ParallelOrSequential(
+			NumCandidates, [&](const int32 i)
+			{
+				const uint64 E = Candidates[i];
+				Keep[i] = PCGEx::H64A(E) != PCGEx::H64B(E) && !UniqueEdges.Contains(E);
+			});
+
+		int32 NumNew = 0;
+		for (int32 i = 0; i < NumCandidates; i++)
+		{
+			if (Keep[i]) { Candidates[NumNew++] = Candidates[i]; }
+		}
+		Candidates.SetNum(NumNew, EAllowShrinking::No);
+
+		if (!NumNew) { return StartIndex; }
+
+		Edges.SetNum(StartIndex + NumNew);
+		FEdge* EdgesData = Edges.GetData() + StartIndex;
+
+		PCGExMT::ParallelOrSequential(
+			NumNew, [&](const int32 i)
+			{
+				uint32 A;
+				uint32 B;
+				PCGEx::H64(Candidates[i], A, B);
+				EdgesData[i] = FEdge(StartIndex + i, A, B, -1, InIOIndex);
+			});
+
+		// Map & per-node links are not thread-safe; this remains a single linear pass
+		// but there is no per-edge locking or dedup left to do at this point.
+		UniqueEdges.Reserve(UniqueEdges.Num() + NumNew);
+		for (int32 i = 0; i < NumNew; i++)
+		{
+			const FEdge& Edge = EdgesData[i];
+			UniqueEdges.Add(Candidates[i], Edge.Index);
+			Nodes[Edge.Start].LinkEdge(Edge.Index);
+			Nodes[Edge.End].LinkEdge(Edge.Index);
+		}
+
+		return StartIndex;
+	}
+
 	void FGraph::AdoptEdges(TArray<FEdge>& InEdges, const bool bBuildAdjacency)
 	{
 		TRACE_CPUPROFILER_EVENT_SCOPE(FGraph::AdoptEdges);
@@ -172,7 +172,7 @@ namespace PCGExGraphs
 			const FPCGExPointEdgeIntersectionDetails& Details,
 			const bool bEnableSelfIntersection,
 			const PCGExMT::FScope& Scope,
-			TArray<FPECollinear>& OutScopeRecords)
+			PCGExMT::TArenaArray<FPECollinear>& OutScopeRecords)
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(PointEdgePass::Emit);
 
@@ -443,7 +443,7 @@ namespace PCGExGraphs
 			const FPCGExEdgeEdgeIntersectionDetails& Details,
 			const bool bEnableSelfIntersection,
 			const PCGExMT::FScope& Scope,
-			TArray<FEECrossing>& OutScopeRecords)
+			PCGExMT::TArenaArray<FEECrossing>& OutScopeRecords)
 		{
 			TRACE_CPUPROFILER_EVENT_SCOPE(EdgeEdgePass::Emit);
 
@@ -297,6 +297,7 @@ namespace PCGExGraphs
 		(void)IntersectionAllocations->PointIO->GetOutIn()->GetPointOctree();
 
 		PCGEX_ASYNC_GROUP_CHKD_VOID(Context->GetTaskManager(), FindPointEdgeGroup)
+		FindPointEdgeGroup->bUseArena = true;
 
 		FindPointEdgeGroup->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE]()
 		{
@@ -307,7 +308,7 @@ namespace PCGExGraphs
 		FindPointEdgeGroup->OnPrepareSubLoopsCallback = [PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops)
 		{
 			PCGEX_ASYNC_THIS
-			This->ScopedPERecords = MakeShared<PCGExMT::TScopedArray<FPECollinear>>(Loops);
+			This->ScopedPERecords = MakeShared<PCGExMT::TScopedArenaArray<FPECollinear>>(Loops);
 			// Pre-reserve scope arrays at ~1 record per edge in the scope. Avoids the realloc
 			// cascade as records accumulate; over-allocation is cheap (records are small PODs).
 			for (const PCGExMT::FScope& S : Loops)
@@ -319,7 +320,7 @@ namespace PCGExGraphs
 		FindPointEdgeGroup->OnSubLoopStartCallback = [PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
 		{
 			PCGEX_ASYNC_THIS
-			TArray<FPECollinear>& Records = This->ScopedPERecords->Get_Ref(Scope);
+			PCGExMT::TArenaArray<FPECollinear>& Records = This->ScopedPERecords->Get_Ref(Scope);
 			PointEdgePass::Emit(*This->IntersectionAllocations, This->PointEdgeIntersectionDetails, This->PointEdgeIntersectionDetails.bEnableSelfIntersection, Scope, Records);
 		};
 
@@ -337,7 +338,7 @@ namespace PCGExGraphs
 		}
 
 		// Drain scope-local records into a single flat array. Order across scopes is stable since
-		// TScopedArray::Collapse concatenates in scope-index order; the apply pass sorts anyway.
+		// TScopedArenaArray::Collapse concatenates in scope-index order; the apply pass sorts anyway.
 		TArray<FPECollinear> Records;
 		ScopedPERecords->Collapse(Records);
 		ScopedPERecords.Reset();
@@ -421,6 +422,7 @@ namespace PCGExGraphs
 		IntersectionAllocations->BuildEdgeOctree(Bounds);
 
 		PCGEX_ASYNC_GROUP_CHKD_VOID(Context->GetTaskManager(), FindEdgeEdgeGroup)
+		FindEdgeEdgeGroup->bUseArena = true;
 
 		FindEdgeEdgeGroup->OnCompleteCallback = [PCGEX_ASYNC_THIS_CAPTURE]()
 		{
@@ -431,7 +433,7 @@ namespace PCGExGraphs
 		FindEdgeEdgeGroup->OnPrepareSubLoopsCallback = [PCGEX_ASYNC_THIS_CAPTURE](const TArray<PCGExMT::FScope>& Loops)
 		{
 			PCGEX_ASYNC_THIS
-			This->ScopedEERecords = MakeShared<PCGExMT::TScopedArray<FEECrossing>>(Loops);
+			This->ScopedEERecords = MakeShared<PCGExMT::TScopedArenaArray<FEECrossing>>(Loops);
 			for (const PCGExMT::FScope& S : Loops)
 			{
 				This->ScopedEERecords->Get_Ref(S).Reserve(S.Count);
@@ -441,7 +443,7 @@ namespace PCGExGraphs
 		FindEdgeEdgeGroup->OnSubLoopStartCallback = [PCGEX_ASYNC_THIS_CAPTURE](const PCGExMT::FScope& Scope)
 		{
 			PCGEX_ASYNC_THIS
-			TArray<FEECrossing>& Records = This->ScopedEERecords->Get_Ref(Scope);
+			PCGExMT::TArenaArray<FEECrossing>& Records = This->ScopedEERecords->Get_Ref(Scope);
 			EdgeEdgePass::Emit(*This->IntersectionAllocations, This->EdgeEdgeIntersectionDetails, This->EdgeEdgeIntersectionDetails.bEnableSelfIntersection, Scope, Records);
 		};
 
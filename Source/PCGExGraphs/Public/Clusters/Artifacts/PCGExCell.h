@@ -292,5 +292,44 @@ namespace PCGExClusters
 		void PostProcessPoints(UPCGBasePointData* InMutablePoints);
 	};
 
+	/**
+	 * Point-location index over a set of cells: a uniform grid over their 2D bounds, each bucket listing
+	 * the cells whose bounds overlap it. Queries only run the exact polygon test against the few candidates
+	 * of the bucket the point falls in. Candidates are kept in cell order, so results are in ascending cell index.
+	 * Null cells and cells without a polygon are never matched.
+	 */
+	class PCGEXGRAPHS_API FCellLocator
+	{
+	public:
+		explicit FCellLocator(const TArray<TSharedPtr<FCell>>& InCells, const int32 InCellsPerBucket = 2);
+
+		/** Lowest index of a cell containing the point, -1 if none does. */
+		int32 FindFirst(const FVector2D& Point) const;
+
+		/** Indices of all the cells containing the point, in ascending order. */
+		void FindAll(const FVector2D& Point, TArray<int32>& OutIndices) const;
+
+		FORCEINLINE bool IsInsideAny(const FVector2D& Point) const { return FindFirst(Point) != -1; }
+
+		/**
+		 * Group points by the cells containing them.
+		 * Points inside cell i are OutPoints[OutStart[i] .. OutStart[i + 1]), in ascending point order.
+		 */
+		void GroupPoints(const int32 NumPoints, TFunctionRef<FVector2D(int32)> GetPoint, TArray<int32>& OutStart, TArray<int32>& OutPoints) const;
+
+	protected:
+		TArray<TSharedPtr<FCell>> Cells;
+
+		FBox2D Bounds = FBox2D(ForceInit);
+		FVector2D InvBucketSize = FVector2D::ZeroVector;
+		FIntPoint NumBuckets = FIntPoint::ZeroValue;
+
+		TArray<int32> BucketStart; // Bucket -> first candidate in BucketCells, NumBuckets + 1 entries
+		TArray<int32> BucketCells;
+
+		int32 GetBucket(const FVector2D& Point) const;
+		bool Contains(const int32 CellIndex, const FVector2D& Point) const;
+	};
+
 #pragma endregion
 }
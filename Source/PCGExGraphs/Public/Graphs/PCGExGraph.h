@@ -7,6 +7,7 @@
 #include "PCGExGraphMetadata.h"
 #include "Clusters/PCGExEdge.h"
 #include "Clusters/PCGExNode.h"
+#include "Core/PCGExMTCommon.h"
 #include "Graphs/PCGExGraphDetails.h"
 
 namespace PCGEx
@@ -24,6 +25,38 @@ namespace PCGExGraphs
 {
 	class FSubGraph;
 
+	/**
+	 * Lock-free staging for concurrent edge producers.
+	 * Each scope appends packed H64U hashes to its own batch without synchronization; the batches
+	 * are then merged with a parallel sort-and-unique and handed to FGraph::InsertEdges in one go.
+	 * Because the merged output is sorted by hash, edge indices are assigned deterministically,
+	 * regardless of how the producing work was scheduled.
+	 */
+	class PCGEXGRAPHS_API FEdgeBatches : public TSharedFromThis<FEdgeBatches>
+	{
+	public:
+		TArray<TArray<uint64>> Batches;
+
+		explicit FEdgeBatches(const TArray<PCGExMT::FScope>& InScopes, const int32 InReserve = 0);
+		explicit FEdgeBatches(const int32 InNumBatches);
+
+		FORCEINLINE TArray<uint64>& Get_Ref(const PCGExMT::FScope& InScope) { return Batches[InScope.LoopIndex]; }
+
+		FORCEINLINE void Add(const PCGExMT::FScope& InScope, const int32 A, const int32 B)
+		{
+			Batches[InScope.LoopIndex].Add(PCGEx::H64U(A, B));
+		}
+
+		int32 GetTotalNum() const;
+
+		/**
+		 * Sort & dedupe every batch in parallel, then merge them pairwise in parallel rounds.
+		 * Batches are consumed.
+		 * @param OutSortedUnique Ascending, duplicate-free edge hashes.
+		 */
+		void Collapse(TArray<uint64>& OutSortedUnique);
+	};
+
 	class PCGEXGRAPHS_API FGraph : public TSharedFromThis<FGraph>
 	{
 		mutable FRWLock GraphLock;
@@ -76,6 +109,15 @@ namespace PCGExGraphs
 		void InsertEdges(const TArray<uint64>& InEdges, int32 InIOIndex);
 		int32 InsertEdges(const TArray<FEdge>& InEdges);
 
+		/**
+		 * Bulk insertion of edges produced concurrently into FEdgeBatches.
+		 * Producers never touch GraphLock; the lock is only held once, for the merge.
+		 * New edges are appended in ascending hash order, so resulting indices do not depend on thread count.
+		 * Batches are consumed.
+		 * @return Index of the first inserted edge
+		 */
+		int32 InsertEdges(FEdgeBatches& InBatches, int32 InIOIndex);
+
 		/**
 		 * Bulk-adopt pre-deduplicated edges without hash checking. Caller guarantees uniqueness.
 		 * @param bBuildAdjacency When false, skips the UniqueEdges dedup map, per-node Links and
@@ -9,6 +9,7 @@
 #include "Core/PCGExOpStats.h"
 
 #include "Clusters/PCGExEdge.h"
+#include "Containers/PCGExArena.h"
 #include "Data/PCGExPointElements.h"
 #include "Data/Utils/PCGExDataForwardDetails.h"
 #include "Utils/PCGValueRange.h"
@@ -123,7 +124,7 @@ namespace PCGExGraphs
 			const FPCGExPointEdgeIntersectionDetails& Details,
 			bool bEnableSelfIntersection,
 			const PCGExMT::FScope& Scope,
-			TArray<FPECollinear>& OutScopeRecords);
+			PCGExMT::TArenaArray<FPECollinear>& OutScopeRecords);
 
 		// Phase 2 -- sequential apply. Sorts by (EdgeIdx, Time), then walks per-edge subdivisions
 		// and mutates the Graph (insert sub-edges, stamp metadata). bSnapOnEdge mutates output
@@ -183,7 +184,7 @@ namespace PCGExGraphs
 			const FPCGExEdgeEdgeIntersectionDetails& Details,
 			bool bEnableSelfIntersection,
 			const PCGExMT::FScope& Scope,
-			TArray<FEECrossing>& OutScopeRecords);
+			PCGExMT::TArenaArray<FEECrossing>& OutScopeRecords);
 
 		// Phase 2 -- sequential dedup + node allocation. Sorts records by (Key, TimeA, TimeB) for
 		// determinism, collapses duplicates, runs endpoint-reuse + octree near-miss check, and
@@ -27,7 +27,7 @@ namespace PCGExBlending
 namespace PCGExMT
 {
 	template <typename T>
-	class TScopedArray;
+	class TScopedArenaArray;
 }
 
 namespace PCGExGraphs
@@ -120,11 +120,11 @@ namespace PCGExGraphs
 		TSharedPtr<FIntersectionAllocations> IntersectionAllocations;
 
 		// P/E find-pass accumulators -- thread-local during emit, drained sequentially in apply.
-		TSharedPtr<PCGExMT::TScopedArray<FPECollinear>> ScopedPERecords;
+		TSharedPtr<PCGExMT::TScopedArenaArray<FPECollinear>> ScopedPERecords;
 
 		// E/E find-pass accumulators + the merged record array that survives across find -> resolve
 		// -> apply -> blend. Records flagged bIsPrimary && bAllocatedNewNode drive the blend phase.
-		TSharedPtr<PCGExMT::TScopedArray<FEECrossing>> ScopedEERecords;
+		TSharedPtr<PCGExMT::TScopedArenaArray<FEECrossing>> ScopedEERecords;
 		TArray<FEECrossing> EECrossings;
 
 		TSharedPtr<PCGExBlending::FMetadataBlender> MetadataBlender;
@@ -3,6 +3,7 @@
 
 #include "Core/PCGExMatchRuleFactoryProvider.h"
 
+#include "Data/PCGExDataValue.h"
 #include "Data/PCGExPointIO.h"
 
 #define LOCTEXT_NAMESPACE "PCGExCreateMatchRule"
@@ -10,12 +11,104 @@
 
 PCG_DEFINE_TYPE_INFO(FPCGExDataTypeInfoMatchRule, UPCGExMatchRuleFactoryData)
 
+namespace PCGExMatching
+{
+	void IntersectPostings(FPostings& InOut, const FPostings& InOther)
+	{
+		int32 Write = 0;
+		int32 j = 0;
+		for (int32 i = 0; i < InOut.Num() && j < InOther.Num(); i++)
+		{
+			const int32 Value = InOut[i];
+			while (j < InOther.Num() && InOther[j] < Value) { j++; }
+			if (j < InOther.Num() && InOther[j] == Value) { InOut[Write++] = Value; }
+		}
+		InOut.SetNum(Write, EAllowShrinking::No);
+	}
+
+	void UnionPostings(FPostings& InOut, const FPostings& InOther)
+	{
+		if (InOther.IsEmpty()) { return; }
+		if (InOut.IsEmpty())
+		{
+			InOut = InOther;
+			return;
+		}
+
+		FPostings Merged;
+		Merged.Reserve(InOut.Num() + InOther.Num());
+
+		int32 i = 0;
+		int32 j = 0;
+		while (i < InOut.Num() || j < InOther.Num())
+		{
+			if (j >= InOther.Num() || (i < InOut.Num() && InOut[i] < InOther[j])) { Merged.Add(InOut[i++]); }
+			else if (i >= InOut.Num() || InOther[j] < InOut[i]) { Merged.Add(InOther[j++]); }
+			else
+			{
+				Merged.Add(InOut[i++]);
+				j++;
+			}
+		}
+
+		InOut = MoveTemp(Merged);
+	}
+
+	bool GetSameValueKey(const TSharedPtr<PCGExData::IDataValue>& InValue, FString& OutKey)
+	{
+		if (!InValue) { return false; }
+
+		if (InValue->IsNumeric())
+		{
+			const double Value = InValue->AsDouble();
+			if (FMath::IsNaN(Value)) { return false; }
+
+			// -0 == 0, make sure both land on the same key
+			const double Normalized = Value == 0 ? 0 : Value;
+			uint64 Bits = 0;
+			FMemory::Memcpy(&Bits, &Normalized, sizeof(double));
+			OutKey = FString::Printf(TEXT("#%llx"), Bits);
+			return true;
+		}
+
+		if (InValue->IsText())
+		{
+			// FString keys compare like IDataValue::SameValue does (case-insensitive)
+			OutKey = TEXT("$") + InValue->AsString();
+			return true;
+		}
+
+		return false;
+	}
+}
+
 bool FPCGExMatchRuleOperation::PrepareForMatchableSources(FPCGExContext* InContext, const TSharedPtr<TArray<FPCGExTaggedData>>& InMatchableSources)
 {
 	MatchableSources = InMatchableSources;
 	return true;
 }
 
+void FPCGExMatchRuleOperation::InvertPostings(PCGExMatching::FPostings& InOutMatches) const
+{
+	const int32 NumSources = MatchableSources->Num();
+
+	PCGExMatching::FPostings Inverted;
+	Inverted.Reserve(NumSources - InOutMatches.Num());
+
+	int32 j = 0;
+	for (int32 i = 0; i < NumSources; i++)
+	{
+		if (j < InOutMatches.Num() && InOutMatches[j] == i)
+		{
+			j++;
+			continue;
+		}
+		Inverted.Add(i);
+	}
+
+	InOutMatches = MoveTemp(Inverted);
+}
+
 TSharedPtr<FPCGExMatchRuleOperation> UPCGExMatchRuleFactoryData::CreateOperation(FPCGExContext* InContext) const
 {
 	return nullptr; // Create shape builder operation
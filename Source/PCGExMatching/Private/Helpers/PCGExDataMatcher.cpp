@@ -8,7 +8,7 @@
 #include "Data/PCGExDataHelpers.h"
 #include "Data/PCGExPointIO.h"
 #include "Details/PCGExMatchingDetails.h"
-#include "Helpers/PCGExArrayHelpers.h"
+#include "Algo/BinarySearch.h"
 #include "Metadata/Accessors/PCGAttributeAccessorKeys.h"
 #include "Metadata/Accessors/PCGCustomAccessor.h"
 
@@ -338,18 +338,24 @@ namespace PCGExMatching
 			return true;
 		}
 
-		int32 NumIgnored = 0;
-		TArray<FPCGExTaggedData>& MatchableSourcesRef = *MatchableSources.Get();
-		for (const FPCGExTaggedData& Source : MatchableSourcesRef)
+		TArray<int32> Matches;
+		GatherMatches(InDataCandidate, InMatchingScope, nullptr, Matches);
+
+		// Matches are sorted, everything in between is ignored
+		const TArray<FPCGExTaggedData>& MatchableSourcesRef = *MatchableSources.Get();
+		int32 NextMatch = 0;
+		for (int32 i = 0; i < NumSources; i++)
 		{
-			if (!Test(Source.Data, InDataCandidate, InMatchingScope))
+			if (NextMatch < Matches.Num() && Matches[NextMatch] == i)
 			{
-				OutIgnoreList.Add(Source.Data);
-				NumIgnored++;
+				NextMatch++;
+				continue;
 			}
+
+			OutIgnoreList.Add(MatchableSourcesRef[i].Data);
 		}
 
-		return MatchableSources->Num() != NumIgnored;
+		return !Matches.IsEmpty();
 	}
 
 	bool FDataMatcher::PopulateIgnoreListFromCandidates(
@@ -408,130 +414,187 @@ namespace PCGExMatching
 		TArray<FPCGExTaggedData>& MatchableSourcesRef = *MatchableSources.Get();
 		OutMatches.Reset(NumSources);
 
+		// Excluded sources, plus already visited ones when recursing
+		TBitArray<> Skip(false, NumSources);
 		if (InExcludedSources)
 		{
-			if (MatchMode == EPCGExMapMatchMode::Disabled)
+			for (const int32 Excluded : *InExcludedSources)
 			{
-				for (int32 i = 0; i < NumSources; i++)
-				{
-					if (InExcludedSources->Contains(i))
-					{
-						continue;
-					}
-					OutMatches.Add(i);
-				}
-
-				return OutMatches.Num();
+				if (Skip.IsValidIndex(Excluded)) { Skip[Excluded] = true; }
 			}
+		}
 
+		if (MatchMode == EPCGExMapMatchMode::Disabled)
+		{
 			for (int32 i = 0; i < NumSources; i++)
 			{
-				if (InExcludedSources->Contains(i))
-				{
-					continue;
-				}
-				if (Test(MatchableSourcesRef[i].Data, InDataCandidate, InMatchingScope))
-				{
-					OutMatches.Add(i);
-				}
+				if (!Skip[i]) { OutMatches.Add(i); }
 			}
 
-			// Handle recursive/transitive matching
-			if (bWantsRecursion && !OutMatches.IsEmpty())
+			return OutMatches.Num();
+		}
+
+		GatherMatches(InDataCandidate, InMatchingScope, &Skip, OutMatches);
+
+		// Handle recursive/transitive matching
+		if (bWantsRecursion && !OutMatches.IsEmpty())
+		{
+			for (const int32 Idx : OutMatches)
 			{
-				TBitArray<> Visited(false, NumSources);
-				for (const int32 Idx : OutMatches)
-				{
-					Visited[Idx] = true;
-				}
+				Skip[Idx] = true;
+			}
 
-				TArray<int32> CurrentLevel = OutMatches;
-				TArray<int32> NextLevel;
-				int32 CurrentDepth = 0;
+			TArray<int32> CurrentLevel = OutMatches;
+			TArray<int32> NextLevel;
+			int32 CurrentDepth = 0;
+
+			while (!CurrentLevel.IsEmpty() && (MaxRecursionDepth < 0 || CurrentDepth < MaxRecursionDepth))
+			{
+				NextLevel.Reset();
 
-				while (!CurrentLevel.IsEmpty() && (MaxRecursionDepth < 0 || CurrentDepth < MaxRecursionDepth))
+				for (const int32 CurrentIdx : CurrentLevel)
 				{
-					NextLevel.Reset();
+					const int32 FirstNew = OutMatches.Num();
+					GatherMatches(MatchableSourcesRef[CurrentIdx], InMatchingScope, &Skip, OutMatches);
 
-					for (const int32 CurrentIdx : CurrentLevel)
+					for (int32 m = FirstNew; m < OutMatches.Num(); m++)
 					{
-						for (int32 i = 0; i < NumSources; i++)
-						{
-							if (Visited[i] || InExcludedSources->Contains(i))
-							{
-								continue;
-							}
-							if (Test(MatchableSourcesRef[i].Data, MatchableSourcesRef[CurrentIdx], InMatchingScope))
-							{
-								Visited[i] = true;
-								OutMatches.Add(i);
-								NextLevel.Add(i);
-							}
-						}
+						Skip[OutMatches[m]] = true;
+						NextLevel.Add(OutMatches[m]);
 					}
-
-					CurrentLevel = MoveTemp(NextLevel);
-					CurrentDepth++;
 				}
-			}
 
-			return OutMatches.Num();
+				CurrentLevel = MoveTemp(NextLevel);
+				CurrentDepth++;
+			}
 		}
 
-		if (MatchMode == EPCGExMapMatchMode::Disabled)
+		return OutMatches.Num();
+	}
+
+	void FDataMatcher::GatherMatches(const FPCGExTaggedData& InDataCandidate, FScope& InMatchingScope, const TBitArray<>* InSkip, TArray<int32>& OutMatches) const
+	{
+		const TArray<FPCGExTaggedData>& MatchableSourcesRef = *MatchableSources.Get();
+
+		if (!bUseIndex)
 		{
-			PCGExArrayHelpers::ArrayOfIndices(OutMatches, NumSources);
-			return OutMatches.Num();
+			for (int32 i = 0; i < NumSources; i++)
+			{
+				if (InSkip && (*InSkip)[i]) { continue; }
+				if (Test(MatchableSourcesRef[i].Data, InDataCandidate, InMatchingScope)) { OutMatches.Add(i); }
+			}
+
+			return;
 		}
 
-		for (int32 i = 0; i < NumSources; i++)
+		TRACE_CPUPROFILER_EVENT_SCOPE(FDataMatcher::GatherIndexedMatches);
+
+		const bool bAll = MatchMode == EPCGExMapMatchMode::All;
+
+		// Narrow sources down with indexed rules first, intersecting the sources each of them lets through
+		FPostings Candidates;
+		FPostings Postings;
+		bool bConstrained = false;
+
+		auto Narrow = [&](const FPostings& InPostings)
 		{
-			if (Test(MatchableSourcesRef[i].Data, InDataCandidate, InMatchingScope))
+			if (!bConstrained)
+			{
+				Candidates = InPostings;
+				bConstrained = true;
+			}
+			else
 			{
-				OutMatches.Add(i);
+				IntersectPostings(Candidates, InPostings);
 			}
+		};
+
+		for (const TSharedPtr<FPCGExMatchRuleOperation>& Op : IndexedRequired)
+		{
+			if (bConstrained && Candidates.IsEmpty()) { return; }
+			Op->GetIndexedMatches(InDataCandidate, InMatchingScope, Postings);
+			Narrow(Postings);
 		}
 
-		// Handle recursive/transitive matching
-		if (bWantsRecursion && !OutMatches.IsEmpty())
+		// In Any mode, optional rules only need one of them to pass
+		FPostings OptionalUnion;
+		if (bAll)
 		{
-			TBitArray<> Visited(false, NumSources);
-			for (const int32 Idx : OutMatches)
+			for (const TSharedPtr<FPCGExMatchRuleOperation>& Op : IndexedOptional)
+			{
+				if (bConstrained && Candidates.IsEmpty()) { return; }
+				Op->GetIndexedMatches(InDataCandidate, InMatchingScope, Postings);
+				Narrow(Postings);
+			}
+		}
+		else
+		{
+			for (const TSharedPtr<FPCGExMatchRuleOperation>& Op : IndexedOptional)
 			{
-				Visited[Idx] = true;
+				Op->GetIndexedMatches(InDataCandidate, InMatchingScope, Postings);
+				UnionPostings(OptionalUnion, Postings);
 			}
 
-			TArray<int32> CurrentLevel = OutMatches;
-			TArray<int32> NextLevel;
-			int32 CurrentDepth = 0;
+			if (TestedOptional.IsEmpty()) { Narrow(OptionalUnion); }
+		}
 
-			while (!CurrentLevel.IsEmpty() && (MaxRecursionDepth < 0 || CurrentDepth < MaxRecursionDepth))
+		// ...then run the remaining rules pairwise, on the survivors only
+		const int32 MatchLimit = GetMatchLimitFor(InDataCandidate);
+		auto TryMatch = [&](const int32 Index)
+		{
+			if (Details->bLimitMatches && !InMatchingScope.IsValid()) { return false; }
+			if (InSkip && (*InSkip)[Index]) { return true; }
+
+			const PCGExData::FConstPoint& TargetElement = *(MatchableSourceFirstElements->GetData() + Index);
+
+			for (const TSharedPtr<FPCGExMatchRuleOperation>& Op : TestedRequired)
 			{
-				NextLevel.Reset();
+				if (!Op->Test(TargetElement, InDataCandidate, InMatchingScope)) { return true; }
+			}
 
-				for (const int32 CurrentIdx : CurrentLevel)
+			if (bAll)
+			{
+				for (const TSharedPtr<FPCGExMatchRuleOperation>& Op : TestedOptional)
 				{
-					for (int32 i = 0; i < NumSources; i++)
+					if (!Op->Test(TargetElement, InDataCandidate, InMatchingScope)) { return true; }
+				}
+			}
+			else if (!TestedOptional.IsEmpty() && Algo::BinarySearch(OptionalUnion, Index) == INDEX_NONE)
+			{
+				bool bAnyOptional = false;
+				for (const TSharedPtr<FPCGExMatchRuleOperation>& Op : TestedOptional)
+				{
+					if (Op->Test(TargetElement, InDataCandidate, InMatchingScope))
 					{
-						if (Visited[i])
-						{
-							continue;
-						}
-						if (Test(MatchableSourcesRef[i].Data, MatchableSourcesRef[CurrentIdx], InMatchingScope))
-						{
-							Visited[i] = true;
-							OutMatches.Add(i);
-							NextLevel.Add(i);
-						}
+						bAnyOptional = true;
+						break;
 					}
 				}
 
-				CurrentLevel = MoveTemp(NextLevel);
-				CurrentDepth++;
+				if (!bAnyOptional) { return true; }
 			}
-		}
 
-		return OutMatches.Num();
+			OutMatches.Add(Index);
+			InMatchingScope.RegisterMatch();
+			if (InMatchingScope.GetCounter() > MatchLimit) { InMatchingScope.Invalidate(); }
+
+			return true;
+		};
+
+		if (bConstrained)
+		{
+			for (const int32 Index : Candidates)
+			{
+				if (!TryMatch(Index)) { break; }
+			}
+		}
+		else
+		{
+			for (int32 i = 0; i < NumSources; i++)
+			{
+				if (!TryMatch(i)) { break; }
+			}
+		}
 	}
 
 	bool FDataMatcher::HandleUnmatchedOutput(const TSharedPtr<PCGExData::FFacade>& InFacade, const bool bForward) const
@@ -673,6 +736,19 @@ namespace PCGExMatching
 			}
 		}
 
+		// Rules that can resolve candidates through an index spare data-level matching most pairwise tests
+		for (const TSharedPtr<FPCGExMatchRuleOperation>& Op : RequiredOperations)
+		{
+			(Op->BuildIndex() ? IndexedRequired : TestedRequired).Add(Op);
+		}
+
+		for (const TSharedPtr<FPCGExMatchRuleOperation>& Op : OptionalOperations)
+		{
+			(Op->BuildIndex() ? IndexedOptional : TestedOptional).Add(Op);
+		}
+
+		bUseIndex = !IndexedRequired.IsEmpty() || !IndexedOptional.IsEmpty();
+
 		return true;
 	}
 }
@@ -104,6 +104,65 @@ bool FPCGExMatchAttrToAttr::Test(const PCGExData::FConstPoint& InTargetElement,
 	return Config.bInvert ? !bResult : bResult;
 }
 
+bool FPCGExMatchAttrToAttr::BuildIndex()
+{
+	if (Config.Check == EPCGExComparisonDataType::Numeric)
+	{
+		if (Config.NumericComparison != EPCGExComparison::StrictlyEqual)
+		{
+			return false;
+		}
+
+		for (int32 i = 0; i < NumGetters.Num(); i++)
+		{
+			const double Value = NumGetters[i]->FetchSingle(PCGExData::FConstPoint(nullptr, 0, i), TNumericLimits<double>::Max());
+			if (FMath::IsNaN(Value)) { continue; }                 // Never equal to anything
+			NumIndex.FindOrAdd(Value == 0 ? 0 : Value).Add(i); // -0 == 0
+		}
+
+		return true;
+	}
+
+	if (Config.StringComparison != EPCGExStringComparison::StrictlyEqual)
+	{
+		return false;
+	}
+
+	for (int32 i = 0; i < StrGetters.Num(); i++)
+	{
+		StrIndex.FindOrAdd(StrGetters[i]->FetchSingle(PCGExData::FConstPoint(nullptr, 0, i), TEXT(""))).Add(i);
+	}
+
+	return true;
+}
+
+void FPCGExMatchAttrToAttr::GetIndexedMatches(const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope, PCGExMatching::FPostings& OutMatches) const
+{
+	OutMatches.Reset();
+
+	const PCGExMatching::FPostings* Postings = nullptr;
+
+	if (Config.Check == EPCGExComparisonDataType::Numeric)
+	{
+		double CandidateValue = 0;
+		if (PCGExData::Helpers::TryReadDataValue<double>(Context, InCandidate.Data, Config.CandidateAttributeName_Sanitized, CandidateValue))
+		{
+			Postings = NumIndex.Find(CandidateValue == 0 ? 0 : CandidateValue);
+		}
+	}
+	else
+	{
+		FString CandidateValue = TEXT("");
+		if (PCGExData::Helpers::TryReadDataValue<FString>(Context, InCandidate.Data, Config.CandidateAttributeName_Sanitized, CandidateValue))
+		{
+			Postings = StrIndex.Find(CandidateValue);
+		}
+	}
+
+	if (Postings) { OutMatches = *Postings; }
+	if (Config.bInvert) { InvertPostings(OutMatches); }
+}
+
 bool UPCGExMatchAttrToAttrFactory::WantsPoints() const
 {
 	return !PCGExMetaHelpers::IsDataDomainAttribute(Config.TargetAttributeName);
@@ -88,6 +88,68 @@ bool FPCGExMatchByIndex::Test(const PCGExData::FConstPoint& InTargetElement, con
 	return Config.bInvert ? !bResult : bResult;
 }
 
+bool FPCGExMatchByIndex::BuildIndex()
+{
+	if (Config.Source == EPCGExMatchByIndexSource::Target)
+	{
+		const int32 NumSources = MatchableSources->Num();
+		SourceIndices.SetNumUninitialized(NumSources);
+		for (int32 i = 0; i < NumSources; i++)
+		{
+			SourceIndices[i] = bIsIndex ? i : IndexGetters[i]->FetchSingle(PCGExData::FConstPoint(nullptr, 0, i), -1);
+		}
+	}
+
+	return true;
+}
+
+void FPCGExMatchByIndex::GetIndexedMatches(const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope, PCGExMatching::FPostings& OutMatches) const
+{
+	OutMatches.Reset();
+
+	if (Config.Source == EPCGExMatchByIndexSource::Target)
+	{
+		if (InCandidate.Index != -1)
+		{
+			// Sanitizing depends on the number of candidates, so lookups are built per scope size
+			const TSharedPtr<TMap<int32, PCGExMatching::FPostings>> Lookup = GetSanitizedLookup(InMatchingScope.GetNumCandidates() - 1);
+			if (const PCGExMatching::FPostings* Postings = Lookup->Find(InCandidate.Index)) { OutMatches = *Postings; }
+		}
+	}
+	else
+	{
+		// The candidate value points at a single source
+		int32 IndexValue = -1;
+		if (PCGExData::Helpers::TryReadDataValue<int32>(Context, InCandidate.Data, Config.IndexAttribute, IndexValue))
+		{
+			IndexValue = PCGExMath::SanitizeIndex(IndexValue, MatchableSources->Num() - 1, Config.IndexSafety);
+			if (IndexValue != -1) { OutMatches.Add(IndexValue); }
+		}
+	}
+
+	if (Config.bInvert) { InvertPostings(OutMatches); }
+}
+
+TSharedPtr<TMap<int32, PCGExMatching::FPostings>> FPCGExMatchByIndex::GetSanitizedLookup(const int32 MaxIndex) const
+{
+	{
+		FReadScopeLock ReadScopeLock(LookupLock);
+		if (const TSharedPtr<TMap<int32, PCGExMatching::FPostings>>* Existing = SanitizedLookups.Find(MaxIndex)) { return *Existing; }
+	}
+
+	TSharedPtr<TMap<int32, PCGExMatching::FPostings>> Lookup = MakeShared<TMap<int32, PCGExMatching::FPostings>>();
+	for (int32 i = 0; i < SourceIndices.Num(); i++)
+	{
+		const int32 Sanitized = PCGExMath::SanitizeIndex(SourceIndices[i], MaxIndex, Config.IndexSafety);
+		if (Sanitized != -1) { Lookup->FindOrAdd(Sanitized).Add(i); }
+	}
+
+	FWriteScopeLock WriteScopeLock(LookupLock);
+	if (const TSharedPtr<TMap<int32, PCGExMatching::FPostings>>* Existing = SanitizedLookups.Find(MaxIndex)) { return *Existing; }
+	SanitizedLookups.Add(MaxIndex, Lookup);
+	return Lookup;
+}
+
 bool UPCGExMatchByIndexFactory::WantsPoints() const
 {
 	return !PCGExMetaHelpers::IsDataDomainAttribute(Config.IndexAttribute);
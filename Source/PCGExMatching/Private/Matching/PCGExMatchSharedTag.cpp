@@ -150,28 +150,8 @@ bool FPCGExMatchSharedTag::Test(const PCGExData::FConstPoint& InTargetElement, c
 		}
 		else
 		{
-			// Check raw tags
-			for (const FString& Tag : TargetTags->RawTags)
-			{
-				if (CandidateTags->RawTags.Contains(Tag))
-				{
-					bResult = true;
-					break;
-				}
-			}
-
-			// Check value tag names (ignoring values)
-			if (!bResult)
-			{
-				for (const TPair<FString, TSharedPtr<PCGExData::IDataValue>>& Pair : TargetTags->ValueTags)
-				{
-					if (CandidateTags->ValueTags.Contains(Pair.Key))
-					{
-						bResult = true;
-						break;
-					}
-				}
-			}
+			// Raw tags and value tag names (ignoring values)
+			bResult = TargetTags->SharesAnyTag(*CandidateTags);
 		}
 	}
 	break;
@@ -209,40 +189,178 @@ bool FPCGExMatchSharedTag::Test(const PCGExData::FConstPoint& InTargetElement, c
 		}
 		else
 		{
-			// All candidate raw tags must exist in target
+			// All candidate raw tags and value tag names must exist in target (ignoring values)
+			bResult = TargetTags->HasAllTagsOf(*CandidateTags);
+		}
+
+		// Empty candidate tags always match
+		if (CandidateTags->RawTags.IsEmpty() && CandidateTags->ValueTags.IsEmpty())
+		{
+			bResult = true;
+		}
+	}
+	break;
+	}
+
+	return Config.bInvert ? !bResult : bResult;
+}
+
+bool FPCGExMatchSharedTag::BuildIndex()
+{
+	if (!TagNameGetters.IsEmpty())
+	{
+		return false;
+	}
+
+	FString ValueKey;
+
+	if (Config.Mode == EPCGExTagMatchMode::Specific)
+	{
+		IndexedTagName = Config.TagNameValue.Constant;
+		bIndexedValueMatch = Config.bDoValueMatch;
+
+		if (TSharedPtr<PCGExData::IDataValue> Value = PCGExData::TryGetValueFromTag(IndexedTagName, IndexedTagName))
+		{
+			bIndexedValueMatch = true;
+		}
+	}
+
+	for (int32 i = 0; i < Tags.Num(); i++)
+	{
+		const TSharedPtr<PCGExData::FTags> SourceTags = Tags[i].Pin();
+		if (!SourceTags)
+		{
+			continue;
+		}
+
+		if (Config.Mode == EPCGExTagMatchMode::Specific)
+		{
+			if (const TSharedPtr<PCGExData::IDataValue> Value = SourceTags->GetValue(IndexedTagName))
+			{
+				if (!bIndexedValueMatch) { ValueTaggedSources.Add(i); }
+				else if (PCGExMatching::GetSameValueKey(Value, ValueKey)) { ValueTagIndex.FindOrAdd(ValueKey).Add(i); }
+			}
+			else if (!bIndexedValueMatch && SourceTags->RawTags.Contains(IndexedTagName))
+			{
+				RawTaggedSources.Add(i);
+			}
+
+			continue;
+		}
+
+		ValidSources.Add(i);
+
+		for (const FString& Tag : SourceTags->RawTags)
+		{
+			RawTagIndex.FindOrAdd(Tag).Add(i);
+		}
+
+		for (const TPair<FString, TSharedPtr<PCGExData::IDataValue>>& Pair : SourceTags->ValueTags)
+		{
+			if (!Config.bMatchTagValues) { ValueTagIndex.FindOrAdd(Pair.Key).Add(i); }
+			else if (PCGExMatching::GetSameValueKey(Pair.Value, ValueKey)) { ValueTagIndex.FindOrAdd(Pair.Key + TEXT("|") + ValueKey).Add(i); }
+		}
+	}
+
+	return true;
+}
+
+void FPCGExMatchSharedTag::GetIndexedMatches(const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope, PCGExMatching::FPostings& OutMatches) const
+{
+	OutMatches.Reset();
+
+	const TSharedPtr<PCGExData::FTags> CandidateTags = InCandidate.GetTags();
+	if (!CandidateTags)
+	{
+		if (Config.bInvert) { InvertPostings(OutMatches); }
+		return;
+	}
+
+	FString ValueKey;
+
+	switch (Config.Mode)
+	{
+	case EPCGExTagMatchMode::Specific:
+		if (const TSharedPtr<PCGExData::IDataValue> Value = CandidateTags->GetValue(IndexedTagName))
+		{
+			if (!bIndexedValueMatch)
+			{
+				OutMatches = ValueTaggedSources;
+			}
+			else if (PCGExMatching::GetSameValueKey(Value, ValueKey))
+			{
+				if (const PCGExMatching::FPostings* Postings = ValueTagIndex.Find(ValueKey)) { OutMatches = *Postings; }
+			}
+		}
+		else if (!bIndexedValueMatch && CandidateTags->RawTags.Contains(IndexedTagName))
+		{
+			OutMatches = RawTaggedSources;
+		}
+		break;
+
+	case EPCGExTagMatchMode::AnyShared:
+		// Union of the sources sharing each candidate tag
+		if (Config.bMatchTagValues)
+		{
+			for (const TPair<FString, TSharedPtr<PCGExData::IDataValue>>& Pair : CandidateTags->ValueTags)
+			{
+				if (!PCGExMatching::GetSameValueKey(Pair.Value, ValueKey)) { continue; }
+				if (const PCGExMatching::FPostings* Postings = ValueTagIndex.Find(Pair.Key + TEXT("|") + ValueKey)) { PCGExMatching::UnionPostings(OutMatches, *Postings); }
+			}
+		}
+		else
+		{
 			for (const FString& Tag : CandidateTags->RawTags)
 			{
-				if (!TargetTags->RawTags.Contains(Tag))
-				{
-					bResult = false;
-					break;
-				}
+				if (const PCGExMatching::FPostings* Postings = RawTagIndex.Find(Tag)) { PCGExMatching::UnionPostings(OutMatches, *Postings); }
 			}
 
-			// All candidate value tag names must exist in target (ignoring values)
-			if (bResult)
+			for (const TPair<FString, TSharedPtr<PCGExData::IDataValue>>& Pair : CandidateTags->ValueTags)
 			{
-				for (const TPair<FString, TSharedPtr<PCGExData::IDataValue>>& Pair : CandidateTags->ValueTags)
-				{
-					if (!TargetTags->ValueTags.Contains(Pair.Key))
-					{
-						bResult = false;
-						break;
-					}
-				}
+				if (const PCGExMatching::FPostings* Postings = ValueTagIndex.Find(Pair.Key)) { PCGExMatching::UnionPostings(OutMatches, *Postings); }
 			}
 		}
+		break;
 
-		// Empty candidate tags always match
-		if (CandidateTags->RawTags.IsEmpty() && CandidateTags->ValueTags.IsEmpty())
+	case EPCGExTagMatchMode::AllShared:
+	{
+		// Intersection of the sources holding each candidate tag
+		bool bConstrained = false;
+		auto Require = [&](const PCGExMatching::FPostings* Postings)
 		{
-			bResult = true;
+			if (!Postings) { OutMatches.Reset(); }
+			else if (!bConstrained) { OutMatches = *Postings; }
+			else { PCGExMatching::IntersectPostings(OutMatches, *Postings); }
+
+			bConstrained = true;
+			return !OutMatches.IsEmpty();
+		};
+
+		bool bAny = true;
+
+		for (const TPair<FString, TSharedPtr<PCGExData::IDataValue>>& Pair : CandidateTags->ValueTags)
+		{
+			if (!Config.bMatchTagValues) { bAny = Require(ValueTagIndex.Find(Pair.Key)); }
+			else { bAny = Require(PCGExMatching::GetSameValueKey(Pair.Value, ValueKey) ? ValueTagIndex.Find(Pair.Key + TEXT("|") + ValueKey) : nullptr); }
+
+			if (!bAny) { break; }
 		}
+
+		if (bAny)
+		{
+			for (const FString& Tag : CandidateTags->RawTags)
+			{
+				if (!Require(RawTagIndex.Find(Tag))) { break; }
+			}
+		}
+
+		// Empty candidate tags always match
+		if (!bConstrained) { OutMatches = ValidSources; }
 	}
 	break;
 	}
 
-	return Config.bInvert ? !bResult : bResult;
+	if (Config.bInvert) { InvertPostings(OutMatches); }
 }
 
 bool UPCGExMatchSharedTagFactory::WantsPoints() const
@@ -5,6 +5,7 @@
 
 #include "PCGExVersion.h"
 #include "Data/PCGExAttributeBroadcaster.h"
+#include "Data/PCGExDataTags.h"
 #include "Data/PCGExPointIO.h"
 #include "Factories/PCGExFactoryData.h"
 
@@ -144,6 +145,43 @@ bool FPCGExMatchTagToAttr::Test(const PCGExData::FConstPoint& InTargetElement, c
 	return !Config.bInvert;
 }
 
+bool FPCGExMatchTagToAttr::BuildIndex()
+{
+	if (Config.bDoValueMatch || Config.NameMatch != EPCGExStringMatchMode::Equals)
+	{
+		return false;
+	}
+
+	for (int32 i = 0; i < MatchableSources->Num(); i++)
+	{
+		const FString TagName = TagNameGetters.IsEmpty() ? Config.TagNameValue.Constant : TagNameGetters[i]->FetchSingle(PCGExData::FConstPoint(nullptr, 0, i), TEXT(""));
+		TagNameIndex.FindOrAdd(TagName).Add(i);
+	}
+
+	return true;
+}
+
+void FPCGExMatchTagToAttr::GetIndexedMatches(const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope, PCGExMatching::FPostings& OutMatches) const
+{
+	OutMatches.Reset();
+
+	// Sources whose tag name is any of the candidate tags
+	if (const TSharedPtr<PCGExData::FTags> CandidateTags = InCandidate.GetTags())
+	{
+		for (const TPair<FString, TSharedPtr<PCGExData::IDataValue>>& Pair : CandidateTags->ValueTags)
+		{
+			if (const PCGExMatching::FPostings* Postings = TagNameIndex.Find(Pair.Key)) { PCGExMatching::UnionPostings(OutMatches, *Postings); }
+		}
+
+		for (const FString& Tag : CandidateTags->RawTags)
+		{
+			if (const PCGExMatching::FPostings* Postings = TagNameIndex.Find(Tag)) { PCGExMatching::UnionPostings(OutMatches, *Postings); }
+		}
+	}
+
+	if (Config.bInvert) { InvertPostings(OutMatches); }
+}
+
 bool UPCGExMatchTagToAttrFactory::WantsPoints() const
 {
 	if (Config.TagNameValue.Input == EPCGExInputValueType::Attribute && !PCGExMetaHelpers::IsDataDomainAttribute(Config.TagNameValue.Attribute))
@@ -30,11 +30,24 @@ namespace PCGExData
 {
 	class FPointIO;
 	struct FConstPoint;
+	class IDataValue;
 }
 
 namespace PCGExMatching
 {
 	struct FScope;
+
+	/** Sorted source lists (posting lists) used by indexed rules. */
+	using FPostings = TArray<int32>;
+
+	/** Keep only the entries of sorted InOut that are also in sorted InOther. */
+	PCGEXMATCHING_API void IntersectPostings(FPostings& InOut, const FPostings& InOther);
+
+	/** Merge sorted InOther into sorted InOut, without duplicates. */
+	PCGEXMATCHING_API void UnionPostings(FPostings& InOut, const FPostings& InOther);
+
+	/** Key such that two values share it exactly when IDataValue::SameValue holds. Returns false for values that can't equal anything. */
+	PCGEXMATCHING_API bool GetSameValueKey(const TSharedPtr<PCGExData::IDataValue>& InValue, FString& OutKey);
 }
 
 USTRUCT(BlueprintType)
@@ -86,8 +99,29 @@ public:
 		return -1;
 	}
 
+	/**
+	 * Index matchable sources by the value this rule compares, so data-level matching can look candidates up
+	 * instead of testing every source. Called once, after PrepareForMatchableSources.
+	 * Returns false when the current config can't be resolved through an index; Test is used instead.
+	 */
+	virtual bool BuildIndex()
+	{
+		return false;
+	}
+
+	/**
+	 * Sorted indices of the matchable sources for which Test would pass against their first element.
+	 * Only called if BuildIndex succeeded; must be safe to call concurrently.
+	 */
+	virtual void GetIndexedMatches(const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope, PCGExMatching::FPostings& OutMatches) const
+	{
+	}
+
 protected:
 	TSharedPtr<TArray<FPCGExTaggedData>> MatchableSources;
+
+	/** Turn the sorted matches into the sources they don't contain, for inverted rules. */
+	void InvertPostings(PCGExMatching::FPostings& InOutMatches) const;
 };
 
 USTRUCT(meta=(PCG_DataTypeDisplayName="PCGEx | Match Rule"))
@@ -72,6 +72,13 @@ namespace PCGExMatching
 		TArray<TSharedPtr<FPCGExMatchRuleOperation>> RequiredOperations;
 		TArray<TSharedPtr<FPCGExMatchRuleOperation>> OptionalOperations;
 
+		// Data-level matching: rules resolved through their index, and the ones still tested pairwise
+		bool bUseIndex = false;
+		TArray<TSharedPtr<FPCGExMatchRuleOperation>> IndexedRequired;
+		TArray<TSharedPtr<FPCGExMatchRuleOperation>> IndexedOptional;
+		TArray<TSharedPtr<FPCGExMatchRuleOperation>> TestedRequired;
+		TArray<TSharedPtr<FPCGExMatchRuleOperation>> TestedOptional;
+
 	public:
 		EPCGExMapMatchMode MatchMode = EPCGExMapMatchMode::Disabled;
 
@@ -161,6 +168,9 @@ namespace PCGExMatching
 
 	protected:
 		int32 GetMatchLimitFor(const FPCGExTaggedData& InDataCandidate) const;
+
+		/** Data-level matches for a candidate, appended to OutMatches in ascending order. Sources flagged in InSkip are left out. */
+		void GatherMatches(const FPCGExTaggedData& InDataCandidate, FScope& InMatchingScope, const TBitArray<>* InSkip, TArray<int32>& OutMatches) const;
 		void RegisterTaggedData(FPCGExContext* InContext, const FPCGExTaggedData& InTaggedData);
 		bool InitInternal(FPCGExContext* InContext, const FName InFactoriesLabel);
 		bool InitInternal(const TArray<TObjectPtr<const UPCGExMatchRuleFactoryData>>& InFactories);
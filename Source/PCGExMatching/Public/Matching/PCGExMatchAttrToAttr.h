@@ -70,9 +70,16 @@ public:
 
 	virtual bool Test(const PCGExData::FConstPoint& InTargetElement, const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope) const override;
 
+	/** Only strict equality can be indexed. */
+	virtual bool BuildIndex() override;
+	virtual void GetIndexedMatches(const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope, PCGExMatching::FPostings& OutMatches) const override;
+
 protected:
 	TArray<TSharedPtr<PCGExData::TAttributeBroadcaster<double>>> NumGetters;
 	TArray<TSharedPtr<PCGExData::TAttributeBroadcaster<FString>>> StrGetters;
+
+	TMap<double, PCGExMatching::FPostings> NumIndex;
+	TMap<FString, PCGExMatching::FPostings> StrIndex;
 };
 
 
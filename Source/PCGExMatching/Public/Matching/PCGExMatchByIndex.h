@@ -58,9 +58,19 @@ public:
 	virtual bool PrepareForMatchableSources(FPCGExContext* InContext, const TSharedPtr<TArray<FPCGExTaggedData>>& InMatchableSources) override;
 	virtual bool Test(const PCGExData::FConstPoint& InTargetElement, const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope) const override;
 
+	virtual bool BuildIndex() override;
+	virtual void GetIndexedMatches(const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope, PCGExMatching::FPostings& OutMatches) const override;
+
 protected:
 	TArray<TSharedPtr<PCGExData::TAttributeBroadcaster<int32>>> IndexGetters;
 	bool bIsIndex = false;
+
+	// Target source: raw index read on each source, and sanitized index -> sources lookups per scope size
+	TArray<int32> SourceIndices;
+	mutable FRWLock LookupLock;
+	mutable TMap<int32, TSharedPtr<TMap<int32, PCGExMatching::FPostings>>> SanitizedLookups;
+
+	TSharedPtr<TMap<int32, PCGExMatching::FPostings>> GetSanitizedLookup(const int32 MaxIndex) const;
 };
 
 
@@ -86,9 +86,23 @@ public:
 
 	virtual bool Test(const PCGExData::FConstPoint& InTargetElement, const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope) const override;
 
+	/** Indexes source tags as they are at init time. Not available when the tag name is read from an attribute. */
+	virtual bool BuildIndex() override;
+	virtual void GetIndexedMatches(const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope, PCGExMatching::FPostings& OutMatches) const override;
+
 protected:
 	TArray<TSharedPtr<PCGExData::TAttributeBroadcaster<FString>>> TagNameGetters;
 	TArray<TWeakPtr<PCGExData::FTags>> Tags;
+
+	// Specific mode
+	FString IndexedTagName;
+	bool bIndexedValueMatch = false;
+	PCGExMatching::FPostings ValueTaggedSources; // Sources holding the tag as a value tag
+	PCGExMatching::FPostings RawTaggedSources;   // Sources holding the tag as a raw tag only
+
+	PCGExMatching::FPostings ValidSources; // Sources with tags
+	TMap<FString, PCGExMatching::FPostings> RawTagIndex;
+	TMap<FString, PCGExMatching::FPostings> ValueTagIndex; // Keyed by name, or by name and value when values are matched
 };
 
 
@@ -94,7 +94,13 @@ public:
 
 	virtual bool Test(const PCGExData::FConstPoint& InTargetElement, const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope) const override;
 
+	/** Only exact tag name matches without value match can be indexed. */
+	virtual bool BuildIndex() override;
+	virtual void GetIndexedMatches(const FPCGExTaggedData& InCandidate, const PCGExMatching::FScope& InMatchingScope, PCGExMatching::FPostings& OutMatches) const override;
+
 protected:
+	TMap<FString, PCGExMatching::FPostings> TagNameIndex;
+
 	TArray<TSharedPtr<PCGExData::TAttributeBroadcaster<FString>>> TagNameGetters;
 	TArray<TSharedPtr<PCGExData::TAttributeBroadcaster<double>>> NumGetters;
 	TArray<TSharedPtr<PCGExData::TAttributeBroadcaster<FString>>> StrGetters;
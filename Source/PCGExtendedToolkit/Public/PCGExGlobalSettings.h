@@ -56,6 +56,14 @@ public:
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster")
 	bool bUseDelaunator = true;
 
+	/** Build large 3D Delaunay tetrahedralizations from independently triangulated blocks, merged and verified afterward. Falls back to a serial build when verification fails. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster")
+	bool bParallelDelaunay = false;
+
+	/** Minimum point count before the parallel 3D Delaunay build kicks in. */
+	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(ClampMin=1000, EditCondition="bParallelDelaunay"))
+	int32 ParallelDelaunayThreshold = 200000;
+
 	UPROPERTY(EditAnywhere, config, Category = "Performance|Cluster", meta=(ClampMin=1))
 	int32 SmallClusterSize = 512;
 